@@ -13,13 +13,16 @@
 #include "engine/core/events/event_system.hpp"
 #include "engine/core/events/editor_events.hpp"
 #include "engine/render/render_system.hpp"
+#include "editor/editor_ui_layer.hpp"
 
 namespace wave::editor::app
 {
     using wave::engine::core::runtime::RuntimeConfig;
     using wave::engine::core::runtime::initialize;
     using wave::engine::core::runtime::shutdown;
+    using wave::engine::core::runtime::environment;
     using wave::engine::core::logging::LogLevel;
+    using wave::engine::core::logging::Logger;
     using wave::engine::core::time::Time;
     using wave::engine::core::time::FrameStats;
     using wave::engine::core::input::InputSystem;
@@ -29,6 +32,7 @@ namespace wave::editor::app
     using wave::engine::core::events::WindowResizedEvent;
     using wave::engine::core::events::Event;
     using wave::engine::render::RenderSystem;
+    using wave::editor::EditorUILayer;
 
     int EditorApp::run(const EditorAppConfig& config,
                        const fs::path& executable_path)
@@ -65,20 +69,28 @@ namespace wave::editor::app
             EventSystem::subscribe<WindowClosedEvent>(
                 [](const Event&)
                 {
-                    WAVE_LOG_INFO("[editor] WindowClosedEvent received.");
+                    WAVE_LOG_CH_INFO(Editor, "WindowClosedEvent received.");
                 });
 
             EventSystem::subscribe<WindowResizedEvent>(
                 [](const Event& base)
                 {
                     const auto& e = static_cast<const WindowResizedEvent&>(base);
-                    WAVE_LOG_INFO("[editor] WindowResizedEvent: ",
-                                  e.width, "x", e.height);
+                    WAVE_LOG_CH_INFO(Editor, "WindowResizedEvent: ",
+                                     e.width, "x", e.height);
 
                     RenderSystem::resize(e.width, e.height);
                 });
 
-            WAVE_LOG_INFO("[editor] Wave Editor starting up.");
+            // Editor UI; the project's resources are indexed once and shared
+            // by the asset database and the resource browser.
+            EditorUILayer uiLayer;
+            uiLayer.initialize(static_cast<float>(window.width()),
+                               static_cast<float>(window.height()));
+            uiLayer.editor_ui().open_project(environment().resources_path(),
+                                             environment().cache_path());
+
+            WAVE_LOG_CH_INFO(Editor, "Wave Editor starting up.");
 
             // New: frame stats instance
             FrameStats frameStats;
@@ -105,14 +117,23 @@ namespace wave::editor::app
                     window.set_title(title);
                 }
 
+                // Console output, asset / resource browser changes
+                uiLayer.editor_ui().update();
+
+                // Interval flush of the file sinks
+                Logger::poll();
+
                 RenderSystem::begin_frame();
 
-                // TODO: editor update + render calls will go here.
+                // TODO: editor render calls will go here.
 
                 RenderSystem::end_frame();
             }
 
-            WAVE_LOG_INFO("[editor] Wave Editor shutting down.");
+            WAVE_LOG_CH_INFO(Editor, "Wave Editor shutting down.");
+
+            // Saves the asset database cache for the next launch.
+            uiLayer.editor_ui().close_project();
 
             RenderSystem::shutdown();
             InputSystem::shutdown();
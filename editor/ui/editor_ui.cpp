@@ -1,11 +1,22 @@
 #include "editor_ui.hpp"
 
+#include "engine/core/logging/log.hpp"
+#include "engine/core/logging/log_config.hpp"
+
 namespace wave::editor::ui {
 
 // -----------------------------------------------------------------------------
 // Public API
 // -----------------------------------------------------------------------------
 
+EditorUI::~EditorUI() {
+    close_project();
+
+    if (m_consoleSink) {
+        wave::engine::core::logging::Logger::remove_sink(m_consoleSink);
+    }
+}
+
 void EditorUI::initialize(float width, float height) {
     m_width  = width;
     m_height = height;
@@ -38,6 +49,104 @@ void EditorUI::on_resize(float width, float height) {
     m_context.update_layout(screenRect);
 }
 
+void EditorUI::update() {
+    if (m_consoleSink) {
+        UIPanel* panel = m_panelManager.find_panel("console");
+        if (panel && panel->kind() == PanelKind::Console) {
+            m_consoleSink->drain_into(*static_cast<ConsolePanel*>(panel));
+        }
+    }
+
+    // The database hears about the changes from the index itself.
+    if (m_projectIndex && m_projectIndex->refresh() > 0) {
+        refresh_resource_browser();
+    }
+
+    // Failures are logged by the pipeline.
+    if (m_importPipeline) {
+        m_importPipeline->update();
+        for (const auto& result : m_importPipeline->take_results()) {
+            if (result.success && !result.cached) {
+                WAVE_LOG_CH_DEBUG(Editor, "Imported ", result.relativePath);
+            }
+        }
+    }
+}
+
+void EditorUI::open_project(const std::filesystem::path& assetRoot, const std::filesystem::path& cacheDirectory) {
+    close_project();
+
+    if (!m_jobs) {
+        m_jobs = std::make_unique<engine::core::jobs::JobSystem>();
+        m_jobs->initialize();
+    }
+
+    m_projectIndex   = std::make_unique<engine::core::filesystem::DirectoryIndex>(assetRoot);
+    m_assetCacheFile = cacheDirectory / "assets.wadb";
+
+    // A missing or stale cache just means a full scan.
+    m_assetDatabase = std::make_unique<engine::assets::AssetDatabase>();
+    m_assetDatabase->set_job_system(m_jobs.get());
+    m_assetDatabase->initialize(m_projectIndex->root());
+    m_assetDatabase->load_cache(m_assetCacheFile);
+    m_assetDatabase->attach(*m_projectIndex);
+
+    // Without an artifact directory the project still opens; nothing is
+    // imported.
+    m_artifactCache = std::make_unique<engine::assets::ArtifactCache>();
+    if (m_artifactCache->initialize(cacheDirectory / "artifacts")) {
+        m_importPipeline = std::make_unique<engine::assets::ImportPipeline>(*m_assetDatabase, *m_artifactCache);
+        m_importPipeline->add_importer(std::make_unique<engine::assets::TextureImporter>());
+        m_importPipeline->add_importer(std::make_unique<engine::assets::MeshImporter>());
+        m_importPipeline->add_importer(std::make_unique<engine::assets::ShaderImporter>());
+        m_importPipeline->set_job_system(m_jobs.get());
+    } else {
+        WAVE_LOG_CH_WARN(Editor, "Cannot create the artifact cache in ", (cacheDirectory / "artifacts").string(),
+                         "; assets will not be imported");
+    }
+
+    UIPanel* panel = m_panelManager.find_panel("resource_browser");
+    if (panel && panel->kind() == PanelKind::ResourceBrowser) {
+        auto* browser = static_cast<ResourceBrowserPanel*>(panel);
+        browser->set_root_path(m_projectIndex->root().generic_string());
+        browser->set_current_path(browser->root_path());
+    }
+
+    refresh_resource_browser();
+}
+
+void EditorUI::close_project() {
+    if (!m_assetDatabase) {
+        return;
+    }
+
+    // Finishes (and records) the imports in flight, so the saved cache
+    // does not flag them again.
+    m_importPipeline.reset();
+    m_artifactCache.reset();
+
+    std::error_code ec;
+    std::filesystem::create_directories(m_assetCacheFile.parent_path(), ec);
+    if (!m_assetDatabase->save_cache(m_assetCacheFile)) {
+        WAVE_LOG_CH_WARN(Editor, "Could not save the asset database cache to ", m_assetCacheFile.string());
+    }
+
+    m_assetDatabase.reset();
+    m_projectIndex.reset();
+    m_assetCacheFile.clear();
+}
+
+void EditorUI::refresh_resource_browser() {
+    if (!m_projectIndex) {
+        return;
+    }
+
+    UIPanel* panel = m_panelManager.find_panel("resource_browser");
+    if (panel && panel->kind() == PanelKind::ResourceBrowser) {
+        static_cast<ResourceBrowserPanel*>(panel)->refresh_from_index(*m_projectIndex);
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Internal helpers
 // -----------------------------------------------------------------------------
@@ -108,7 +217,18 @@ void EditorUI::create_default_panels() {
         auto console = std::make_unique<ConsolePanel>("console", "Console");
         console->set_closable(true);
         console->set_movable(true);
+
+        // "log", "log level debug", "log render trace"
+        console->register_command("log", [](std::string_view args, std::string& reply) {
+            return wave::engine::core::logging::execute_log_command(args, reply);
+        });
+
         m_panelManager.register_panel(std::move(console), DockSlot::Left);
+
+        if (!m_consoleSink) {
+            m_consoleSink = std::make_shared<ConsoleLogSink>();
+            wave::engine::core::logging::Logger::add_sink(m_consoleSink);
+        }
     }
 
     // Viewport in the center
@@ -119,7 +239,15 @@ void EditorUI::create_default_panels() {
         m_panelManager.register_panel(std::move(viewport), DockSlot::Center);
     }
 
-    // Additional panels (resource browser, stats, etc.) can be registered here later.
+    // Resource browser on the right; filled by open_project()
+    {
+        auto browser = std::make_unique<ResourceBrowserPanel>("resource_browser", "Resources");
+        browser->set_closable(true);
+        browser->set_movable(true);
+        m_panelManager.register_panel(std::move(browser), DockSlot::Right);
+    }
+
+    // Additional panels (stats, etc.) can be registered here later.
 }
 
 } // namespace wave::editor::ui
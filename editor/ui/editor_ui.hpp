@@ -3,7 +3,18 @@
 #include "ui_context.hpp"
 #include "panels/panel_manager.hpp"
 #include "panels/console/console_panel.hpp"
+#include "panels/console/console_log_sink.hpp"
 #include "panels/viewport/viewport_panel.hpp"
+#include "panels/resource_browser/resource_browser_panel.hpp"
+
+#include "engine/assets/artifact_cache.hpp"
+#include "engine/assets/asset_database.hpp"
+#include "engine/assets/import_pipeline.hpp"
+#include "engine/core/filesystem/directory_index.hpp"
+#include "engine/core/jobs/job_system.hpp"
+
+#include <filesystem>
+#include <memory>
 
 namespace wave::editor::ui {
 
@@ -11,10 +22,13 @@ namespace wave::editor::ui {
 //  - Owns the UIContext (layout tree)
 //  - Owns the PanelManager (panels + docking intent)
 //  - Builds a simple default layout and panels
+//  - Owns the project's DirectoryIndex, shared by the AssetDatabase and the
+//    resource browser, so the tree is walked once, and the ImportPipeline
+//    that cooks what the database flags into the project's ArtifactCache
 class EditorUI final {
 public:
     EditorUI() = default;
-    ~EditorUI() = default;
+    ~EditorUI();
 
     EditorUI(const EditorUI&) = delete;
     EditorUI& operator=(const EditorUI&) = delete;
@@ -29,6 +43,30 @@ public:
     // Rebuilds the root rect and updates layout.
     void on_resize(float width, float height);
 
+    // Per-frame housekeeping: moves log output queued since the last frame
+    // into the console panel, picks up changes to the project tree (asset
+    // database and resource browser) and queues the imports they call for.
+    void update();
+
+    // Index 'assetRoot' once, attach a fresh AssetDatabase to the index and
+    // point the resource browser at it. Replaces any open project.
+    // 'cacheDirectory' keeps state between sessions: the database is loaded
+    // from it before the initial scan (which then only looks at what changed
+    // since) and saved back by close_project(), and cooked assets go to its
+    // "artifacts" subdirectory.
+    void open_project(const std::filesystem::path& assetRoot, const std::filesystem::path& cacheDirectory);
+
+    // Save the asset database cache and drop the project. Also done by the
+    // destructor and open_project().
+    void close_project();
+
+    // Re-list the resource browser's current directory from the index, e.g.
+    // after navigating. No-op without an open project.
+    void refresh_resource_browser();
+
+    // Null until open_project().
+    engine::assets::AssetDatabase* asset_database() { return m_assetDatabase.get(); }
+
     // Access to subsystems -----------------------------------------------------
 
     UIContext&      context()       { return m_context; }
@@ -45,6 +83,18 @@ private:
     UIContext    m_context;
     PanelManager m_panelManager;
 
+    // Subscribed to the engine Logger while the console panel exists.
+    std::shared_ptr<ConsoleLogSink> m_consoleSink;
+
+    // In dependency order: each is destroyed before what it uses (the
+    // database detaches from the index, the pipeline waits for its jobs).
+    std::unique_ptr<engine::core::jobs::JobSystem>            m_jobs;
+    std::unique_ptr<engine::core::filesystem::DirectoryIndex> m_projectIndex;
+    std::unique_ptr<engine::assets::AssetDatabase>            m_assetDatabase;
+    std::unique_ptr<engine::assets::ArtifactCache>            m_artifactCache;
+    std::unique_ptr<engine::assets::ImportPipeline>           m_importPipeline;
+    std::filesystem::path                                     m_assetCacheFile;
+
     float m_width{0.0f};
     float m_height{0.0f};
 };
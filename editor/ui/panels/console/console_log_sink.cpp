@@ -0,0 +1,54 @@
+#include "console_log_sink.hpp"
+
+#include <chrono>
+
+namespace wave::editor::ui {
+
+namespace {
+
+using wave::engine::core::logging::LogLevel;
+
+ConsoleSeverity to_severity(LogLevel level) {
+    switch (level) {
+    case LogLevel::Warn:
+        return ConsoleSeverity::Warning;
+    case LogLevel::Error:
+    case LogLevel::Critical:
+        return ConsoleSeverity::Error;
+    default:
+        return ConsoleSeverity::Info;
+    }
+}
+
+} // namespace
+
+void ConsoleLogSink::write(const wave::engine::core::logging::LogRecord& record) {
+    ConsoleMessage msg{};
+    msg.text      = std::string(record.message);
+    msg.severity  = to_severity(record.level);
+    msg.category  = wave::engine::core::logging::channel_to_string(record.channel);
+    msg.timestamp = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            record.time.time_since_epoch()).count());
+
+    std::scoped_lock lock(m_mutex);
+
+    if (m_maxPending > 0 && m_pending.size() >= m_maxPending) {
+        m_pending.pop_front();
+    }
+    m_pending.push_back(std::move(msg));
+}
+
+void ConsoleLogSink::drain_into(ConsolePanel& panel) {
+    {
+        std::scoped_lock lock(m_mutex);
+        m_swap.swap(m_pending);
+    }
+
+    for (auto& msg : m_swap) {
+        panel.add_message(std::move(msg));
+    }
+    m_swap.clear();
+}
+
+} // namespace wave::editor::ui
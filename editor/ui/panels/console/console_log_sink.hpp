@@ -0,0 +1,35 @@
+#pragma once
+
+#include "console_panel.hpp"
+
+#include "engine/core/logging/log_sink.hpp"
+
+#include <deque>
+#include <mutex>
+
+namespace wave::editor::ui {
+
+// Logger sink feeding the editor console.
+//
+// write() may be called from any thread, so records are queued here and
+// moved into the ConsolePanel on the UI thread via drain_into().
+class ConsoleLogSink final : public wave::engine::core::logging::LogSink {
+public:
+    ConsoleLogSink() = default;
+
+    void write(const wave::engine::core::logging::LogRecord& record) override;
+
+    // Move queued messages into the panel. Call once per UI frame.
+    void drain_into(ConsolePanel& panel);
+
+    // Queued messages beyond this are dropped (oldest first).
+    void set_max_pending(std::size_t maxPending) { m_maxPending = maxPending; }
+
+private:
+    std::mutex                  m_mutex;
+    std::deque<ConsoleMessage> m_pending;
+    std::deque<ConsoleMessage> m_swap;
+    std::size_t                m_maxPending{4096};
+};
+
+} // namespace wave::editor::ui
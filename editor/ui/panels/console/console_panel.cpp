@@ -37,6 +37,47 @@ void ConsolePanel::clear() {
     m_messages.clear();
 }
 
+// -----------------------------------------------------------------------------
+// Commands
+// -----------------------------------------------------------------------------
+
+void ConsolePanel::register_command(std::string name, CommandHandler handler) {
+    m_commands[std::move(name)] = std::move(handler);
+}
+
+void ConsolePanel::unregister_command(const std::string& name) {
+    m_commands.erase(name);
+}
+
+bool ConsolePanel::execute_command(std::string_view line) {
+    const std::size_t begin = line.find_first_not_of(" \t");
+    if (begin == std::string_view::npos) {
+        return false;
+    }
+    line.remove_prefix(begin);
+
+    const std::size_t nameEnd = line.find_first_of(" \t");
+    const std::string name(line.substr(0, nameEnd));
+    const std::string_view args = nameEnd == std::string_view::npos ? std::string_view{}
+                                                                    : line.substr(nameEnd + 1);
+
+    add_message("> " + std::string(line), ConsoleSeverity::Info, 0, "command");
+
+    auto it = m_commands.find(name);
+    if (it == m_commands.end()) {
+        add_message("Unknown command: " + name, ConsoleSeverity::Error, 0, "command");
+        return false;
+    }
+
+    std::string reply;
+    const bool ok = it->second(args, reply);
+
+    if (!reply.empty()) {
+        add_message(reply, ok ? ConsoleSeverity::Info : ConsoleSeverity::Error, 0, "command");
+    }
+    return ok;
+}
+
 // -----------------------------------------------------------------------------
 // Filtering
 // -----------------------------------------------------------------------------
@@ -3,8 +3,11 @@
 #include "../ui_panel.hpp"
 
 #include <string>
+#include <string_view>
 #include <deque>
 #include <cstdint>
+#include <functional>
+#include <unordered_map>
 
 namespace wave::editor::ui {
 
@@ -23,6 +26,10 @@ struct ConsoleMessage {
 
 class ConsolePanel final : public UIPanel {
 public:
+    // Handler for a console command. 'args' is the text after the command
+    // name; write the response to 'reply'. Return false to show it as an error.
+    using CommandHandler = std::function<bool(std::string_view args, std::string& reply)>;
+
     explicit ConsolePanel(std::string id = "console",
                           std::string title = "Console");
 
@@ -46,6 +53,16 @@ public:
 
     const std::deque<ConsoleMessage>& messages() const { return m_messages; }
 
+    // Commands -----------------------------------------------------------------
+
+    void register_command(std::string name, CommandHandler handler);
+    void unregister_command(const std::string& name);
+
+    // Run a line typed into the console ("log render trace"). The line and
+    // the handler's reply are echoed as messages. Returns false for unknown
+    // commands or when the handler reports an error.
+    bool execute_command(std::string_view line);
+
     // Filtering ----------------------------------------------------------------
 
     void set_show_info(bool show) { m_showInfo = show; }
@@ -74,6 +91,8 @@ private:
 private:
     std::deque<ConsoleMessage> m_messages;
 
+    std::unordered_map<std::string, CommandHandler> m_commands;
+
     std::size_t m_maxMessages{1024};
 
     bool        m_showInfo{true};
@@ -1,6 +1,7 @@
 #include "resource_browser_panel.hpp"
 
 #include <algorithm>
+#include <filesystem>
 
 namespace wave::editor::ui {
 
@@ -75,6 +76,64 @@ void ResourceBrowserPanel::set_entries(std::vector<ResourceEntry> entries) {
     }
 }
 
+void ResourceBrowserPanel::refresh_from_index(const engine::core::filesystem::DirectoryIndex& index) {
+    const auto directory = index.relative(m_currentPath.empty() ? m_rootPath : m_currentPath);
+
+    std::vector<ResourceEntry> entries;
+    for (const auto& child : index.list(directory.value_or(std::string()))) {
+        ResourceEntry entry;
+        entry.name        = std::string(child.name());
+        entry.fullPath    = index.absolute(child.relativePath).generic_string();
+        entry.isDirectory = child.isDirectory;
+        entries.push_back(std::move(entry));
+    }
+
+    // Folders first, then files; list() is already sorted by name.
+    std::stable_partition(entries.begin(), entries.end(), [](const ResourceEntry& e) {
+        return e.isDirectory;
+    });
+
+    set_entries(std::move(entries));
+}
+
+void ResourceBrowserPanel::refresh_from_snapshot(const engine::assets::AssetSnapshot& snapshot) {
+    namespace fs = std::filesystem;
+
+    const fs::path current = fs::path(m_currentPath.empty() ? m_rootPath : m_currentPath).lexically_normal();
+    std::string directory = current.lexically_relative(snapshot.root().lexically_normal()).generic_string();
+    if (directory == "." || directory == ".." || directory.starts_with("../")) {
+        directory.clear();
+    }
+
+    std::vector<std::string_view> folders;
+    snapshot.subdirectories(directory, folders);
+    const auto files = snapshot.in_directory(directory);
+
+    std::vector<ResourceEntry> entries;
+    entries.reserve(folders.size() + files.size());
+
+    // Folders first, then files; both come sorted by name.
+    const std::string prefix = directory.empty() ? std::string() : directory + "/";
+    for (std::string_view name : folders) {
+        ResourceEntry entry;
+        entry.name        = std::string(name);
+        entry.fullPath    = (snapshot.root() / (prefix + entry.name)).generic_string();
+        entry.isDirectory = true;
+        entries.push_back(std::move(entry));
+    }
+
+    for (engine::assets::AssetRef file : files) {
+        const std::string_view relativePath = file.relative_path();
+
+        ResourceEntry entry;
+        entry.name     = std::string(relativePath.substr(relativePath.find_last_of('/') + 1));
+        entry.fullPath = file.absolute_path().generic_string();
+        entries.push_back(std::move(entry));
+    }
+
+    set_entries(std::move(entries));
+}
+
 // -----------------------------------------------------------------------------
 // Selection
 // -----------------------------------------------------------------------------
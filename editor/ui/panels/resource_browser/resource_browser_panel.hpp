@@ -2,6 +2,9 @@
 
 #include "../ui_panel.hpp"
 
+#include "engine/assets/asset_snapshot.hpp"
+#include "engine/core/filesystem/directory_index.hpp"
+
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -45,6 +48,16 @@ public:
     // -------------------------------------------------------------------------
 
     void set_entries(std::vector<ResourceEntry> entries);
+
+    // Fill the entries with the children of current_path() from a shared
+    // DirectoryIndex (no directory walk). fullPath is absolute; a current
+    // path outside the index root shows the index root instead.
+    void refresh_from_index(const engine::core::filesystem::DirectoryIndex& index);
+
+    // Same from an AssetDatabase snapshot, through its directory index: cost
+    // depends on the size of the listing, not of the project. Only folders
+    // that contain assets are listed.
+    void refresh_from_snapshot(const engine::assets::AssetSnapshot& snapshot);
     const std::vector<ResourceEntry>& entries() const { return m_entries; }
 
     bool empty() const { return m_entries.empty(); }
@@ -0,0 +1,122 @@
+#include "artifact_cache.hpp"
+
+#include "engine/core/filesystem/file_system.hpp"
+#include "engine/core/utils/hash.hpp"
+
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace wave::engine::assets {
+
+namespace {
+
+// Artifact file: this header, then the payload. The header repeats the hash
+// so a file copied to the wrong name (or cut short on its way from another
+// machine) is treated as missing instead of served.
+static_assert(std::endian::native == std::endian::little, "artifact headers are read in place; little endian only");
+
+constexpr char          kArtifactMagic[4] = {'W', 'A', 'R', 'T'};
+constexpr std::uint32_t kArtifactVersion  = 1;
+
+struct ArtifactHeader {
+    char          magic[4];
+    std::uint32_t version;
+    std::uint64_t hashHi;
+    std::uint64_t hashLo;
+    std::uint64_t payloadSize;
+};
+
+static_assert(sizeof(ArtifactHeader) == 32);
+
+template <typename T>
+void append_raw(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+} // namespace
+
+std::string ArtifactHash::to_string() const {
+    char buf[33];
+    std::snprintf(buf, sizeof(buf), "%016llx%016llx", static_cast<unsigned long long>(hi),
+                  static_cast<unsigned long long>(lo));
+    return std::string(buf);
+}
+
+ArtifactHash ArtifactKey::hash() const {
+    // Fixed-size fields first and the name last, so distinct keys never
+    // serialize to the same bytes.
+    std::string bytes;
+    bytes.reserve(32 + importer.size());
+    append_raw(bytes, sourceHash);
+    append_raw(bytes, settingsHash);
+    append_raw(bytes, dependencyHash);
+    append_raw(bytes, importerVersion);
+    bytes.append(importer);
+
+    ArtifactHash hash;
+    hash.hi = core::utils::fnv1a_64(bytes);
+    hash.lo = core::utils::fnv1a_64(bytes, hash.hi ^ 0x9E3779B97F4A7C15ull);
+    return hash;
+}
+
+// -----------------------------------------------------------------------------
+// ArtifactCache
+// -----------------------------------------------------------------------------
+
+bool ArtifactCache::initialize(const fs::path& directory) {
+    m_directory = directory;
+    return core::filesystem::ensure_directory(m_directory);
+}
+
+fs::path ArtifactCache::path_of(const ArtifactHash& hash) const {
+    const std::string name = hash.to_string();
+    return m_directory / name.substr(0, 2) / (name + ".wart");
+}
+
+bool ArtifactCache::contains(const ArtifactHash& hash) const {
+    // Mapping is cheap and also rules out damaged files.
+    Artifact artifact;
+    return load(hash, artifact);
+}
+
+bool ArtifactCache::load(const ArtifactHash& hash, Artifact& out) const {
+    core::filesystem::MappedFile file;
+    if (!file.open(path_of(hash), core::filesystem::MapAccess::Sequential) || file.size() < sizeof(ArtifactHeader)) {
+        return false;
+    }
+
+    ArtifactHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, kArtifactMagic, sizeof(kArtifactMagic)) != 0 || header.version != kArtifactVersion ||
+        header.hashHi != hash.hi || header.hashLo != hash.lo ||
+        header.payloadSize != file.size() - sizeof(ArtifactHeader)) {
+        return false;
+    }
+
+    out.m_file    = std::move(file);
+    out.m_payload = out.m_file.bytes().subspan(sizeof(ArtifactHeader));
+    return true;
+}
+
+bool ArtifactCache::store(const ArtifactHash& hash, std::span<const std::uint8_t> bytes) const {
+    ArtifactHeader header{};
+    std::memcpy(header.magic, kArtifactMagic, sizeof(kArtifactMagic));
+    header.version     = kArtifactVersion;
+    header.hashHi      = hash.hi;
+    header.hashLo      = hash.lo;
+    header.payloadSize = bytes.size();
+
+    std::vector<std::uint8_t> file(sizeof(header) + bytes.size());
+    std::memcpy(file.data(), &header, sizeof(header));
+    if (!bytes.empty()) {
+        std::memcpy(file.data() + sizeof(header), bytes.data(), bytes.size());
+    }
+
+    // Not fsynced: a lost artifact is cooked again on the next miss.
+    return core::filesystem::write_file_atomic(path_of(hash), file, false);
+}
+
+} // namespace wave::engine::assets
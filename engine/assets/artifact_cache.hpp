@@ -0,0 +1,88 @@
+#pragma once
+
+#include "engine/core/filesystem/mapped_file.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace wave::engine::assets {
+
+namespace fs = std::filesystem;
+
+// 128-bit name of a cooked artifact; see ArtifactKey::hash().
+struct ArtifactHash {
+    std::uint64_t hi{0};
+    std::uint64_t lo{0};
+
+    bool valid() const { return hi != 0 || lo != 0; }
+
+    bool operator==(const ArtifactHash& other) const { return hi == other.hi && lo == other.lo; }
+    bool operator!=(const ArtifactHash& other) const { return !(*this == other); }
+
+    std::string to_string() const;
+};
+
+// Everything that determines the bytes of a cooked artifact. Two keys that
+// compare equal always cook to the same output, whichever asset, branch or
+// machine they came from, so the artifact is stored under hash() alone.
+struct ArtifactKey {
+    std::uint64_t    sourceHash{0};        // utils::fnv1a_64 of the source bytes
+    std::string_view importer;             // AssetImporter::name()
+    std::uint32_t    importerVersion{0};   // AssetImporter::version()
+    std::uint64_t    settingsHash{0};      // AssetImporter::settings_hash()
+    std::uint64_t    dependencyHash{0};    // contents of every file the source reads (DependencyGraph); 0 = none
+
+    ArtifactHash hash() const;
+};
+
+// A cooked artifact mapped from an ArtifactCache.
+class Artifact {
+public:
+    bool valid() const { return m_file.is_open(); }
+
+    std::span<const std::uint8_t> bytes() const { return m_payload; }
+
+private:
+    friend class ArtifactCache;
+
+    core::filesystem::MappedFile  m_file;
+    std::span<const std::uint8_t> m_payload;
+};
+
+// Content-addressed store of cooked artifacts:
+//
+//   <directory>/<first two hex digits>/<32 hex digits>.wart
+//
+// Entries are immutable and written with write-to-temp + rename, so any
+// number of threads, processes or machines can share one directory (e.g. a
+// network share): readers only ever see complete files, and two writers of
+// the same hash race to publish identical bytes. Nothing is ever evicted;
+// deleting the directory (or any part of it) is always safe.
+class ArtifactCache final {
+public:
+    ArtifactCache() = default;
+
+    ArtifactCache(const ArtifactCache&) = delete;
+    ArtifactCache& operator=(const ArtifactCache&) = delete;
+
+    // Creates the directory if needed. False if it cannot be created.
+    bool initialize(const fs::path& directory);
+
+    const fs::path& directory() const { return m_directory; }
+
+    fs::path path_of(const ArtifactHash& hash) const;
+
+    // Thread-safe; the cache keeps no state besides the directory.
+    bool contains(const ArtifactHash& hash) const;
+    bool load(const ArtifactHash& hash, Artifact& out) const;
+    bool store(const ArtifactHash& hash, std::span<const std::uint8_t> bytes) const;
+
+private:
+    fs::path m_directory;
+};
+
+} // namespace wave::engine::assets
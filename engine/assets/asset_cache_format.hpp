@@ -0,0 +1,83 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+namespace wave::engine::assets {
+
+// AssetDatabase cache file layout (little endian, version 2)
+//
+//   AssetCacheHeader                        88 bytes
+//   AssetCacheEntry[entryCount]             sorted by path
+//   AssetCacheDirectory[directoryCount]     sorted by path
+//   AssetCacheDependency[dependencyCount]   sorted by entry, then path
+//   names                                   relative paths, not NUL terminated
+//
+// Written by AssetDatabase::save_cache() and mapped read-only by
+// load_cache(); the tables are read in place. Paths are relative to the
+// asset root with '/' separators ("" is the root directory itself).
+//
+// Times are std::filesystem::file_clock ticks of the build that wrote the
+// file. The cache is a local, per-machine artifact and is simply rebuilt if
+// it does not match.
+
+static_assert(std::endian::native == std::endian::little, "asset cache is read in place; little endian only");
+
+inline constexpr char          kAssetCacheMagic[4] = {'W', 'A', 'D', 'B'};
+inline constexpr std::uint32_t kAssetCacheVersion  = 2;
+
+// AssetCacheEntry::flags
+inline constexpr std::uint8_t kAssetCacheNeedsReimport = 1u << 0;
+
+struct AssetCacheHeader {
+    char          magic[4];
+    std::uint32_t version;
+    std::uint32_t entryCount;
+    std::uint32_t directoryCount;
+    std::uint32_t dependencyCount;
+    std::uint32_t reserved;
+    std::uint64_t rootHash;            // utils::fnv1a_64 of the generic asset root
+    std::int64_t  scannedAt;           // file_clock ticks when the directory times were taken
+    std::uint64_t entriesOffset;
+    std::uint64_t directoriesOffset;
+    std::uint64_t dependenciesOffset;
+    std::uint64_t namesOffset;
+    std::uint64_t namesSize;
+    std::uint64_t fileSize;            // catches truncated files
+};
+
+struct AssetCacheEntry {
+    std::uint64_t idHi;
+    std::uint64_t idLo;
+    std::uint64_t fileSize;
+    std::int64_t  lastWrite;           // file_clock ticks
+    std::uint64_t contentHash;         // utils::fnv1a_64 of the bytes; 0 = not hashed yet
+    std::uint32_t nameOffset;          // into the names block
+    std::uint32_t nameSize;
+    std::uint8_t  type;                // AssetType
+    std::uint8_t  flags;
+    std::uint16_t reserved0;
+    std::uint32_t reserved1;
+};
+
+// Directory mtime as of the scan that produced the entries below it.
+struct AssetCacheDirectory {
+    std::int64_t  lastWrite;           // file_clock ticks
+    std::uint32_t nameOffset;
+    std::uint32_t nameSize;
+};
+
+// One edge of the DependencyGraph: entries[entryIndex] reads the path.
+struct AssetCacheDependency {
+    std::uint32_t entryIndex;
+    std::uint32_t nameOffset;
+    std::uint32_t nameSize;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(AssetCacheHeader) == 88);
+static_assert(sizeof(AssetCacheEntry) == 56);
+static_assert(sizeof(AssetCacheDirectory) == 16);
+static_assert(sizeof(AssetCacheDependency) == 16);
+
+} // namespace wave::engine::assets
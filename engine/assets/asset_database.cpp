@@ -1,101 +1,989 @@
 #include "asset_database.hpp"
+#include "asset_cache_format.hpp"
 
+#include "engine/core/filesystem/file_system.hpp"
+#include "engine/core/filesystem/mapped_file.hpp"
+#include "engine/core/jobs/job_system.hpp"
+#include "engine/core/utils/hash.hpp"
+
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <span>
+#include <thread>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/stat.h>
+#endif
 
 namespace wave::engine::assets {
 
+namespace {
+
+// Directories modified this close to (or after) the scan that recorded their
+// mtime may have changed again within the same timestamp tick, after being
+// listed; they are listed again rather than trusted.
+constexpr auto kRacyWindow = std::chrono::seconds(2);
+
+std::string_view parent_key(std::string_view key) {
+    const auto slash = key.find_last_of('/');
+    return slash == std::string_view::npos ? std::string_view() : key.substr(0, slash);
+}
+
+std::int64_t to_ticks(fs::file_time_type time) {
+    return static_cast<std::int64_t>(time.time_since_epoch().count());
+}
+
+fs::file_time_type from_ticks(std::int64_t ticks) {
+    return fs::file_time_type(fs::file_time_type::duration(ticks));
+}
+
+std::uint64_t root_hash(const fs::path& root) {
+    return core::utils::fnv1a_64(root.generic_string());
+}
+
+// Below this many directories in one depth level the scan stays on the
+// calling thread.
+constexpr std::size_t kParallelMinDirs = 8;
+
+// Size and mtime of a regular file from a directory listing; false for
+// anything else. The entry already knows its type from the listing (and on
+// Windows its size and mtime too). Elsewhere one stat() gets both, where
+// file_size() + last_write_time() would stat twice.
+bool file_stats(const fs::directory_entry& entry, std::uint64_t& size, fs::file_time_type& lastWrite) {
+    std::error_code ec;
+#if defined(__unix__) || defined(__APPLE__)
+    if (entry.is_directory(ec) || (!entry.is_symlink(ec) && !entry.is_regular_file(ec))) {
+        return false;
+    }
+
+    struct stat st {};
+    if (::stat(entry.path().c_str(), &st) != 0 || !S_ISREG(st.st_mode)) {
+        return false;
+    }
+
+    #if defined(__APPLE__)
+    const auto mtime = std::chrono::seconds(st.st_mtimespec.tv_sec) + std::chrono::nanoseconds(st.st_mtimespec.tv_nsec);
+    #else
+    const auto mtime = std::chrono::seconds(st.st_mtim.tv_sec) + std::chrono::nanoseconds(st.st_mtim.tv_nsec);
+    #endif
+
+    size      = static_cast<std::uint64_t>(st.st_size);
+    lastWrite = std::chrono::file_clock::from_sys(
+        std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(mtime)));
+    return true;
+#else
+    if (!entry.is_regular_file(ec)) {
+        return false;
+    }
+    size = entry.file_size(ec);
+    if (!ec) {
+        lastWrite = entry.last_write_time(ec);
+    }
+    return !ec;
+#endif
+}
+
+// 0 if the file cannot be read.
+std::uint64_t hash_file(const fs::path& path) {
+    core::filesystem::MappedFile file;
+    if (!file.open(path, core::filesystem::MapAccess::Sequential)) {
+        return 0;
+    }
+    return core::utils::fnv1a_64(file.text());
+}
+
+// References of the file at 'absPath' (none if its type has none, or it
+// cannot be read).
+void read_dependencies(const fs::path& absPath, std::string_view key, AssetType type, std::vector<std::string>& out) {
+    out.clear();
+    if (!has_dependencies(type)) {
+        return;
+    }
+
+    core::filesystem::MappedFile file;
+    if (file.open(absPath, core::filesystem::MapAccess::Sequential)) {
+        scan_dependencies(key, type, file.text(), out);
+    }
+}
+
+// Reader slot of the calling thread; threads are spread round-robin, so
+// slots are only shared once there are more threads than slots.
+std::size_t reader_index() {
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Snapshot publication
+// -----------------------------------------------------------------------------
+
+// Pins the current snapshot for one read. Writers are never blocked, only
+// delayed in publish() until sections that may still see the old snapshot
+// end; keep sections short.
+class AssetDatabase::ReadSection {
+public:
+    explicit ReadSection(const AssetDatabase& database) {
+        ReaderSlot& slot = database.m_readers[reader_index() % kReaderSlots];
+
+        // Announce on the current parity, then make sure it is still current;
+        // a publish() in between may not have seen the announcement.
+        for (;;) {
+            const std::uint64_t epoch = database.m_epoch.load();
+            m_count = &slot.count[epoch & 1];
+            m_count->fetch_add(1);
+            if (database.m_epoch.load() == epoch) {
+                break;
+            }
+            m_count->fetch_sub(1);
+        }
+
+        m_snapshot = database.m_current.load();
+    }
+
+    ~ReadSection() { m_count->fetch_sub(1, std::memory_order_release); }
+
+    ReadSection(const ReadSection&) = delete;
+    ReadSection& operator=(const ReadSection&) = delete;
+
+    const AssetSnapshot& snapshot() const { return *m_snapshot; }
+
+private:
+    std::atomic<std::uint32_t>* m_count{nullptr};
+    const AssetSnapshot*        m_snapshot{nullptr};
+};
+
+void AssetDatabase::publish() {
+    // Lock held (or not yet shared).
+    if (m_bulkScanActive) {
+        return;
+    }
+
+    if (m_graphChanged || !m_publishedGraph) {
+        m_publishedGraph = std::make_shared<const DependencyGraph>(m_graph);
+        m_graphChanged   = false;
+    }
+
+    m_table.sort_indexes();
+
+    // Journal what this version changed, before the copy (which would
+    // otherwise carry the list along).
+    ++m_version;
+    std::vector<AssetID> changed;
+    if (m_table.take_changes(changed)) {
+        for (const AssetID& id : changed) {
+            m_journal.emplace_back(m_version, id);
+        }
+        if (m_journal.size() > kMaxJournal) {
+            // Whole versions only, so changes_since() is never partial.
+            m_journalFloor = m_journal[m_journal.size() - kMaxJournal / 2].first;
+            while (!m_journal.empty() && m_journal.front().first <= m_journalFloor) {
+                m_journal.pop_front();
+            }
+        }
+    } else {
+        m_journal.clear();
+        m_journalFloor = m_version;
+    }
+
+    auto next = std::make_shared<const AssetSnapshot>(m_root, m_table, m_publishedGraph, m_version);
+    m_current.store(next.get());
+    std::shared_ptr<const AssetSnapshot> previous = std::exchange(m_published, std::move(next));
+
+    // Sections that entered on the old parity may hold the previous pointer;
+    // new ones enter on the new parity and load the new one.
+    const std::uint64_t epoch = m_epoch.fetch_add(1);
+    for (auto& slot : m_readers) {
+        while (slot.count[epoch & 1].load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    // 'previous' is released here, unless a snapshot() caller still holds it.
+}
+
 // -----------------------------------------------------------------------------
 // Initialization
 // -----------------------------------------------------------------------------
 
+AssetDatabase::AssetDatabase() {
+    publish();
+}
+
+AssetDatabase::~AssetDatabase() {
+    detach();
+}
+
 void AssetDatabase::initialize(const fs::path& assetRoot) {
+    std::scoped_lock lock(m_mutex);
     m_root = fs::weakly_canonical(assetRoot);
+    publish();
 }
 
 void AssetDatabase::build_initial_scan() {
+    std::unique_lock lock(m_mutex);
+
+    if (m_cacheLoaded) {
+        m_cacheLoaded = false;
+        validate_cached();
+        publish();
+        return;
+    }
+
+    begin_bulk_scan();
+    lock.unlock();
+
+    // One listing of one directory: its files as finished entries, and the
+    // subdirectories for the next level.
+    struct DirScan {
+        std::string              key;
+        fs::file_time_type       lastWrite{};
+        bool                     listed{false};
+        ScannedEntries           files;
+        std::vector<std::string> subdirs;
+    };
+
+    auto scanDirectory = [this](DirScan& scan) {
+        const fs::path absDir = scan.key.empty() ? m_root : m_root / scan.key;
+
+        std::error_code ec;
+        scan.lastWrite = fs::last_write_time(absDir, ec);
+        if (ec) {
+            return;
+        }
+
+        for (fs::directory_iterator it(absDir, ec), end; !ec && it != end; it.increment(ec)) {
+            const auto& entry = *it;
+            std::string key = scan.key.empty() ? entry.path().filename().generic_string()
+                                               : scan.key + '/' + entry.path().filename().generic_string();
+
+            std::error_code entryEc;
+            if (entry.is_directory(entryEc) && !entry.is_symlink(entryEc)) {
+                scan.subdirs.push_back(std::move(key));
+                continue;
+            }
+
+            std::uint64_t      size = 0;
+            fs::file_time_type lastWrite{};
+            if (file_stats(entry, size, lastWrite)) {
+                ScannedEntry& file = scan.files.emplace_back();
+                file.record = make_record(key, size, lastWrite);
+                read_dependencies(entry.path(), key, file.record.type, file.dependencies);
+                file.key = std::move(key);
+            }
+        }
+        scan.listed = !ec;
+    };
+
+    ScannedEntries entries;
+    std::unordered_map<std::string, fs::file_time_type> dirTimes;
+    const auto scannedAt = fs::file_time_type::clock::now();
+
+    std::error_code ec;
+    if (fs::is_directory(m_root, ec)) {
+        // Breadth first, one depth level at a time, the directories of a
+        // level listed in parallel.
+        const bool parallel = m_jobs && m_jobs->is_initialized();
+
+        std::vector<std::string> level{std::string()};
+        std::vector<DirScan>     scans;
+        while (!level.empty()) {
+            scans.clear();
+            scans.resize(level.size());
+            for (std::size_t i = 0; i < level.size(); ++i) {
+                scans[i].key = std::move(level[i]);
+            }
+
+            if (parallel && scans.size() >= kParallelMinDirs) {
+                m_jobs->parallel_for(0, static_cast<std::int32_t>(scans.size()), [&](std::int32_t i) {
+                    scanDirectory(scans[static_cast<std::size_t>(i)]);
+                }).wait();
+            } else {
+                for (auto& scan : scans) {
+                    scanDirectory(scan);
+                }
+            }
+
+            level.clear();
+            for (auto& scan : scans) {
+                if (scan.listed) {
+                    dirTimes.emplace(scan.key, scan.lastWrite);
+                }
+                std::move(scan.files.begin(), scan.files.end(), std::back_inserter(entries));
+                std::move(scan.subdirs.begin(), scan.subdirs.end(), std::back_inserter(level));
+            }
+        }
+    }
+
+    commit_bulk_scan(std::move(entries), std::move(dirTimes), scannedAt);
+}
+
+void AssetDatabase::build_initial_scan(const DirectoryIndex& index) {
+    const auto prefix = index.relative(m_root);
+    if (!prefix) {
+        build_initial_scan();
+        return;
+    }
+
+    std::unique_lock lock(m_mutex);
+
+    const std::size_t skip = prefix->empty() ? 0 : prefix->size() + 1;
+
+    if (!m_cacheLoaded) {
+        // Size and mtime come from the index; no stat per file. The index has
+        // no directory times to record, so the next walk lists everything.
+        begin_bulk_scan();
+        lock.unlock();
+
+        ScannedEntries entries;
+        entries.reserve(index.entry_count());
+        index.for_each_file(*prefix, [this, skip, &entries](const core::filesystem::DirectoryEntry& entry) {
+            ScannedEntry& file = entries.emplace_back();
+            file.key    = std::string(std::string_view(entry.relativePath).substr(skip));
+            file.record = make_record(file.key, entry.size, entry.lastWrite);
+            read_dependencies(m_root / file.key, file.key, file.record.type, file.dependencies);
+        });
+
+        commit_bulk_scan(std::move(entries), {}, {});
+        return;
+    }
+
+    // With a cache, entries are matched up by path so IDs and hashes carry
+    // over.
+    m_cacheLoaded = false;
+    m_dirTimes.clear();
+
+    std::vector<bool> seen(m_table.slot_count());
+    index.for_each_file(*prefix, [this, skip, &seen](const core::filesystem::DirectoryEntry& entry) {
+        const std::string key(std::string_view(entry.relativePath).substr(skip));
+        const Slot slot = refresh_entry(m_root / key, key, entry.size, entry.lastWrite);
+        if (slot >= seen.size()) {
+            seen.resize(slot + 1);
+        }
+        seen[slot] = true;
+    });
+
+    drop_missing(seen);
+    publish();
+}
+
+// -----------------------------------------------------------------------------
+// Persistent cache
+// -----------------------------------------------------------------------------
+
+bool AssetDatabase::load_cache(const fs::path& cacheFile, CacheValidation validation) {
+    core::filesystem::MappedFile file;
+    if (!file.open(cacheFile, core::filesystem::MapAccess::Sequential)) {
+        return false;
+    }
+
+    const std::uint8_t* base = file.data();
+    const std::uint64_t size = file.size();
+
+    if (size < sizeof(AssetCacheHeader)) {
+        return false;
+    }
+
+    AssetCacheHeader header;
+    std::memcpy(&header, base, sizeof(header));
+
+    if (std::memcmp(header.magic, kAssetCacheMagic, sizeof(kAssetCacheMagic)) != 0 ||
+        header.version != kAssetCacheVersion || header.fileSize != size || header.rootHash != root_hash(m_root)) {
+        return false;
+    }
+
+    const std::uint64_t entryBytes = std::uint64_t(header.entryCount) * sizeof(AssetCacheEntry);
+    const std::uint64_t dirBytes   = std::uint64_t(header.directoryCount) * sizeof(AssetCacheDirectory);
+    const std::uint64_t depBytes   = std::uint64_t(header.dependencyCount) * sizeof(AssetCacheDependency);
+    if (header.entriesOffset % alignof(AssetCacheEntry) != 0 ||
+        header.directoriesOffset % alignof(AssetCacheDirectory) != 0 ||
+        header.dependenciesOffset % alignof(AssetCacheDependency) != 0 ||
+        header.entriesOffset > size || entryBytes > size - header.entriesOffset ||
+        header.directoriesOffset > size || dirBytes > size - header.directoriesOffset ||
+        header.dependenciesOffset > size || depBytes > size - header.dependenciesOffset ||
+        header.namesOffset > size || header.namesSize > size - header.namesOffset) {
+        return false;
+    }
+
+    const std::span<const AssetCacheEntry> entries(
+        reinterpret_cast<const AssetCacheEntry*>(base + header.entriesOffset), header.entryCount);
+    const std::span<const AssetCacheDirectory> dirs(
+        reinterpret_cast<const AssetCacheDirectory*>(base + header.directoriesOffset), header.directoryCount);
+    const std::span<const AssetCacheDependency> deps(
+        reinterpret_cast<const AssetCacheDependency*>(base + header.dependenciesOffset), header.dependencyCount);
+    const std::string_view names(reinterpret_cast<const char*>(base + header.namesOffset),
+                                 static_cast<std::size_t>(header.namesSize));
+
+    auto name = [&names](std::uint32_t offset, std::uint32_t length, std::string_view& out) {
+        if (std::uint64_t(offset) + length > names.size()) {
+            return false;
+        }
+        out = names.substr(offset, length);
+        return true;
+    };
+
+    // Build everything before touching the database; a duplicate path or ID
+    // rejects the file like any other corruption.
+    AssetTable table;
+    table.reserve(entries.size());
+
+    for (const auto& entry : entries) {
+        std::string_view key;
+        if (!name(entry.nameOffset, entry.nameSize, key) || key.empty() ||
+            entry.type > static_cast<std::uint8_t>(AssetType::Folder)) {
+            return false;
+        }
+
+        AssetRecord record;
+        record.id            = AssetID{entry.idHi, entry.idLo};
+        record.type          = static_cast<AssetType>(entry.type);
+        record.fileSize      = entry.fileSize;
+        record.lastWriteTime = from_ticks(entry.lastWrite);
+        record.contentHash   = entry.contentHash;
+        record.needsReimport = (entry.flags & kAssetCacheNeedsReimport) != 0;
+
+        if (table.find(key) != AssetTable::kNone || table.find(record.id) != AssetTable::kNone) {
+            return false;
+        }
+        table.assign(key, record);
+    }
+
+    std::unordered_map<std::string, fs::file_time_type> dirTimes;
+    dirTimes.reserve(dirs.size());
+    for (const auto& dir : dirs) {
+        std::string_view key;
+        if (!name(dir.nameOffset, dir.nameSize, key)) {
+            return false;
+        }
+        dirTimes.emplace(std::string(key), from_ticks(dir.lastWrite));
+    }
+
+    // Edges arrive grouped by entry.
+    DependencyGraph graph;
+    std::vector<std::string> edges;
+    for (std::size_t i = 0; i < deps.size(); ++i) {
+        std::string_view key;
+        if (deps[i].entryIndex >= entries.size() || !name(deps[i].nameOffset, deps[i].nameSize, key) || key.empty()) {
+            return false;
+        }
+        edges.emplace_back(key);
+
+        const std::uint32_t entry = deps[i].entryIndex;
+        if (i + 1 == deps.size() || deps[i + 1].entryIndex != entry) {
+            graph.set(AssetID{entries[entry].idHi, entries[entry].idLo}, std::move(edges));
+            edges.clear();
+        }
+    }
+
     std::scoped_lock lock(m_mutex);
 
-    m_byPath.clear();
-    m_byIDhi.clear();
-    m_byIDlo.clear();
+    m_table           = std::move(table);
+    m_graph           = std::move(graph);
+    m_graphChanged    = true;
+    m_dirTimes        = std::move(dirTimes);
+    m_cacheLoaded     = true;
+    m_cacheValidation = validation;
+    m_scannedAt       = from_ticks(header.scannedAt);
+
+    publish();
+    return true;
+}
+
+bool AssetDatabase::save_cache(const fs::path& cacheFile) const {
+    std::vector<std::uint8_t> bytes;
+    {
+        std::scoped_lock lock(m_mutex);
+
+        std::vector<Slot> entries;
+        entries.reserve(m_table.size());
+        for (Slot slot = 0; slot < m_table.slot_count(); ++slot) {
+            if (m_table.alive(slot)) {
+                entries.push_back(slot);
+            }
+        }
+        std::sort(entries.begin(), entries.end(),
+                  [this](Slot a, Slot b) { return m_table.path(a) < m_table.path(b); });
+
+        std::vector<const std::pair<const std::string, fs::file_time_type>*> dirs;
+        dirs.reserve(m_dirTimes.size());
+        for (const auto& dir : m_dirTimes) {
+            dirs.push_back(&dir);
+        }
+        std::sort(dirs.begin(), dirs.end(), [](auto* a, auto* b) { return a->first < b->first; });
+
+        std::size_t depCount = 0;
+        for (Slot slot : entries) {
+            depCount += m_graph.dependencies_of(m_table.id(slot)).size();
+        }
+
+        std::string names;
+        auto intern = [&names](std::string_view key, std::uint32_t& offset, std::uint32_t& length) {
+            offset = static_cast<std::uint32_t>(names.size());
+            length = static_cast<std::uint32_t>(key.size());
+            names.append(key);
+        };
+
+        AssetCacheHeader header{};
+        std::memcpy(header.magic, kAssetCacheMagic, sizeof(kAssetCacheMagic));
+        header.version           = kAssetCacheVersion;
+        header.entryCount        = static_cast<std::uint32_t>(entries.size());
+        header.directoryCount    = static_cast<std::uint32_t>(dirs.size());
+        header.dependencyCount   = static_cast<std::uint32_t>(depCount);
+        header.rootHash          = root_hash(m_root);
+        header.scannedAt         = to_ticks(m_scannedAt);
+        header.entriesOffset     = sizeof(AssetCacheHeader);
+        header.directoriesOffset = header.entriesOffset + entries.size() * sizeof(AssetCacheEntry);
+        header.dependenciesOffset = header.directoriesOffset + dirs.size() * sizeof(AssetCacheDirectory);
+        header.namesOffset       = header.dependenciesOffset + depCount * sizeof(AssetCacheDependency);
+
+        std::vector<AssetCacheEntry> entryTable(entries.size());
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            const Slot slot = entries[i];
+            AssetCacheEntry& out = entryTable[i];
+            out.idHi        = m_table.id(slot).hi;
+            out.idLo        = m_table.id(slot).lo;
+            out.fileSize    = m_table.file_size(slot);
+            out.lastWrite   = to_ticks(m_table.last_write_time(slot));
+            out.contentHash = m_table.content_hash(slot);
+            out.type        = static_cast<std::uint8_t>(m_table.type(slot));
+            out.flags       = m_table.needs_reimport(slot) ? kAssetCacheNeedsReimport : 0;
+            intern(m_table.path(slot), out.nameOffset, out.nameSize);
+        }
+
+        std::vector<AssetCacheDirectory> dirTable(dirs.size());
+        for (std::size_t i = 0; i < dirs.size(); ++i) {
+            dirTable[i].lastWrite = to_ticks(dirs[i]->second);
+            intern(dirs[i]->first, dirTable[i].nameOffset, dirTable[i].nameSize);
+        }
+
+        std::vector<AssetCacheDependency> depTable;
+        depTable.reserve(depCount);
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            for (const std::string& path : m_graph.dependencies_of(m_table.id(entries[i]))) {
+                AssetCacheDependency& dep = depTable.emplace_back();
+                dep.entryIndex = static_cast<std::uint32_t>(i);
+                intern(path, dep.nameOffset, dep.nameSize);
+            }
+        }
+
+        header.namesSize = names.size();
+        header.fileSize  = header.namesOffset + names.size();
+
+        bytes.resize(static_cast<std::size_t>(header.fileSize));
+        // An empty table's data() may be null, which memcpy does not allow.
+        std::uint8_t* out = bytes.data();
+        auto put = [out](std::uint64_t offset, const void* data, std::size_t size) {
+            if (size != 0) {
+                std::memcpy(out + offset, data, size);
+            }
+        };
+        put(0, &header, sizeof(header));
+        put(header.entriesOffset, entryTable.data(), entryTable.size() * sizeof(AssetCacheEntry));
+        put(header.directoriesOffset, dirTable.data(), dirTable.size() * sizeof(AssetCacheDirectory));
+        put(header.dependenciesOffset, depTable.data(), depTable.size() * sizeof(AssetCacheDependency));
+        put(header.namesOffset, names.data(), names.size());
+    }
 
-    if (!fs::exists(m_root) || !fs::is_directory(m_root)) {
+    // Not fsynced: a cache lost in a crash is rebuilt by the next scan.
+    return core::filesystem::write_file_atomic(cacheFile, bytes, false);
+}
+
+void AssetDatabase::validate_cached() {
+    std::error_code ec;
+    if (!fs::is_directory(m_root, ec)) {
+        clear_entries();
         return;
     }
 
-    for (fs::recursive_directory_iterator it(m_root), end; it != end; it++) {
-        const auto& entry = *it;
+    // Cached files and directories by parent, for directories that are
+    // trusted rather than listed. Slots stay put until drop_missing().
+    std::unordered_map<std::string, std::vector<Slot>> cachedFiles;
+    std::unordered_map<std::string_view, std::vector<const std::string*>> cachedDirs;
+    for (Slot slot = 0; slot < m_table.slot_count(); ++slot) {
+        if (m_table.alive(slot)) {
+            cachedFiles[std::string(parent_key(m_table.path(slot)))].push_back(slot);
+        }
+    }
+    for (const auto& [key, lastWrite] : m_dirTimes) {
+        if (!key.empty()) {
+            cachedDirs[parent_key(key)].push_back(&key);
+        }
+    }
+
+    const auto scanStart = fs::file_time_type::clock::now();
+
+    std::unordered_map<std::string, fs::file_time_type> dirTimes;
+    std::vector<bool> seen(m_table.slot_count());
+    auto markSeen = [&seen](Slot slot) {
+        if (slot >= seen.size()) {
+            seen.resize(slot + 1);
+        }
+        seen[slot] = true;
+    };
+
+    std::vector<std::string> pending{std::string()};
+    while (!pending.empty()) {
+        const std::string dir = std::move(pending.back());
+        pending.pop_back();
+
+        const fs::path absDir = dir.empty() ? m_root : m_root / dir;
+        const auto lastWrite = fs::last_write_time(absDir, ec);
+        if (ec || !fs::is_directory(absDir, ec)) {
+            continue; // gone; whatever was cached below it is dropped
+        }
+        dirTimes[dir] = lastWrite;
 
-        if (!entry.is_regular_file()) {
+        const auto cached = m_dirTimes.find(dir);
+        const bool trusted = cached != m_dirTimes.end() && cached->second == lastWrite &&
+                             lastWrite + kRacyWindow < m_scannedAt;
+
+        if (trusted) {
+            if (auto it = cachedFiles.find(dir); it != cachedFiles.end()) {
+                for (Slot slot : it->second) {
+                    if (m_cacheValidation == CacheValidation::Files) {
+                        const std::string key(m_table.path(slot));
+                        const fs::path absPath = m_root / key;
+                        const auto size = fs::file_size(absPath, ec);
+                        const auto fileWrite = ec ? fs::file_time_type{} : fs::last_write_time(absPath, ec);
+                        if (ec) {
+                            continue; // gone or unreadable: dropped below
+                        }
+                        refresh_entry(absPath, key, size, fileWrite);
+                    }
+                    markSeen(slot);
+                }
+            }
+            if (auto it = cachedDirs.find(dir); it != cachedDirs.end()) {
+                for (const std::string* key : it->second) {
+                    pending.push_back(*key);
+                }
+            }
             continue;
         }
 
-        import_file(entry.path());
+        for (fs::directory_iterator it(absDir, ec), end; !ec && it != end; it.increment(ec)) {
+            const auto& entry = *it;
+            std::string key = dir.empty() ? entry.path().filename().generic_string()
+                                          : dir + '/' + entry.path().filename().generic_string();
+
+            std::error_code entryEc;
+            if (entry.is_directory(entryEc) && !entry.is_symlink(entryEc)) {
+                pending.push_back(std::move(key));
+            } else if (entry.is_regular_file(entryEc)) {
+                const auto size = entry.file_size(entryEc);
+                const auto fileWrite = entryEc ? fs::file_time_type{} : entry.last_write_time(entryEc);
+                if (!entryEc) {
+                    markSeen(refresh_entry(entry.path(), key, size, fileWrite));
+                }
+            }
+        }
+    }
+
+    // 'cachedDirs' points into m_dirTimes; done with it before replacing.
+    cachedDirs.clear();
+
+    m_dirTimes  = std::move(dirTimes);
+    m_scannedAt = scanStart;
+    drop_missing(seen);
+}
+
+AssetTable::Slot AssetDatabase::refresh_entry(const fs::path& absPath, const std::string& key, std::uint64_t size,
+                                              fs::file_time_type lastWrite) {
+    Slot slot = m_table.find(key);
+    if (slot == AssetTable::kNone) {
+        slot = add_entry(key, size, lastWrite);
+        update_dependencies(slot);
+        invalidate_dependents(key);
+        return slot;
+    }
+
+    if (m_table.file_size(slot) == size && m_table.last_write_time(slot) == lastWrite) {
+        return slot;
+    }
+
+    // Touched but identical (checkouts, copies) does not need a reimport.
+    AssetRecord record = m_table.record(slot);
+    const std::uint64_t hash = hash_file(absPath);
+    const bool changed = hash == 0 || record.contentHash != hash;
+    if (changed) {
+        record.needsReimport = true;
+    }
+    record.fileSize      = size;
+    record.lastWriteTime = lastWrite;
+    record.contentHash   = hash;
+    m_table.assign(key, record);
+
+    if (changed) {
+        update_dependencies(slot);
+        invalidate_dependents(key);
+    }
+    return slot;
+}
+
+void AssetDatabase::drop_missing(const std::vector<bool>& keep) {
+    std::vector<std::string> dropped;
+    for (Slot slot = 0; slot < m_table.slot_count(); ++slot) {
+        if (m_table.alive(slot) && (slot >= keep.size() || !keep[slot])) {
+            dropped.emplace_back(m_table.path(slot));
+            m_graph.remove(m_table.id(slot));
+            m_graphChanged = true;
+            m_table.erase(slot);
+        }
+    }
+
+    for (const auto& key : dropped) {
+        invalidate_dependents(key);
     }
 }
 
+void AssetDatabase::attach(DirectoryIndex& index) {
+    detach();
+
+    {
+        std::scoped_lock lock(m_mutex);
+        m_attaching = true;
+        m_attachEvents.clear();
+    }
+
+    m_index = &index;
+    m_subscription = index.subscribe([this](const std::vector<core::filesystem::FileChangeEvent>& events) {
+        on_index_events(events);
+    });
+
+    build_initial_scan(index);
+
+    // Replayed under the same lock the next batch needs, so order holds.
+    // Changes the scan already saw are applied again, which at worst flags
+    // an unchanged asset for a reimport that hits the artifact cache.
+    std::scoped_lock lock(m_mutex);
+    m_attaching = false;
+    if (!m_attachEvents.empty()) {
+        apply_index_events(m_attachEvents);
+        m_attachEvents.clear();
+        publish();
+    }
+}
+
+void AssetDatabase::detach() {
+    if (!m_index) {
+        return;
+    }
+
+    m_index->unsubscribe(m_subscription);
+    m_index = nullptr;
+    m_subscription = 0;
+}
+
+void AssetDatabase::on_index_events(const std::vector<core::filesystem::FileChangeEvent>& events) {
+    // One lock and one published snapshot per batch.
+    std::scoped_lock lock(m_mutex);
+
+    if (m_attaching) {
+        m_attachEvents.insert(m_attachEvents.end(), events.begin(), events.end());
+        return;
+    }
+
+    apply_index_events(events);
+    publish();
+}
+
+void AssetDatabase::apply_index_events(const std::vector<core::filesystem::FileChangeEvent>& events) {
+    using core::filesystem::FileChangeType;
+
+    for (const auto& event : events) {
+        switch (event.type) {
+            case FileChangeType::Created:
+                if (under_root(event.path)) on_created(event.path);
+                break;
+            case FileChangeType::Modified:
+                if (under_root(event.path)) on_modified(event.path);
+                break;
+            case FileChangeType::Erased:
+                if (under_root(event.path)) on_erased(event.path);
+                break;
+            case FileChangeType::Renamed:
+                if (under_root(event.oldPath) && under_root(event.path)) {
+                    on_renamed(event.oldPath, event.path);
+                } else if (under_root(event.oldPath)) {
+                    on_erased(event.oldPath);
+                } else if (under_root(event.path)) {
+                    on_created(event.path);
+                }
+                break;
+        }
+    }
+}
+
+bool AssetDatabase::under_root(const fs::path& path) const {
+    const auto rel = path.lexically_relative(m_root);
+    return !rel.empty() && *rel.begin() != "..";
+}
+
 // -----------------------------------------------------------------------------
 // Helpers
 // -----------------------------------------------------------------------------
 
-AssetType AssetDatabase::detect_type_from_extension(const fs::path& p) const {
-    const auto ext = p.extension().string();
+AssetRecord AssetDatabase::make_record(std::string_view key, std::uint64_t size, fs::file_time_type lastWrite) const {
+    AssetRecord record;
+    record.id            = AssetID::from_path(key);
+    record.type          = asset_type_from_path(key);
+    record.fileSize      = size;
+    record.lastWriteTime = lastWrite;
+    return record;
+}
+
+void AssetDatabase::begin_bulk_scan() {
+    // Lock held. Readers keep the last published state until the commit.
+    clear_entries();
+    m_bulkScanActive = true;
+    m_bulkScanTouched.clear();
+}
+
+void AssetDatabase::commit_bulk_scan(ScannedEntries entries,
+                                     std::unordered_map<std::string, fs::file_time_type> dirTimes,
+                                     fs::file_time_type scannedAt) {
+    AssetTable      table;
+    DependencyGraph graph;
+    table.reserve(entries.size());
+    for (auto& [key, record, dependencies] : entries) {
+        if (table.find(record.id) != AssetTable::kNone) {
+            record.id = AssetID::generate();
+        }
+        table.assign(key, record);
+        graph.set(record.id, std::move(dependencies));
+    }
+    entries.clear();
+
+    std::scoped_lock lock(m_mutex);
+
+    // Events that arrived during the scan describe newer state.
+    for (const auto& key : m_bulkScanTouched) {
+        const Slot scanned = table.find(key);
+        const Slot live    = m_table.find(key);
+
+        if (scanned != AssetTable::kNone) {
+            graph.remove(table.id(scanned));
+        }
+
+        if (live == AssetTable::kNone) {
+            if (scanned != AssetTable::kNone) {
+                table.erase(scanned);
+            }
+            continue;
+        }
+
+        AssetRecord record = m_table.record(live);
+        const Slot owner = table.find(record.id);
+        if (owner != AssetTable::kNone && owner != scanned) {
+            record.id = AssetID::generate();
+        }
+        table.assign(key, record);
+
+        const auto liveDependencies = m_graph.dependencies_of(m_table.id(live));
+        graph.set(record.id, std::vector<std::string>(liveDependencies.begin(), liveDependencies.end()));
+    }
 
-    if (ext == ".png" || ext == ".jpg" || ext == ".jpeg") return AssetType::Texture;
-    if (ext == ".obj" || ext == ".fbx" || ext == ".gltf") return AssetType::Mesh;
-    if (ext == ".mat") return AssetType::Material;
-    if (ext == ".vert" || ext == ".frag" || ext == ".comp") return AssetType::Shader;
-    if (ext == ".scene") return AssetType::Scene;
-    if (ext == ".cfg") return AssetType::Config;
+    m_table          = std::move(table);
+    m_graph          = std::move(graph);
+    m_graphChanged   = true;
+    m_dirTimes       = std::move(dirTimes);
+    m_scannedAt      = scannedAt;
+    m_bulkScanActive = false;
+    m_bulkScanTouched.clear();
 
-    return AssetType::Unknown;
+    publish();
 }
 
-void AssetDatabase::import_file(const fs::path& absPath) {
-    if (!fs::exists(absPath) || !fs::is_regular_file(absPath)) {
-        return;
+void AssetDatabase::note_change(const fs::path& absPath) {
+    // Lock held.
+    if (m_bulkScanActive) {
+        m_bulkScanTouched.insert(key_of(absPath));
     }
+}
 
-    const fs::path rel = fs::relative(absPath, m_root);
-    const std::string key = rel.generic_string();
+std::string AssetDatabase::key_of(const fs::path& absPath) const {
+    return fs::relative(absPath, m_root).generic_string();
+}
 
-    AssetMetadata meta;
-    meta.id = AssetID::generate();
-    meta.absolutePath = absPath;
-    meta.relativePath = rel;
+AssetTable::Slot AssetDatabase::import_file(const fs::path& absPath) {
+    if (!fs::exists(absPath) || !fs::is_regular_file(absPath)) {
+        return AssetTable::kNone;
+    }
 
     std::error_code ec;
-    meta.fileSize = fs::file_size(absPath, ec);
-    meta.lastWriteTime = fs::last_write_time(absPath, ec);
+    const auto size = fs::file_size(absPath, ec);
+    const auto lastWrite = fs::last_write_time(absPath, ec);
 
-    meta.type = detect_type_from_extension(absPath);
+    return add_entry(key_of(absPath), size, lastWrite);
+}
 
-    auto it = m_byPath.find(key);
-    if (it != m_byPath.end()) {
-        it->second = meta;
-    } else {
-        m_byPath.emplace(key, meta);
+AssetTable::Slot AssetDatabase::add_entry(const std::string& key, std::uint64_t size, fs::file_time_type lastWrite) {
+    // A path that is already known keeps its ID across reimports; a new one
+    // gets its path hash unless another asset (renamed away from this path)
+    // already holds it.
+    AssetRecord record = make_record(key, size, lastWrite);
+
+    const Slot existing = m_table.find(key);
+    if (existing != AssetTable::kNone) {
+        // The old hash only describes the file while it looks unchanged
+        // (importers key artifacts on it); otherwise it is rehashed later.
+        const bool same = m_table.file_size(existing) == size && m_table.last_write_time(existing) == lastWrite;
+        record.id            = m_table.id(existing);
+        record.contentHash   = same ? m_table.content_hash(existing) : 0;
+        record.needsReimport = m_table.needs_reimport(existing) || !same;
+    } else if (m_table.find(record.id) != AssetTable::kNone) {
+        record.id = AssetID::generate();
     }
 
-    auto& stored = m_byPath[key];
-    m_byIDhi[stored.id.hi] = &stored;
-    m_byIDlo[stored.id.lo] = &stored;
+    return m_table.assign(key, record);
+}
+
+void AssetDatabase::clear_entries() {
+    m_table.clear();
+    m_graph.clear();
+    m_graphChanged = true;
+    m_dirTimes.clear();
 }
 
 void AssetDatabase::remove_entry(const fs::path& absPath) {
-    const fs::path rel = fs::relative(absPath, m_root);
-    const std::string key = rel.generic_string();
+    const Slot slot = m_table.find(key_of(absPath));
+    if (slot != AssetTable::kNone) {
+        m_graph.remove(m_table.id(slot));
+        m_graphChanged = true;
+        m_table.erase(slot);
+    }
+}
 
-    auto it = m_byPath.find(key);
-    if (it == m_byPath.end()) {
-        return;
+void AssetDatabase::update_dependencies(Slot slot) {
+    const std::string_view key = m_table.path(slot);
+    const AssetType        type = m_table.type(slot);
+
+    std::vector<std::string> dependencies;
+    read_dependencies(m_root / key, key, type, dependencies);
+
+    if (dependencies.empty() && m_graph.dependencies_of(m_table.id(slot)).empty()) {
+        return; // the common case: a texture, mesh, ...
     }
+    m_graph.set(m_table.id(slot), std::move(dependencies));
+    m_graphChanged = true;
+}
 
-    const auto& meta = it->second;
-    m_byIDhi.erase(meta.id.hi);
-    m_byIDlo.erase(meta.id.lo);
+void AssetDatabase::invalidate_dependents(std::string_view path) {
+    std::vector<Slot> dependents;
+    m_graph.collect_dependents(path, m_table, dependents);
 
-    m_byPath.erase(it);
+    for (Slot slot : dependents) {
+        if (!m_table.needs_reimport(slot)) {
+            AssetRecord record = m_table.record(slot);
+            record.needsReimport = true;
+            m_table.assign(m_table.path(slot), record);
+        }
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -104,27 +992,123 @@ void AssetDatabase::remove_entry(const fs::path& absPath) {
 
 void AssetDatabase::handle_file_created(const fs::path& path) {
     std::scoped_lock lock(m_mutex);
-    import_file(path);
+    on_created(path);
+    publish();
 }
 
 void AssetDatabase::handle_file_modified(const fs::path& path) {
     std::scoped_lock lock(m_mutex);
+    on_modified(path);
+    publish();
+}
 
-    const fs::path rel = fs::relative(path, m_root);
-    const std::string key = rel.generic_string();
+void AssetDatabase::handle_file_erased(const fs::path& path) {
+    std::scoped_lock lock(m_mutex);
+    on_erased(path);
+    publish();
+}
 
-    auto it = m_byPath.find(key);
-    if (it == m_byPath.end()) {
-        import_file(path);
-    } else {
-        import_file(path);
-        it->second.needsReimport = true;
-    }
+void AssetDatabase::handle_file_renamed(const fs::path& oldPath, const fs::path& newPath) {
+    std::scoped_lock lock(m_mutex);
+    on_renamed(oldPath, newPath);
+    publish();
 }
 
-void AssetDatabase::handle_file_erased(const fs::path& path) {
+void AssetDatabase::mark_imported(std::span<const std::pair<AssetID, std::uint64_t>> imported) {
     std::scoped_lock lock(m_mutex);
+
+    for (const auto& [id, contentHash] : imported) {
+        const Slot slot = m_table.find(id);
+        if (slot == AssetTable::kNone) {
+            continue;
+        }
+
+        // 0 = not hashed since the scan; the importer's hash is the first one.
+        AssetRecord record = m_table.record(slot);
+        if (record.contentHash != 0 && record.contentHash != contentHash) {
+            continue;
+        }
+        record.needsReimport = false;
+        record.contentHash   = contentHash;
+        m_table.assign(m_table.path(slot), record);
+    }
+
+    publish();
+}
+
+void AssetDatabase::on_created(const fs::path& path) {
+    note_change(path);
+
+    if (const Slot slot = import_file(path); slot != AssetTable::kNone) {
+        update_dependencies(slot);
+        invalidate_dependents(m_table.path(slot));
+    }
+}
+
+void AssetDatabase::on_modified(const fs::path& path) {
+    note_change(path);
+
+    const std::string key = key_of(path);
+    const bool known = m_table.find(key) != AssetTable::kNone;
+
+    const Slot slot = import_file(path);
+    if (slot == AssetTable::kNone) {
+        return;
+    }
+
+    if (known) {
+        AssetRecord record = m_table.record(slot);
+        record.needsReimport = true;
+
+        // Freshly written, so still in the page cache.
+        record.contentHash = hash_file(path);
+        m_table.assign(key, record);
+    }
+
+    update_dependencies(slot);
+    invalidate_dependents(key);
+}
+
+void AssetDatabase::on_erased(const fs::path& path) {
+    note_change(path);
     remove_entry(path);
+    invalidate_dependents(key_of(path));
+}
+
+void AssetDatabase::on_renamed(const fs::path& oldPath, const fs::path& newPath) {
+    note_change(oldPath);
+    note_change(newPath);
+
+    const std::string oldKey = key_of(oldPath);
+    const std::string newKey = key_of(newPath);
+
+    const Slot slot = m_table.find(oldKey);
+    if (slot == AssetTable::kNone) {
+        if (const Slot created = import_file(newPath); created != AssetTable::kNone) {
+            update_dependencies(created);
+        }
+        invalidate_dependents(newKey);
+        return;
+    }
+
+    if (newKey == oldKey) {
+        return;
+    }
+
+    // Whatever was at the destination has been replaced.
+    remove_entry(newPath);
+
+    m_table.rename(slot, newKey);
+
+    AssetRecord record = m_table.record(slot);
+    record.type = asset_type_from_path(newKey);
+    m_table.assign(newKey, record);
+
+    // Includes resolve against the new directory. References name paths,
+    // so whatever read either path is affected.
+    update_dependencies(slot);
+    invalidate_dependents(oldKey);
+    invalidate_dependents(newKey);
 }
 
 // -----------------------------------------------------------------------------
@@ -132,50 +1116,44 @@ void AssetDatabase::handle_file_erased(const fs::path& path) {
 // -----------------------------------------------------------------------------
 
 bool AssetDatabase::has(const fs::path& relativePath) const {
-    std::scoped_lock lock(m_mutex);
-    return m_byPath.count(relativePath.generic_string()) > 0;
-}
-
-const AssetMetadata* AssetDatabase::get_by_path(const fs::path& relativePath) const {
-    std::scoped_lock lock(m_mutex);
-    auto it = m_byPath.find(relativePath.generic_string());
-    return it != m_byPath.end() ? &it->second : nullptr;
+    ReadSection read(*this);
+    return static_cast<bool>(read.snapshot().find(relativePath.generic_string()));
 }
 
-AssetMetadata* AssetDatabase::get_by_path(const fs::path& relativePath) {
-    std::scoped_lock lock(m_mutex);
-    auto it = m_byPath.find(relativePath.generic_string());
-    return it != m_byPath.end() ? &it->second : nullptr;
+std::optional<AssetMetadata> AssetDatabase::get_by_path(const fs::path& relativePath) const {
+    ReadSection read(*this);
+    if (const AssetRef asset = read.snapshot().find(relativePath.generic_string())) {
+        return asset.metadata();
+    }
+    return std::nullopt;
 }
 
-const AssetMetadata* AssetDatabase::get_by_id(const AssetID& id) const {
-    std::scoped_lock lock(m_mutex);
-
-    auto it = m_byIDhi.find(id.hi);
-    if (it == m_byIDhi.end()) return nullptr;
-    AssetMetadata* meta = it->second;
-    return meta && meta->id.lo == id.lo ? meta : nullptr;
+std::optional<AssetMetadata> AssetDatabase::get_by_id(const AssetID& id) const {
+    ReadSection read(*this);
+    if (const AssetRef asset = read.snapshot().find(id)) {
+        return asset.metadata();
+    }
+    return std::nullopt;
 }
 
-AssetMetadata* AssetDatabase::get_by_id(const AssetID& id) {
-    std::scoped_lock lock(m_mutex);
-
-    auto it = m_byIDhi.find(id.hi);
-    if (it == m_byIDhi.end()) return nullptr;
-    AssetMetadata* meta = it->second;
-    return meta && meta->id.lo == id.lo ? meta : nullptr;
+std::shared_ptr<const AssetSnapshot> AssetDatabase::snapshot() const {
+    ReadSection read(*this);
+    return read.snapshot().shared_from_this();
 }
 
-std::vector<const AssetMetadata*> AssetDatabase::all() const {
+bool AssetDatabase::changes_since(std::uint64_t version, std::vector<AssetID>& out) const {
     std::scoped_lock lock(m_mutex);
-    std::vector<const AssetMetadata*> out;
-    out.reserve(m_byPath.size());
-
-    for (const auto& [_, meta] : m_byPath) {
-        out.push_back(&meta);
+    if (version < m_journalFloor) {
+        return false;
     }
 
-    return out;
+    // Versions only grow along the journal.
+    auto first = std::upper_bound(m_journal.begin(), m_journal.end(), version,
+                                  [](std::uint64_t v, const auto& entry) { return v < entry.first; });
+    for (; first != m_journal.end(); ++first) {
+        out.push_back(first->second);
+    }
+    return true;
 }
 
 } // namespace wave::engine::assets
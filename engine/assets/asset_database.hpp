@@ -1,22 +1,45 @@
 #pragma once
 
 #include "asset_metadata.hpp"
+#include "asset_snapshot.hpp"
+#include "asset_table.hpp"
+#include "dependency_graph.hpp"
 
+#include "engine/core/filesystem/directory_index.hpp"
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <filesystem>
 #include <mutex>
 
+namespace wave::engine::core::jobs {
+class JobSystem;
+}
+
 namespace wave::engine::assets {
 
 namespace fs = std::filesystem;
 
+using core::filesystem::DirectoryIndex;
+
 // Central registry of all assets under the asset root.
 // Integrates with FileWatcher + JobSystem externally.
+//
+// Writers (scans, change events) serialize on a mutex and publish an
+// immutable AssetSnapshot after each batch. Readers never lock: lookups and
+// snapshot() go through an epoch-protected pointer to the current snapshot.
 class AssetDatabase final {
 public:
-    AssetDatabase() = default;
-    ~AssetDatabase() = default;
+    AssetDatabase();
+    ~AssetDatabase();
 
     AssetDatabase(const AssetDatabase&) = delete;
     AssetDatabase& operator=(const AssetDatabase&) = delete;
@@ -29,40 +52,215 @@ public:
 
     const fs::path& root() const { return m_root; }
 
-    // Populate database from disk on startup.
+    // Initial scans list directories (and build their entries) on this
+    // JobSystem's workers; null = serial. Must outlive the database or be
+    // reset.
+    void set_job_system(core::jobs::JobSystem* jobs) { m_jobs = jobs; }
+
+    // Persistent cache ---------------------------------------------------------
+    //
+    // save_cache() writes every entry (path, AssetID, size, mtime, content
+    // hash) plus the mtime of each directory as of the last scan to one
+    // binary file (see asset_cache_format.hpp). load_cache() maps it back in
+    // and the next build_initial_scan() validates against disk instead of
+    // starting over: IDs stay the same across runs, and directories whose
+    // mtime is unchanged are not listed at all.
+    //
+    // Adding, removing or renaming a file changes its directory's mtime;
+    // editing one in place does not. CacheValidation::Files additionally
+    // stats every cached file in unchanged directories to catch those.
+    enum class CacheValidation {
+        Directories,
+        Files
+    };
+
+    // False (database untouched) if the file is missing, corrupt, from
+    // another version or for another asset root.
+    bool load_cache(const fs::path& cacheFile, CacheValidation validation = CacheValidation::Directories);
+    bool save_cache(const fs::path& cacheFile) const;
+
+    // Populate database from disk on startup. After load_cache() only what
+    // changed since the cache was written is looked at; files whose size or
+    // mtime changed are hashed and flagged needsReimport if the contents
+    // differ.
+    //
+    // Without a cache the tree is walked one depth level at a time, each
+    // level's directories split across the JobSystem, and the result is
+    // swapped in at the end: the database lock is only held to clear and
+    // to merge, so change events and lookups are not stalled by the walk.
     void build_initial_scan();
 
+    // Same, from a shared DirectoryIndex instead of walking the tree again.
+    // Falls back to the walk if the asset root is not under the index root.
+    void build_initial_scan(const DirectoryIndex& index);
+
+    // Initial scan from 'index', then keep up to date from its change
+    // events. Subscribes before scanning: events delivered by a concurrent
+    // index.refresh() are held back until the scan has committed, then
+    // applied. The index must outlive the database or be detached first.
+    void attach(DirectoryIndex& index);
+    void detach();
+
     // Update metadata after file watcher events.
+    //
+    // Materials, scenes and shaders are also read for references (see
+    // DependencyGraph) whenever they are scanned or change; the graph is
+    // saved with the cache. A change to any path (edit, create, erase,
+    // rename) sets needsReimport on every asset that depends on it,
+    // transitively, and on nothing else. Query the graph through
+    // snapshot()->dependencies().
     void handle_file_created(const fs::path& path);
     void handle_file_modified(const fs::path& path);
     void handle_file_erased(const fs::path& path);
 
+    // Moves the entry, keeping its AssetID.
+    void handle_file_renamed(const fs::path& oldPath, const fs::path& newPath);
+
+    // Clears needsReimport for each (id, content hash the import was made
+    // from), unless the asset's contents have changed since. One publish for
+    // the whole batch (see ImportPipeline).
+    void mark_imported(std::span<const std::pair<AssetID, std::uint64_t>> imported);
+
     // Access -------------------------------------------------------------------
+    //
+    // Lock-free; safe from any thread, including while events are applied.
+    // Single lookups copy the metadata out. For many lookups, or to iterate,
+    // hold a snapshot() instead: it stays unchanged while held. Queries by
+    // type, extension and directory are indexed on the snapshot (of_type(),
+    // with_extension(), in_directory(), under()).
 
     bool has(const fs::path& relativePath) const;
 
-    const AssetMetadata* get_by_path(const fs::path& relativePath) const;
-          AssetMetadata* get_by_path(const fs::path& relativePath);
+    std::optional<AssetMetadata> get_by_path(const fs::path& relativePath) const;
+    std::optional<AssetMetadata> get_by_id(const AssetID& id) const;
 
-    const AssetMetadata* get_by_id(const AssetID& id) const;
-          AssetMetadata* get_by_id(const AssetID& id);
+    std::shared_ptr<const AssetSnapshot> snapshot() const;
 
-    std::vector<const AssetMetadata*> all() const;
+    // Appends the IDs of the assets added, changed (including their flags),
+    // renamed or removed after the snapshot with 'version' to 'out', so a
+    // consumer can look at just those; an ID may repeat. False if that is
+    // no longer known (too far back, or the table was rebuilt by a scan or
+    // load_cache() since): look at the whole snapshot instead.
+    bool changes_since(std::uint64_t version, std::vector<AssetID>& out) const;
 
 private:
-    void import_file(const fs::path& absPath);
-    void remove_entry(const fs::path& absPath);
+    using Slot = AssetTable::Slot;
+
+    // Bulk result of a cold scan: entries keyed by relative path, plus the
+    // directory times the walk saw.
+    struct ScannedEntry {
+        std::string              key;
+        AssetRecord              record;
+        std::vector<std::string> dependencies;
+    };
+    using ScannedEntries = std::vector<ScannedEntry>;
+
+    AssetRecord make_record(std::string_view key, std::uint64_t size, fs::file_time_type lastWrite) const;
+    void        begin_bulk_scan();
+    void        commit_bulk_scan(ScannedEntries entries, std::unordered_map<std::string, fs::file_time_type> dirTimes,
+                                 fs::file_time_type scannedAt);
+    void        note_change(const fs::path& absPath);
+
+    // Lock held for everything below, down to under_root().
+    std::string key_of(const fs::path& absPath) const;
+    Slot        import_file(const fs::path& absPath);   // kNone if not a regular file
+    Slot        add_entry(const std::string& key, std::uint64_t size, fs::file_time_type lastWrite);
+    void        remove_entry(const fs::path& absPath);
+    void        clear_entries();
+
+    // Re-reads the references of the asset in 'slot'.
+    void update_dependencies(Slot slot);
+    // Flags everything that depends on 'path' for reimport.
+    void invalidate_dependents(std::string_view path);
+
+    void on_created(const fs::path& path);
+    void on_modified(const fs::path& path);
+    void on_erased(const fs::path& path);
+    void on_renamed(const fs::path& oldPath, const fs::path& newPath);
+
+    // Warm start: bring cached entries up to date with disk.
+    void validate_cached();
+    Slot refresh_entry(const fs::path& absPath, const std::string& key, std::uint64_t size,
+                       fs::file_time_type lastWrite);
+    void drop_missing(const std::vector<bool>& keep);
 
-    AssetType detect_type_from_extension(const fs::path& p) const;
+    void apply_index_events(const std::vector<core::filesystem::FileChangeEvent>& events);
+    bool under_root(const fs::path& path) const;
+
+    // DirectoryIndex listener; takes the lock.
+    void on_index_events(const std::vector<core::filesystem::FileChangeEvent>& events);
+
+    // Sorts the table's ordered indexes, copies m_table (and m_graph, if it
+    // changed) into a new snapshot, makes it current and waits out readers
+    // of the previous one. Skipped while a bulk scan runs, so readers keep
+    // the last complete state until it commits.
+    void publish();
+
+    // Reader registration for publish()'s grace period. A reader bumps the
+    // counter for the current epoch's parity in its thread's slot; publish()
+    // flips the epoch and waits for the old parity to drain in every slot.
+    static constexpr std::size_t kReaderSlots = 64;
+
+    struct alignas(64) ReaderSlot {
+        std::atomic<std::uint32_t> count[2]{};
+    };
+
+    class ReadSection;
 
 private:
     fs::path m_root;
 
-    std::unordered_map<std::string, AssetMetadata> m_byPath; // key: relative path string
-    std::unordered_map<std::uint64_t, AssetMetadata*> m_byIDhi; // hi part lookup
-    std::unordered_map<std::uint64_t, AssetMetadata*> m_byIDlo; // lo part lookup
+    // Writer-side state; readers see copies of it through m_current.
+    AssetTable      m_table;
+    DependencyGraph m_graph;
+    bool            m_graphChanged{false};
+
+    // Last copy of m_graph handed to a snapshot.
+    std::shared_ptr<const DependencyGraph> m_publishedGraph;
+
+    // Version of the last published snapshot, and (version, ID) for each
+    // change published since m_journalFloor, oldest first. Bounded: old
+    // entries are dropped and the floor raised.
+    static constexpr std::size_t kMaxJournal = 1u << 16;
+
+    std::uint64_t                                 m_version{0};
+    std::uint64_t                                 m_journalFloor{0};
+    std::deque<std::pair<std::uint64_t, AssetID>> m_journal;
+
+    mutable std::array<ReaderSlot, kReaderSlots> m_readers{};
+    std::atomic<std::uint64_t>                   m_epoch{0};
+    std::atomic<const AssetSnapshot*>            m_current{nullptr};
+    std::shared_ptr<const AssetSnapshot>         m_published;   // owns *m_current
+
+    // Directory (relative, "" = root) -> mtime when it was last listed.
+    // Only filled by full walks; a missing or stale time just means the
+    // directory is listed again on the next warm start.
+    std::unordered_map<std::string, fs::file_time_type> m_dirTimes;
+
+    // When the walk that recorded m_dirTimes started.
+    fs::file_time_type m_scannedAt{};
+
+    // Set by load_cache() until build_initial_scan() consumes it.
+    bool            m_cacheLoaded{false};
+    CacheValidation m_cacheValidation{CacheValidation::Directories};
+
+    // Paths changed by events while a bulk scan runs unlocked; their live
+    // state wins over what the scan saw.
+    bool                            m_bulkScanActive{false};
+    std::unordered_set<std::string> m_bulkScanTouched;
+
+    core::jobs::JobSystem* m_jobs{nullptr};
 
     mutable std::mutex m_mutex;
+
+    DirectoryIndex*              m_index{nullptr};
+    DirectoryIndex::Subscription m_subscription{0};
+
+    // Index events that arrive while attach() is scanning; applied once the
+    // scan has committed, so nothing between the scan and the subscription
+    // is lost.
+    bool                                           m_attaching{false};
+    std::vector<core::filesystem::FileChangeEvent> m_attachEvents;
 };
 
 } // namespace wave::engine::assets
@@ -1,7 +1,10 @@
 #pragma once
 
+#include "engine/core/utils/hash.hpp"
+
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <random>
 
 namespace wave::engine::assets {
@@ -32,6 +35,16 @@ struct AssetID {
         return id;
     }
 
+    // Deterministic ID for an asset first seen at 'relativePath' (generic,
+    // relative to the asset root), so separate scans of the same project
+    // agree on it without any stored state.
+    static AssetID from_path(std::string_view relativePath) {
+        AssetID id{};
+        id.hi = core::utils::fnv1a_64(relativePath);
+        id.lo = core::utils::fnv1a_64(relativePath, id.hi ^ 0x9E3779B97F4A7C15ull);
+        return id;
+    }
+
     std::string to_string() const {
         char buf[33];
         std::snprintf(buf, sizeof(buf), "%016llx%016llx",
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "asset_metadata.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wave::engine::assets {
+
+namespace fs = std::filesystem;
+
+// What an importer gets to cook: the source bytes exactly as hashed for the
+// artifact key. Read nothing else from disk that affects the output unless
+// it is covered by settings_hash().
+struct ImportSource {
+    std::string_view              relativePath;   // generic, relative to the asset root
+    fs::path                      absolutePath;
+    AssetType                     type{AssetType::Unknown};
+    std::span<const std::uint8_t> bytes;
+};
+
+// Cooks one kind of source asset into its runtime format (cooked_formats.hpp).
+// Registered with an ImportPipeline; cook() runs on JobSystem workers,
+// possibly for several assets at once.
+class AssetImporter {
+public:
+    virtual ~AssetImporter() = default;
+
+    // Part of the artifact key: never reuse a name for a different importer.
+    virtual std::string_view name() const = 0;
+
+    // Bump whenever the output for the same input changes; old artifacts
+    // are then simply never looked up again.
+    virtual std::uint32_t version() const = 0;
+
+    // Hash of any settings that change the output (0 if there are none).
+    virtual std::uint64_t settings_hash() const { return 0; }
+
+    // 'extension' is lower case with the dot, e.g. ".png".
+    virtual bool accepts(std::string_view extension) const = 0;
+
+    // False with 'error' set if the source cannot be cooked.
+    virtual bool cook(const ImportSource& source, std::vector<std::uint8_t>& out, std::string& error) const = 0;
+};
+
+// Built-in importers ------------------------------------------------------------
+
+// .png / .jpg / .jpeg -> CookedTextureHeader + the encoded image, after
+// checking it and reading its dimensions.
+class TextureImporter final : public AssetImporter {
+public:
+    std::string_view name() const override { return "texture"; }
+    std::uint32_t    version() const override { return 1; }
+    bool             accepts(std::string_view extension) const override;
+    bool cook(const ImportSource& source, std::vector<std::uint8_t>& out, std::string& error) const override;
+};
+
+// Wavefront .obj -> CookedMeshHeader + indexed triangle list. Polygons are
+// fanned; missing normals or UVs are zero.
+class MeshImporter final : public AssetImporter {
+public:
+    std::string_view name() const override { return "mesh"; }
+    std::uint32_t    version() const override { return 1; }
+    bool             accepts(std::string_view extension) const override;
+    bool cook(const ImportSource& source, std::vector<std::uint8_t>& out, std::string& error) const override;
+};
+
+// .vert / .frag / .comp -> SPIR-V through tools::ShaderCompiler (glslc).
+// #include lookups start in the source's directory. The compiler's
+// --version output is part of the key, so upgrading glslc re-cooks every
+// shader instead of reusing old SPIR-V. Its path is not: the same glslc
+// installed in different places shares artifacts.
+class ShaderImporter final : public AssetImporter {
+public:
+    // Defaults to "glslc" on PATH. Runs the compiler once to identify it.
+    explicit ShaderImporter(fs::path compilerPath = "glslc");
+
+    std::string_view name() const override { return "shader"; }
+    std::uint32_t    version() const override { return 1; }
+    std::uint64_t    settings_hash() const override { return m_settingsHash; }
+    bool             accepts(std::string_view extension) const override;
+    bool cook(const ImportSource& source, std::vector<std::uint8_t>& out, std::string& error) const override;
+
+private:
+    fs::path      m_compilerPath;
+    std::uint64_t m_settingsHash{0};
+};
+
+} // namespace wave::engine::assets
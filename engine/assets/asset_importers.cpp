@@ -0,0 +1,368 @@
+#include "asset_importer.hpp"
+#include "asset_id.hpp"
+#include "cooked_formats.hpp"
+
+#include "engine/core/filesystem/file_system.hpp"
+#include "engine/core/utils/hash.hpp"
+#include "engine/tools/shader_compiler.hpp"
+
+#include <charconv>
+#include <cstring>
+#include <unordered_map>
+
+namespace wave::engine::assets {
+
+namespace {
+
+template <typename T>
+void append_pod(std::vector<std::uint8_t>& out, const T& value) {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+std::uint32_t read_be16(const std::uint8_t* p) {
+    return (std::uint32_t(p[0]) << 8) | p[1];
+}
+
+std::uint32_t read_be32(const std::uint8_t* p) {
+    return (std::uint32_t(p[0]) << 24) | (std::uint32_t(p[1]) << 16) | (std::uint32_t(p[2]) << 8) | p[3];
+}
+
+// Dimensions from the IHDR chunk, which the format requires to come first.
+bool png_size(std::span<const std::uint8_t> bytes, std::uint32_t& width, std::uint32_t& height) {
+    static constexpr std::uint8_t kSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if (bytes.size() < 24 || std::memcmp(bytes.data(), kSignature, sizeof(kSignature)) != 0 ||
+        std::memcmp(bytes.data() + 12, "IHDR", 4) != 0) {
+        return false;
+    }
+    width  = read_be32(bytes.data() + 16);
+    height = read_be32(bytes.data() + 20);
+    return true;
+}
+
+// Dimensions from the first start-of-frame segment.
+bool jpeg_size(std::span<const std::uint8_t> bytes, std::uint32_t& width, std::uint32_t& height) {
+    if (bytes.size() < 4 || bytes[0] != 0xFF || bytes[1] != 0xD8) {
+        return false;
+    }
+
+    std::size_t pos = 2;
+    while (pos + 4 <= bytes.size()) {
+        if (bytes[pos] != 0xFF) {
+            return false;
+        }
+        const std::uint8_t marker = bytes[pos + 1];
+        if (marker == 0xFF) {
+            ++pos; // fill byte
+            continue;
+        }
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+            pos += 2; // no length field
+            continue;
+        }
+        if (marker == 0xD9 || marker == 0xDA) {
+            return false; // end of image / scan data before any frame header
+        }
+
+        const std::uint32_t length = read_be16(bytes.data() + pos + 2);
+        const bool isFrame = marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+        if (isFrame) {
+            if (length < 7 || pos + 9 > bytes.size()) {
+                return false;
+            }
+            height = read_be16(bytes.data() + pos + 5);
+            width  = read_be16(bytes.data() + pos + 7);
+            return true;
+        }
+        pos += 2 + length;
+    }
+    return false;
+}
+
+std::string lower_extension(const fs::path& path) {
+    std::string ext = path.extension().string();
+    for (char& c : ext) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    return ext;
+}
+
+// OBJ tokenizing ---------------------------------------------------------------
+
+std::string_view next_token(std::string_view& line) {
+    const auto begin = line.find_first_not_of(" \t");
+    if (begin == std::string_view::npos) {
+        line = {};
+        return {};
+    }
+    line.remove_prefix(begin);
+    const auto end = std::min(line.find_first_of(" \t"), line.size());
+    const std::string_view token = line.substr(0, end);
+    line.remove_prefix(end);
+    return token;
+}
+
+bool parse_floats(std::string_view line, float* out, int count) {
+    for (int i = 0; i < count; ++i) {
+        const std::string_view token = next_token(line);
+        if (token.empty() || std::from_chars(token.data(), token.data() + token.size(), out[i]).ec != std::errc()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 1-based (negative = from the end) OBJ index to 0-based; -1 if absent.
+bool parse_index(std::string_view token, std::size_t count, std::int64_t& out) {
+    if (token.empty()) {
+        out = -1;
+        return true;
+    }
+    std::int64_t value = 0;
+    if (std::from_chars(token.data(), token.data() + token.size(), value).ec != std::errc() || value == 0) {
+        return false;
+    }
+    out = value > 0 ? value - 1 : static_cast<std::int64_t>(count) + value;
+    return out >= 0 && static_cast<std::size_t>(out) < count;
+}
+
+struct CornerKey {
+    std::int64_t position;
+    std::int64_t uv;
+    std::int64_t normal;
+
+    bool operator==(const CornerKey&) const = default;
+};
+
+struct CornerKeyHash {
+    std::size_t operator()(const CornerKey& key) const {
+        std::uint64_t hash = static_cast<std::uint64_t>(key.position) * 0x9E3779B97F4A7C15ull;
+        hash ^= static_cast<std::uint64_t>(key.uv) + 0x7F4A7C159E3779B9ull + (hash << 6) + (hash >> 2);
+        hash ^= static_cast<std::uint64_t>(key.normal) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+        return static_cast<std::size_t>(hash);
+    }
+};
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// TextureImporter
+// -----------------------------------------------------------------------------
+
+bool TextureImporter::accepts(std::string_view extension) const {
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg";
+}
+
+bool TextureImporter::cook(const ImportSource& source, std::vector<std::uint8_t>& out, std::string& error) const {
+    CookedTextureHeader header{};
+    std::memcpy(header.magic, kCookedTextureMagic, sizeof(kCookedTextureMagic));
+    header.version = kCookedTextureVersion;
+
+    if (png_size(source.bytes, header.width, header.height)) {
+        header.encoding = CookedTextureEncoding::Png;
+    } else if (jpeg_size(source.bytes, header.width, header.height)) {
+        header.encoding = CookedTextureEncoding::Jpeg;
+    } else {
+        error = "not a PNG or JPEG image";
+        return false;
+    }
+
+    if (header.width == 0 || header.height == 0) {
+        error = "image has no pixels";
+        return false;
+    }
+    if (source.bytes.size() > UINT32_MAX - sizeof(header)) {
+        error = "image too large";
+        return false;
+    }
+
+    header.dataOffset = sizeof(header);
+    header.dataSize   = static_cast<std::uint32_t>(source.bytes.size());
+
+    out.clear();
+    out.reserve(sizeof(header) + source.bytes.size());
+    append_pod(out, header);
+    out.insert(out.end(), source.bytes.begin(), source.bytes.end());
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// MeshImporter
+// -----------------------------------------------------------------------------
+
+bool MeshImporter::accepts(std::string_view extension) const {
+    return extension == ".obj";
+}
+
+bool MeshImporter::cook(const ImportSource& source, std::vector<std::uint8_t>& out, std::string& error) const {
+    struct Float3 {
+        float v[3];
+    };
+    struct Float2 {
+        float v[2];
+    };
+
+    std::vector<Float3> positions;
+    std::vector<Float3> normals;
+    std::vector<Float2> uvs;
+
+    std::vector<CookedVertex>  vertices;
+    std::vector<std::uint32_t> indices;
+    std::unordered_map<CornerKey, std::uint32_t, CornerKeyHash> corners;
+
+    std::vector<std::uint32_t> face;
+
+    const std::string_view text(reinterpret_cast<const char*>(source.bytes.data()), source.bytes.size());
+    std::size_t lineNumber = 0;
+
+    auto fail = [&](const char* what) {
+        error = std::string(what) + " on line " + std::to_string(lineNumber);
+        return false;
+    };
+
+    for (std::size_t pos = 0; pos < text.size();) {
+        const auto eol = std::min(text.find('\n', pos), text.size());
+        std::string_view line = text.substr(pos, eol - pos);
+        pos = eol + 1;
+        ++lineNumber;
+
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+
+        const std::string_view keyword = next_token(line);
+
+        if (keyword == "v") {
+            Float3& p = positions.emplace_back();
+            if (!parse_floats(line, p.v, 3)) return fail("bad vertex position");
+        } else if (keyword == "vn") {
+            Float3& n = normals.emplace_back();
+            if (!parse_floats(line, n.v, 3)) return fail("bad vertex normal");
+        } else if (keyword == "vt") {
+            Float2& t = uvs.emplace_back();
+            if (!parse_floats(line, t.v, 2)) return fail("bad texture coordinate");
+        } else if (keyword == "f") {
+            face.clear();
+
+            for (std::string_view corner = next_token(line); !corner.empty(); corner = next_token(line)) {
+                // v, v/vt, v//vn or v/vt/vn
+                const auto slash1 = corner.find('/');
+                const auto slash2 = slash1 == std::string_view::npos ? slash1 : corner.find('/', slash1 + 1);
+
+                CornerKey key{};
+                const bool ok =
+                    parse_index(corner.substr(0, slash1), positions.size(), key.position) && key.position >= 0 &&
+                    parse_index(slash1 == std::string_view::npos ? std::string_view()
+                                                                 : corner.substr(slash1 + 1, slash2 - slash1 - 1),
+                                uvs.size(), key.uv) &&
+                    parse_index(slash2 == std::string_view::npos ? std::string_view() : corner.substr(slash2 + 1),
+                                normals.size(), key.normal);
+                if (!ok) return fail("bad face index");
+
+                auto [it, inserted] = corners.try_emplace(key, static_cast<std::uint32_t>(vertices.size()));
+                if (inserted) {
+                    CookedVertex& vertex = vertices.emplace_back();
+                    std::memcpy(vertex.position, positions[key.position].v, sizeof(vertex.position));
+                    if (key.normal >= 0) std::memcpy(vertex.normal, normals[key.normal].v, sizeof(vertex.normal));
+                    if (key.uv >= 0) std::memcpy(vertex.uv, uvs[key.uv].v, sizeof(vertex.uv));
+                }
+                face.push_back(it->second);
+            }
+
+            if (face.size() < 3) return fail("face with fewer than three corners");
+
+            for (std::size_t i = 1; i + 1 < face.size(); ++i) {
+                indices.push_back(face[0]);
+                indices.push_back(face[i]);
+                indices.push_back(face[i + 1]);
+            }
+        }
+        // Everything else (o, g, s, usemtl, mtllib, comments) does not change
+        // the geometry.
+    }
+
+    if (indices.empty()) {
+        error = "mesh has no faces";
+        return false;
+    }
+
+    CookedMeshHeader header{};
+    std::memcpy(header.magic, kCookedMeshMagic, sizeof(kCookedMeshMagic));
+    header.version        = kCookedMeshVersion;
+    header.vertexCount    = static_cast<std::uint32_t>(vertices.size());
+    header.indexCount     = static_cast<std::uint32_t>(indices.size());
+    header.verticesOffset = sizeof(header);
+    header.indicesOffset  = header.verticesOffset + vertices.size() * sizeof(CookedVertex);
+
+    out.clear();
+    out.reserve(static_cast<std::size_t>(header.indicesOffset) + indices.size() * sizeof(std::uint32_t));
+    append_pod(out, header);
+    const auto* vertexBytes = reinterpret_cast<const std::uint8_t*>(vertices.data());
+    out.insert(out.end(), vertexBytes, vertexBytes + vertices.size() * sizeof(CookedVertex));
+    const auto* indexBytes = reinterpret_cast<const std::uint8_t*>(indices.data());
+    out.insert(out.end(), indexBytes, indexBytes + indices.size() * sizeof(std::uint32_t));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// ShaderImporter
+// -----------------------------------------------------------------------------
+
+ShaderImporter::ShaderImporter(fs::path compilerPath) : m_compilerPath(std::move(compilerPath)) {
+    tools::ShaderCompiler compiler;
+    compiler.set_compiler_path(m_compilerPath);
+
+    // A compiler that cannot be run hashes as an empty version; cook() will
+    // fail for it anyway, and nothing is stored under that key.
+    const std::string version = compiler.query_version();
+    m_settingsHash = core::utils::fnv1a_64(version);
+}
+
+bool ShaderImporter::accepts(std::string_view extension) const {
+    return extension == ".vert" || extension == ".frag" || extension == ".comp";
+}
+
+bool ShaderImporter::cook(const ImportSource& source, std::vector<std::uint8_t>& out, std::string& error) const {
+    const std::string ext = lower_extension(source.absolutePath);
+    const tools::ShaderStage stage = ext == ".vert"   ? tools::ShaderStage::Vertex
+                                     : ext == ".frag" ? tools::ShaderStage::Fragment
+                                                      : tools::ShaderStage::Compute;
+
+    // Compile the bytes that were hashed, not whatever is on disk by now.
+    std::error_code ec;
+    const fs::path tempDir = fs::temp_directory_path(ec);
+    if (ec) {
+        error = "no temp directory";
+        return false;
+    }
+    const std::string stem = "wave_shader_" + AssetID::generate().to_string();
+    const fs::path input   = tempDir / (stem + ext);
+    const fs::path output  = tempDir / (stem + ".spv");
+
+    const std::string_view text(reinterpret_cast<const char*>(source.bytes.data()), source.bytes.size());
+    if (!core::filesystem::write_text_file(input, text)) {
+        error = "cannot write " + input.string();
+        return false;
+    }
+
+    tools::ShaderCompiler compiler;
+    compiler.set_compiler_path(m_compilerPath);
+    compiler.add_include_dir(source.absolutePath.parent_path());
+
+    const tools::ShaderCompileResult result = compiler.compile_to_file(input, output, stage);
+
+    bool ok = result.success && core::filesystem::read_binary_file(output, out);
+    if (!result.success) {
+        error = result.errorLog;
+    } else if (!ok) {
+        error = "compiler produced no output";
+    }
+
+    core::filesystem::remove_file(input);
+    core::filesystem::remove_file(output);
+    return ok;
+}
+
+} // namespace wave::engine::assets
@@ -3,6 +3,7 @@
 #include "asset_id.hpp"
 
 #include <string>
+#include <string_view>
 #include <filesystem>
 #include <cstdint>
 
@@ -22,6 +23,24 @@ enum class AssetType {
     Folder
 };
 
+// Type of the asset at 'path' (generic), from its extension. Same rules as
+// fs::path::extension(): the last dot of the file name, not counting a
+// leading one.
+inline AssetType asset_type_from_path(std::string_view path) {
+    const std::string_view name = path.substr(path.find_last_of('/') + 1);
+    const auto dot = name.find_last_of('.');
+    const std::string_view ext = dot == std::string_view::npos || dot == 0 ? std::string_view() : name.substr(dot);
+
+    if (ext == ".png" || ext == ".jpg" || ext == ".jpeg") return AssetType::Texture;
+    if (ext == ".obj" || ext == ".fbx" || ext == ".gltf") return AssetType::Mesh;
+    if (ext == ".mat") return AssetType::Material;
+    if (ext == ".vert" || ext == ".frag" || ext == ".comp") return AssetType::Shader;
+    if (ext == ".scene") return AssetType::Scene;
+    if (ext == ".cfg") return AssetType::Config;
+
+    return AssetType::Unknown;
+}
+
 // Metadata stored for each asset entry in the database.
 struct AssetMetadata {
     AssetID id;
@@ -33,6 +52,10 @@ struct AssetMetadata {
     std::uint64_t fileSize{0};
     fs::file_time_type lastWriteTime{};
 
+    // utils::fnv1a_64 of the file contents; 0 until the file is hashed (on
+    // change, not on the initial scan).
+    std::uint64_t contentHash{0};
+
     // Engine may use this to track import pipeline changes later.
     bool needsReimport{false};
 
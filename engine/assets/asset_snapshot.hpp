@@ -0,0 +1,237 @@
+#pragma once
+
+#include "asset_table.hpp"
+#include "dependency_graph.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace wave::engine::assets {
+
+class AssetSnapshot;
+
+// One asset as seen by an AssetSnapshot. Cheap to copy (pointer + slot);
+// valid as long as the snapshot is held. A default-constructed ref is empty.
+class AssetRef {
+public:
+    using Slot = AssetTable::Slot;
+
+    AssetRef() = default;
+    AssetRef(const AssetSnapshot* snapshot, Slot slot) : m_snapshot(snapshot), m_slot(slot) {}
+
+    explicit operator bool() const { return m_snapshot != nullptr; }
+
+    const AssetID&     id() const;
+    AssetType          type() const;
+    std::string_view   relative_path() const;   // generic, relative to the asset root
+    fs::path           absolute_path() const;
+    std::uint64_t      file_size() const;
+    fs::file_time_type last_write_time() const;
+    std::uint64_t      content_hash() const;
+    bool               needs_reimport() const;
+
+    // Owning copy of everything above.
+    AssetMetadata metadata() const;
+
+    Slot slot() const { return m_slot; }
+
+private:
+    const AssetSnapshot* m_snapshot{nullptr};
+    Slot                 m_slot{AssetTable::kNone};
+};
+
+// Result of an AssetSnapshot query: a range of slots in one of the
+// snapshot's ordered indexes, read as AssetRefs on the fly. Nothing is
+// copied; valid as long as the snapshot is held.
+class AssetView {
+public:
+    using Slot = AssetTable::Slot;
+
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = AssetRef;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = AssetRef;
+
+        Iterator() = default;
+        Iterator(const AssetSnapshot* snapshot, const Slot* slot) : m_snapshot(snapshot), m_slot(slot) {}
+
+        AssetRef operator*() const { return AssetRef(m_snapshot, *m_slot); }
+
+        Iterator& operator++() {
+            ++m_slot;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const { return m_slot == other.m_slot; }
+
+    private:
+        const AssetSnapshot* m_snapshot{nullptr};
+        const Slot*          m_slot{nullptr};
+    };
+
+    AssetView() = default;
+    AssetView(const AssetSnapshot* snapshot, std::span<const Slot> slots) : m_snapshot(snapshot), m_slots(slots) {}
+
+    std::size_t size() const { return m_slots.size(); }
+    bool empty() const { return m_slots.empty(); }
+
+    AssetRef operator[](std::size_t index) const { return AssetRef(m_snapshot, m_slots[index]); }
+
+    Iterator begin() const { return Iterator(m_snapshot, m_slots.data()); }
+    Iterator end() const { return Iterator(m_snapshot, m_slots.data() + m_slots.size()); }
+
+    std::span<const Slot> slots() const { return m_slots; }
+
+private:
+    const AssetSnapshot*  m_snapshot{nullptr};
+    std::span<const Slot> m_slots;
+};
+
+// Immutable state of an AssetDatabase at one point in time, as published by
+// its writers. Held through std::shared_ptr (AssetDatabase::snapshot());
+// readers of one snapshot never see a later change, and never block one.
+//
+//   for (AssetRef asset : *database.snapshot()) { ... }
+class AssetSnapshot final : public std::enable_shared_from_this<AssetSnapshot> {
+public:
+    using Slot = AssetTable::Slot;
+
+    AssetSnapshot(fs::path root, AssetTable table, std::shared_ptr<const DependencyGraph> dependencies,
+                  std::uint64_t version = 0)
+        : m_root(std::move(root)), m_table(std::move(table)), m_dependencies(std::move(dependencies)),
+          m_version(version) {}
+
+    AssetSnapshot(const AssetSnapshot&) = delete;
+    AssetSnapshot& operator=(const AssetSnapshot&) = delete;
+
+    const fs::path&   root() const { return m_root; }
+    const AssetTable& table() const { return m_table; }
+
+    // Grows with every publish; see AssetDatabase::changes_since().
+    std::uint64_t version() const { return m_version; }
+
+    // Shared between snapshots until it changes.
+    const DependencyGraph& dependencies() const { return *m_dependencies; }
+
+    std::size_t size() const { return m_table.size(); }
+    bool empty() const { return m_table.empty(); }
+
+    // Empty refs if absent.
+    AssetRef find(std::string_view relativePath) const { return ref(m_table.find(relativePath)); }
+    AssetRef find(const AssetID& id) const { return ref(m_table.find(id)); }
+
+    // Indexed queries ----------------------------------------------------------
+    //
+    // O(log n) or better however many assets match; results are in path
+    // order (by directory, then file name; see AssetTable). Directories are
+    // relative keys like "textures/ui"; "" is the root. Directories without
+    // assets do not exist here.
+    //
+    //   for (AssetRef texture : snapshot->of_type(AssetType::Texture)) { ... }
+    //   for (AssetRef file : snapshot->in_directory("levels/forest")) { ... }
+
+    AssetView by_path() const { return view(m_table.ordered()); }
+    AssetView of_type(AssetType type) const { return view(m_table.of_type(type)); }
+    AssetView with_extension(std::string_view extension) const { return view(m_table.with_extension(extension)); }   // ".png", "PNG"
+    AssetView in_directory(std::string_view directory) const { return view(m_table.in_directory(directory)); }
+    AssetView under(std::string_view directory) const { return view(m_table.under(directory)); }   // recursive
+
+    // Names of the child directories of 'directory'; valid while the
+    // snapshot is held.
+    void subdirectories(std::string_view directory, std::vector<std::string_view>& out) const {
+        m_table.subdirectories(directory, out);
+    }
+
+    // Every asset, in slot order.
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = AssetRef;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = AssetRef;
+
+        Iterator() = default;
+        Iterator(const AssetSnapshot* snapshot, Slot slot) : m_snapshot(snapshot), m_slot(slot) { skip_dead(); }
+
+        AssetRef operator*() const { return AssetRef(m_snapshot, m_slot); }
+
+        Iterator& operator++() {
+            ++m_slot;
+            skip_dead();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const { return m_slot == other.m_slot; }
+
+    private:
+        void skip_dead() {
+            const AssetTable& table = m_snapshot->table();
+            while (m_slot < table.slot_count() && !table.alive(m_slot)) {
+                ++m_slot;
+            }
+        }
+
+        const AssetSnapshot* m_snapshot{nullptr};
+        Slot                 m_slot{0};
+    };
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, m_table.slot_count()); }
+
+private:
+    AssetRef ref(Slot slot) const { return slot == AssetTable::kNone ? AssetRef() : AssetRef(this, slot); }
+    AssetView view(std::span<const Slot> slots) const { return AssetView(this, slots); }
+
+private:
+    fs::path                               m_root;
+    AssetTable                             m_table;
+    std::shared_ptr<const DependencyGraph> m_dependencies;
+    std::uint64_t                          m_version{0};
+};
+
+// AssetRef ---------------------------------------------------------------------
+
+inline const AssetID& AssetRef::id() const { return m_snapshot->table().id(m_slot); }
+inline AssetType AssetRef::type() const { return m_snapshot->table().type(m_slot); }
+inline std::string_view AssetRef::relative_path() const { return m_snapshot->table().path(m_slot); }
+inline fs::path AssetRef::absolute_path() const { return m_snapshot->root() / relative_path(); }
+inline std::uint64_t AssetRef::file_size() const { return m_snapshot->table().file_size(m_slot); }
+inline fs::file_time_type AssetRef::last_write_time() const { return m_snapshot->table().last_write_time(m_slot); }
+inline std::uint64_t AssetRef::content_hash() const { return m_snapshot->table().content_hash(m_slot); }
+inline bool AssetRef::needs_reimport() const { return m_snapshot->table().needs_reimport(m_slot); }
+
+inline AssetMetadata AssetRef::metadata() const {
+    AssetMetadata meta;
+    meta.id            = id();
+    meta.type          = type();
+    meta.relativePath  = fs::path(relative_path());
+    meta.absolutePath  = m_snapshot->root() / meta.relativePath;
+    meta.fileSize      = file_size();
+    meta.lastWriteTime = last_write_time();
+    meta.contentHash   = content_hash();
+    meta.needsReimport = needs_reimport();
+    return meta;
+}
+
+} // namespace wave::engine::assets
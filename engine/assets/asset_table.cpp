@@ -0,0 +1,526 @@
+#include "asset_table.hpp"
+
+#include "engine/core/utils/hash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <utility>
+
+namespace wave::engine::assets {
+
+namespace {
+
+// Dead path bytes tolerated before the arena is rewritten.
+constexpr std::size_t kCompactThreshold = 64 * 1024;
+
+constexpr std::size_t kMinBuckets = 16;
+
+std::string_view file_name_of(std::string_view path) {
+    return path.substr(path.find_last_of('/') + 1);
+}
+
+std::string_view trim_directory(std::string_view directory) {
+    while (!directory.empty() && directory.back() == '/') {
+        directory.remove_suffix(1);
+    }
+    return directory == "." ? std::string_view() : directory;
+}
+
+// Order of directory keys: bytes, except that '/' comes first, so that
+// "a/b/..." directly follows "a/b" and precedes "a/b-c" or "a/b.d".
+bool directory_less(std::string_view a, std::string_view b) {
+    auto rank = [](char c) { return c == '/' ? 0u : static_cast<unsigned char>(c) + 1u; };
+    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(),
+                                        [&rank](char x, char y) { return rank(x) < rank(y); });
+}
+
+// 'directory' itself or anything below it.
+bool within(std::string_view key, std::string_view directory) {
+    return directory.empty() ||
+           (key.starts_with(directory) && (key.size() == directory.size() || key[directory.size()] == '/'));
+}
+
+std::string to_lower(std::string_view text) {
+    std::string lower(text);
+    for (char& c : lower) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    return lower;
+}
+
+// Same rules as asset_type_from_path(), lower-cased.
+std::string extension_of(std::string_view name) {
+    const auto dot = name.find_last_of('.');
+    return dot == std::string_view::npos || dot == 0 ? std::string() : to_lower(name.substr(dot));
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Access / lookup
+// -----------------------------------------------------------------------------
+
+std::string_view AssetTable::path(Slot slot) const {
+    return std::string_view(m_paths).substr(m_pathOffsets[slot], m_pathLengths[slot]);
+}
+
+AssetRecord AssetTable::record(Slot slot) const {
+    AssetRecord record;
+    record.id            = m_ids[slot];
+    record.type          = m_types[slot];
+    record.fileSize      = m_sizes[slot];
+    record.lastWriteTime = m_lastWrites[slot];
+    record.contentHash   = m_hashes[slot];
+    record.needsReimport = m_needsReimport[slot] != 0;
+    return record;
+}
+
+AssetTable::Slot AssetTable::find(std::string_view key) const {
+    if (m_byPath.buckets.empty()) {
+        return kNone;
+    }
+
+    const std::uint64_t hash = core::utils::fnv1a_64(key);
+    const std::size_t   mask = m_byPath.buckets.size() - 1;
+
+    for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+        const Slot slot = m_byPath.buckets[i];
+        if (slot == kEmpty) {
+            return kNone;
+        }
+        if (slot != kTombstone && m_pathHashes[slot] == hash && path(slot) == key) {
+            return slot;
+        }
+    }
+}
+
+AssetTable::Slot AssetTable::find(const AssetID& id) const {
+    if (m_byId.buckets.empty()) {
+        return kNone;
+    }
+
+    const std::uint64_t hash = hash_id(id);
+    const std::size_t   mask = m_byId.buckets.size() - 1;
+
+    for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+        const Slot slot = m_byId.buckets[i];
+        if (slot == kEmpty) {
+            return kNone;
+        }
+        if (slot != kTombstone && m_ids[slot] == id) {
+            return slot;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Mutation
+// -----------------------------------------------------------------------------
+
+AssetTable::Slot AssetTable::assign(std::string_view key, const AssetRecord& record) {
+    ensure_capacity(m_live);
+
+    Slot slot = find(key);
+    if (slot == kNone) {
+        if (!m_free.empty()) {
+            slot = m_free.back();
+            m_free.pop_back();
+        } else {
+            slot = static_cast<Slot>(m_ids.size());
+            m_ids.emplace_back();
+            m_types.emplace_back();
+            m_sizes.emplace_back();
+            m_lastWrites.emplace_back();
+            m_hashes.emplace_back();
+            m_needsReimport.emplace_back();
+            m_alive.emplace_back();
+            m_pathHashes.emplace_back();
+            m_pathOffsets.emplace_back();
+            m_pathLengths.emplace_back();
+            m_extensions.emplace_back();
+            m_unsortedFlags.emplace_back();
+        }
+
+        m_alive[slot]       = 1;
+        m_pathHashes[slot]  = core::utils::fnv1a_64(key);
+        m_pathOffsets[slot] = intern(key);
+        m_pathLengths[slot] = static_cast<std::uint32_t>(key.size());
+        m_extensions[slot]  = extension_id(key);
+        m_ids[slot]         = record.id;
+        ++m_live;
+        mark_unsorted(slot);
+
+        index_insert(m_byPath, m_pathHashes[slot], slot);
+        index_insert(m_byId, hash_id(record.id), slot);
+    } else if (m_ids[slot] != record.id) {
+        note_change(m_ids[slot]);
+        index_erase(m_byId, hash_id(m_ids[slot]), slot);
+        m_ids[slot] = record.id;
+        index_insert(m_byId, hash_id(record.id), slot);
+    }
+
+    assert(find(record.id) == slot);
+
+    if (m_types[slot] != record.type) {
+        mark_unsorted(slot);
+    }
+
+    m_types[slot]         = record.type;
+    m_sizes[slot]         = record.fileSize;
+    m_lastWrites[slot]    = record.lastWriteTime;
+    m_hashes[slot]        = record.contentHash;
+    m_needsReimport[slot] = record.needsReimport ? 1 : 0;
+    note_change(record.id);
+    return slot;
+}
+
+void AssetTable::rename(Slot slot, std::string_view newPath) {
+    assert(alive(slot) && find(newPath) == kNone);
+
+    ensure_capacity(m_live);
+
+    index_erase(m_byPath, m_pathHashes[slot], slot);
+
+    m_deadPathBytes    += m_pathLengths[slot];
+    m_pathHashes[slot]  = core::utils::fnv1a_64(newPath);
+    m_pathOffsets[slot] = intern(newPath);
+    m_pathLengths[slot] = static_cast<std::uint32_t>(newPath.size());
+    m_extensions[slot]  = extension_id(newPath);
+
+    index_insert(m_byPath, m_pathHashes[slot], slot);
+    note_change(m_ids[slot]);
+    mark_unsorted(slot);
+    compact_paths();
+}
+
+void AssetTable::erase(Slot slot) {
+    if (!alive(slot)) {
+        return;
+    }
+
+    index_erase(m_byPath, m_pathHashes[slot], slot);
+    index_erase(m_byId, hash_id(m_ids[slot]), slot);
+    note_change(m_ids[slot]);
+
+    m_alive[slot]    = 0;
+    m_ids[slot]      = {};
+    m_deadPathBytes += m_pathLengths[slot];
+    m_free.push_back(slot);
+    --m_live;
+
+    mark_unsorted(slot);
+    compact_paths();
+}
+
+void AssetTable::clear() {
+    *this = AssetTable();
+}
+
+bool AssetTable::take_changes(std::vector<AssetID>& out) {
+    if (std::exchange(m_changedAll, false)) {
+        m_changed.clear();
+        return false;
+    }
+
+    out.insert(out.end(), m_changed.begin(), m_changed.end());
+    m_changed.clear();
+    return true;
+}
+
+void AssetTable::note_change(const AssetID& id) {
+    if (!m_changedAll) {
+        m_changed.push_back(id);
+    }
+}
+
+void AssetTable::reserve(std::size_t count) {
+    m_ids.reserve(count);
+    m_types.reserve(count);
+    m_sizes.reserve(count);
+    m_lastWrites.reserve(count);
+    m_hashes.reserve(count);
+    m_needsReimport.reserve(count);
+    m_alive.reserve(count);
+    m_pathHashes.reserve(count);
+    m_pathOffsets.reserve(count);
+    m_pathLengths.reserve(count);
+    m_extensions.reserve(count);
+    m_unsortedFlags.reserve(count);
+
+    ensure_capacity(count);
+}
+
+// -----------------------------------------------------------------------------
+// Indexes
+// -----------------------------------------------------------------------------
+
+std::uint64_t AssetTable::hash_id(const AssetID& id) {
+    // IDs are mostly random already; path-hash IDs are FNV output. Mix both
+    // halves so the low bits used for the bucket depend on all of them.
+    std::uint64_t hash = id.hi ^ (id.lo * 0x9E3779B97F4A7C15ull);
+    hash ^= hash >> 32;
+    hash *= 0xD6E8FEB86659FD93ull;
+    return hash ^ (hash >> 29);
+}
+
+std::uint64_t AssetTable::key_hash(const Index& index, Slot slot) const {
+    return &index == &m_byPath ? m_pathHashes[slot] : hash_id(m_ids[slot]);
+}
+
+void AssetTable::index_insert(Index& index, std::uint64_t hash, Slot slot) {
+    const std::size_t mask = index.buckets.size() - 1;
+
+    std::size_t i = hash & mask;
+    while (index.buckets[i] != kEmpty && index.buckets[i] != kTombstone) {
+        i = (i + 1) & mask;
+    }
+
+    if (index.buckets[i] == kTombstone) {
+        --index.tombstones;
+    }
+    index.buckets[i] = slot;
+}
+
+void AssetTable::index_erase(Index& index, std::uint64_t hash, Slot slot) {
+    const std::size_t mask = index.buckets.size() - 1;
+
+    for (std::size_t i = hash & mask; index.buckets[i] != kEmpty; i = (i + 1) & mask) {
+        if (index.buckets[i] == slot) {
+            index.buckets[i] = kTombstone;
+            ++index.tombstones;
+            return;
+        }
+    }
+}
+
+void AssetTable::ensure_capacity(std::size_t live) {
+    // Room for one insert plus one tombstone at under half load, so every
+    // probe sequence ends at an empty bucket.
+    auto full = [live](const Index& index) {
+        return (live + index.tombstones + 2) * 2 > index.buckets.size();
+    };
+
+    if (full(m_byPath) || full(m_byId)) {
+        rebuild_indexes(std::max(kMinBuckets, std::bit_ceil((live + 2) * 4)));
+    }
+}
+
+void AssetTable::rebuild_indexes(std::size_t bucketCount) {
+    for (Index* index : {&m_byPath, &m_byId}) {
+        index->buckets.assign(bucketCount, kEmpty);
+        index->tombstones = 0;
+
+        for (Slot slot = 0; slot < slot_count(); ++slot) {
+            if (m_alive[slot]) {
+                index_insert(*index, key_hash(*index, slot), slot);
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Ordered indexes
+// -----------------------------------------------------------------------------
+
+void AssetTable::mark_unsorted(Slot slot) {
+    if (!m_unsortedFlags[slot]) {
+        m_unsortedFlags[slot] = 1;
+        m_unsorted.push_back(slot);
+    }
+}
+
+std::uint32_t AssetTable::extension_id(std::string_view path) {
+    const std::string ext = extension_of(file_name_of(path));
+
+    // A project uses a few dozen extensions at most.
+    auto it = std::find(m_extensionNames.begin(), m_extensionNames.end(), ext);
+    if (it == m_extensionNames.end()) {
+        m_extensionNames.push_back(ext);
+        return static_cast<std::uint32_t>(m_extensionNames.size() - 1);
+    }
+    return static_cast<std::uint32_t>(it - m_extensionNames.begin());
+}
+
+std::string_view AssetTable::directory_of(Slot slot) const {
+    const std::string_view key = path(slot);
+    const auto slash = key.find_last_of('/');
+    return slash == std::string_view::npos ? std::string_view() : key.substr(0, slash);
+}
+
+void AssetTable::sort_indexes() {
+    if (m_unsorted.empty()) {
+        return;
+    }
+
+    // Drop every marked slot wherever it is, then merge the live ones back
+    // in; untouched entries keep their relative order.
+    auto marked = [this](Slot slot) { return m_unsortedFlags[slot] != 0; };
+    std::erase_if(m_ordered, marked);
+    for (auto& slots : m_byType) {
+        std::erase_if(slots, marked);
+    }
+    for (auto& slots : m_byExtension) {
+        std::erase_if(slots, marked);
+    }
+
+    std::vector<Slot> fresh;
+    fresh.reserve(m_unsorted.size());
+    for (Slot slot : m_unsorted) {
+        m_unsortedFlags[slot] = 0;
+        if (m_alive[slot]) {
+            fresh.push_back(slot);
+        }
+    }
+    m_unsorted.clear();
+
+    auto less = [this](Slot a, Slot b) {
+        const std::string_view dirA = directory_of(a);
+        const std::string_view dirB = directory_of(b);
+        if (dirA != dirB) {
+            return directory_less(dirA, dirB);
+        }
+        return file_name_of(path(a)) < file_name_of(path(b));
+    };
+    std::sort(fresh.begin(), fresh.end(), less);
+
+    auto merge = [&less](std::vector<Slot>& slots, std::size_t sorted) {
+        if (sorted != 0 && sorted != slots.size()) {
+            std::inplace_merge(slots.begin(), slots.begin() + static_cast<std::ptrdiff_t>(sorted), slots.end(), less);
+        }
+    };
+
+    const std::size_t ordered = m_ordered.size();
+    m_ordered.insert(m_ordered.end(), fresh.begin(), fresh.end());
+    merge(m_ordered, ordered);
+
+    m_byType.resize(static_cast<std::size_t>(AssetType::Folder) + 1);
+    m_byExtension.resize(m_extensionNames.size());
+
+    std::vector<std::size_t> typeSizes(m_byType.size());
+    std::vector<std::size_t> extensionSizes(m_byExtension.size());
+    for (std::size_t i = 0; i < m_byType.size(); ++i) {
+        typeSizes[i] = m_byType[i].size();
+    }
+    for (std::size_t i = 0; i < m_byExtension.size(); ++i) {
+        extensionSizes[i] = m_byExtension[i].size();
+    }
+
+    for (Slot slot : fresh) {
+        m_byType[static_cast<std::size_t>(m_types[slot])].push_back(slot);
+        m_byExtension[m_extensions[slot]].push_back(slot);
+    }
+
+    for (std::size_t i = 0; i < m_byType.size(); ++i) {
+        merge(m_byType[i], typeSizes[i]);
+    }
+    for (std::size_t i = 0; i < m_byExtension.size(); ++i) {
+        merge(m_byExtension[i], extensionSizes[i]);
+    }
+}
+
+std::span<const AssetTable::Slot> AssetTable::queryable(const std::vector<Slot>& slots) const {
+    assert(indexes_sorted());
+    return std::span<const Slot>(slots);
+}
+
+std::span<const AssetTable::Slot> AssetTable::of_type(AssetType type) const {
+    const auto index = static_cast<std::size_t>(type);
+    return index < m_byType.size() ? queryable(m_byType[index]) : std::span<const Slot>();
+}
+
+std::span<const AssetTable::Slot> AssetTable::with_extension(std::string_view extension) const {
+    const std::string ext = extension.empty() || extension.front() == '.' ? to_lower(extension)
+                                                                           : "." + to_lower(extension);
+
+    auto it = std::find(m_extensionNames.begin(), m_extensionNames.end(), ext);
+    const auto index = static_cast<std::size_t>(it - m_extensionNames.begin());
+    return index < m_byExtension.size() ? queryable(m_byExtension[index]) : std::span<const Slot>();
+}
+
+std::span<const AssetTable::Slot> AssetTable::in_directory(std::string_view directory) const {
+    directory = trim_directory(directory);
+
+    const std::span<const Slot> all = ordered();
+    auto first = std::lower_bound(all.begin(), all.end(), directory, [this](Slot slot, std::string_view dir) {
+        return directory_less(directory_of(slot), dir);
+    });
+    auto last = std::upper_bound(first, all.end(), directory, [this](std::string_view dir, Slot slot) {
+        return directory_less(dir, directory_of(slot));
+    });
+    return std::span<const Slot>(first, last);
+}
+
+const AssetTable::Slot* AssetTable::subtree_end(const Slot* first, const Slot* last, std::string_view directory) const {
+    return std::partition_point(first, last, [&](Slot slot) { return within(directory_of(slot), directory); });
+}
+
+std::span<const AssetTable::Slot> AssetTable::under(std::string_view directory) const {
+    directory = trim_directory(directory);
+
+    const std::span<const Slot> all = ordered();
+    auto first = std::lower_bound(all.begin(), all.end(), directory, [this](Slot slot, std::string_view dir) {
+        return directory_less(directory_of(slot), dir);
+    });
+
+    const Slot* begin = all.data() + (first - all.begin());
+    return std::span<const Slot>(begin, subtree_end(begin, all.data() + all.size(), directory));
+}
+
+void AssetTable::subdirectories(std::string_view directory, std::vector<std::string_view>& out) const {
+    out.clear();
+    directory = trim_directory(directory);
+
+    // The subtree is the directory's own files, then one contiguous block per
+    // child directory: read a name off the first entry of each block and
+    // jump past the block.
+    const std::span<const Slot> subtree = under(directory);
+    const std::span<const Slot> files   = in_directory(directory);
+
+    const Slot* it  = files.data() + files.size();
+    const Slot* end = subtree.data() + subtree.size();
+    const std::size_t prefix = directory.empty() ? 0 : directory.size() + 1;
+
+    while (it < end) {
+        const std::string_view dir  = directory_of(*it);
+        const std::string_view rest = dir.substr(prefix);
+        const std::string_view name = rest.substr(0, rest.find('/'));
+        out.push_back(name);
+        it = subtree_end(it, end, dir.substr(0, prefix + name.size()));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Path arena
+// -----------------------------------------------------------------------------
+
+std::uint32_t AssetTable::intern(std::string_view key) {
+    const auto offset = static_cast<std::uint32_t>(m_paths.size());
+    m_paths.append(key);
+    return offset;
+}
+
+void AssetTable::compact_paths() {
+    if (m_deadPathBytes <= kCompactThreshold || m_deadPathBytes <= m_paths.size() / 2) {
+        return;
+    }
+
+    std::string paths;
+    paths.reserve(m_paths.size() - m_deadPathBytes);
+
+    for (Slot slot = 0; slot < slot_count(); ++slot) {
+        if (!m_alive[slot]) {
+            continue;
+        }
+        const auto offset = static_cast<std::uint32_t>(paths.size());
+        paths.append(m_paths, m_pathOffsets[slot], m_pathLengths[slot]);
+        m_pathOffsets[slot] = offset;
+    }
+
+    m_paths = std::move(paths);
+    m_deadPathBytes = 0;
+}
+
+} // namespace wave::engine::assets
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "asset_metadata.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wave::engine::assets {
+
+// Everything stored per asset except its path.
+struct AssetRecord {
+    AssetID            id;
+    AssetType          type{AssetType::Unknown};
+    std::uint64_t      fileSize{0};
+    fs::file_time_type lastWriteTime{};
+    std::uint64_t      contentHash{0};
+    bool               needsReimport{false};
+};
+
+// Asset storage as parallel column arrays indexed by slot, plus two
+// open-addressing hash indexes: relative path (FNV-1a) and 128-bit AssetID,
+// and ordered indexes for queries by directory, type and extension.
+//
+// Nothing is allocated per asset. Paths are interned into one string arena,
+// the indexes are flat arrays of slot numbers, and copying a table (which is
+// how AssetDatabase publishes snapshots) is a handful of memcpys.
+//
+// A slot stays valid while its asset lives; erased slots are reused.
+class AssetTable final {
+public:
+    using Slot = std::uint32_t;
+
+    static constexpr Slot kNone = ~Slot{0};
+
+    std::size_t size() const { return m_live; }
+    bool empty() const { return m_live == 0; }
+
+    // Slots are [0, slot_count()); skip the ones that are not alive().
+    Slot slot_count() const { return static_cast<Slot>(m_ids.size()); }
+    bool alive(Slot slot) const { return slot < m_alive.size() && m_alive[slot] != 0; }
+
+    // Columns ------------------------------------------------------------------
+
+    const AssetID&     id(Slot slot) const { return m_ids[slot]; }
+    AssetType          type(Slot slot) const { return m_types[slot]; }
+    std::string_view   path(Slot slot) const;
+    std::uint64_t      file_size(Slot slot) const { return m_sizes[slot]; }
+    fs::file_time_type last_write_time(Slot slot) const { return m_lastWrites[slot]; }
+    std::uint64_t      content_hash(Slot slot) const { return m_hashes[slot]; }
+    bool               needs_reimport(Slot slot) const { return m_needsReimport[slot] != 0; }
+
+    AssetRecord record(Slot slot) const;
+
+    // Lookup -------------------------------------------------------------------
+
+    Slot find(std::string_view path) const;
+    Slot find(const AssetID& id) const;
+
+    // Mutation -----------------------------------------------------------------
+
+    // Inserts 'path', or overwrites its record if present. record.id must not
+    // belong to another path.
+    Slot assign(std::string_view path, const AssetRecord& record);
+
+    // Moves an asset to a path that is not in the table.
+    void rename(Slot slot, std::string_view newPath);
+
+    void erase(Slot slot);
+    void clear();
+    void reserve(std::size_t count);
+
+    // Change tracking ----------------------------------------------------------
+    //
+    // Appends the IDs of the assets assigned, renamed or erased since the
+    // last call to 'out' (an ID may repeat). Returns false instead when the
+    // table was built or cleared since: then everything changed and nothing
+    // is appended. (AssetDatabase takes them on publish.)
+    bool take_changes(std::vector<AssetID>& out);
+
+    // Ordered indexes ----------------------------------------------------------
+    //
+    // Live slots sorted by directory, then file name, with '/' ordered before
+    // every other byte: the files of one directory, and the files anywhere
+    // below it, are each one contiguous range, found by binary search. The
+    // type and extension lists keep the same order.
+    //
+    // Mutations only mark the slots they touch; sort_indexes() brings the
+    // indexes up to date in one pass (O(n + k log k) for k marked slots) and
+    // must run before any query below (AssetDatabase runs it on publish).
+    //
+    // Directories are relative keys without a trailing slash; "" is the root.
+    // Results are views into the table.
+
+    void sort_indexes();
+    bool indexes_sorted() const { return m_unsorted.empty(); }
+
+    std::span<const Slot> ordered() const { return queryable(m_ordered); }
+    std::span<const Slot> of_type(AssetType type) const;
+    std::span<const Slot> with_extension(std::string_view extension) const;   // ".png" or "png", any case; "" = none
+    std::span<const Slot> in_directory(std::string_view directory) const;     // files directly in 'directory'
+    std::span<const Slot> under(std::string_view directory) const;            // files anywhere below it
+
+    // Names of the directories directly in 'directory' that contain assets,
+    // in index order; O(log n) per name.
+    void subdirectories(std::string_view directory, std::vector<std::string_view>& out) const;
+
+private:
+    // Index buckets hold slot numbers.
+    static constexpr Slot kEmpty     = kNone;
+    static constexpr Slot kTombstone = kNone - 1;
+
+    struct Index {
+        std::vector<Slot> buckets;      // power of two, linear probing
+        std::size_t       tombstones{0};
+    };
+
+    static std::uint64_t hash_id(const AssetID& id);
+
+    std::uint64_t key_hash(const Index& index, Slot slot) const;
+    void          index_insert(Index& index, std::uint64_t hash, Slot slot);
+    void          index_erase(Index& index, std::uint64_t hash, Slot slot);
+    void          ensure_capacity(std::size_t live);
+    void          rebuild_indexes(std::size_t bucketCount);
+
+    std::uint32_t intern(std::string_view path);
+    void          compact_paths();
+
+    void                  note_change(const AssetID& id);
+    void                  mark_unsorted(Slot slot);
+    std::uint32_t         extension_id(std::string_view path);
+    std::span<const Slot> queryable(const std::vector<Slot>& slots) const;
+    std::string_view      directory_of(Slot slot) const;
+    const Slot*           subtree_end(const Slot* first, const Slot* last, std::string_view directory) const;
+
+private:
+    // Columns.
+    std::vector<AssetID>            m_ids;
+    std::vector<AssetType>          m_types;
+    std::vector<std::uint64_t>      m_sizes;
+    std::vector<fs::file_time_type> m_lastWrites;
+    std::vector<std::uint64_t>      m_hashes;
+    std::vector<std::uint8_t>       m_needsReimport;
+    std::vector<std::uint8_t>       m_alive;
+    std::vector<std::uint64_t>      m_pathHashes;
+    std::vector<std::uint32_t>      m_pathOffsets;
+    std::vector<std::uint32_t>      m_pathLengths;
+    std::vector<std::uint32_t>      m_extensions;      // into m_extensionNames
+    std::vector<std::uint8_t>       m_unsortedFlags;
+
+    std::string       m_paths;             // path arena
+    std::size_t       m_deadPathBytes{0};
+    std::vector<Slot> m_free;
+    std::size_t       m_live{0};
+
+    Index m_byPath;
+    Index m_byId;
+
+    // Ordered indexes; m_unsorted lists the slots marked since the last sort.
+    std::vector<Slot>              m_ordered;
+    std::vector<std::vector<Slot>> m_byType;           // by AssetType
+    std::vector<std::vector<Slot>> m_byExtension;      // by extension id
+    std::vector<std::string>       m_extensionNames;   // lower case, with the dot; "" = none
+    std::vector<Slot>              m_unsorted;
+
+    // For take_changes(); not tracked per ID while everything is new.
+    std::vector<AssetID> m_changed;
+    bool                 m_changedAll{true};
+};
+
+} // namespace wave::engine::assets
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+namespace wave::engine::assets {
+
+// Runtime formats produced by the built-in importers (little endian).
+// Artifacts are mapped and read in place, so every table is naturally
+// aligned relative to the start of the payload.
+
+static_assert(std::endian::native == std::endian::little, "cooked assets are read in place; little endian only");
+
+// Mesh (MeshImporter) ---------------------------------------------------------
+//
+//   CookedMeshHeader                 32 bytes
+//   CookedVertex[vertexCount]        at verticesOffset
+//   std::uint32_t[indexCount]        at indicesOffset; triangle list
+
+inline constexpr char          kCookedMeshMagic[4] = {'W', 'M', 'S', 'H'};
+inline constexpr std::uint32_t kCookedMeshVersion  = 1;
+
+struct CookedMeshHeader {
+    char          magic[4];
+    std::uint32_t version;
+    std::uint32_t vertexCount;
+    std::uint32_t indexCount;
+    std::uint64_t verticesOffset;
+    std::uint64_t indicesOffset;
+};
+
+// Same layout as render::Vertex.
+struct CookedVertex {
+    float position[3];
+    float normal[3];
+    float uv[2];
+};
+
+static_assert(sizeof(CookedMeshHeader) == 32);
+static_assert(sizeof(CookedVertex) == 32);
+
+// Texture (TextureImporter) ---------------------------------------------------
+//
+//   CookedTextureHeader              32 bytes
+//   encoded image                    at dataOffset, dataSize bytes
+//
+// The image stays in its source encoding (the engine has no encoder for a
+// GPU format yet); the header gives loaders its size and encoding without
+// parsing it.
+
+inline constexpr char          kCookedTextureMagic[4] = {'W', 'T', 'E', 'X'};
+inline constexpr std::uint32_t kCookedTextureVersion  = 1;
+
+enum class CookedTextureEncoding : std::uint32_t {
+    Png  = 1,
+    Jpeg = 2
+};
+
+struct CookedTextureHeader {
+    char                  magic[4];
+    std::uint32_t         version;
+    std::uint32_t         width;
+    std::uint32_t         height;
+    CookedTextureEncoding encoding;
+    std::uint32_t         reserved;
+    std::uint32_t         dataOffset;
+    std::uint32_t         dataSize;
+};
+
+static_assert(sizeof(CookedTextureHeader) == 32);
+
+// Shaders (ShaderImporter) are plain SPIR-V words.
+
+} // namespace wave::engine::assets
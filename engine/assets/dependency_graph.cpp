@@ -0,0 +1,242 @@
+#include "dependency_graph.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <unordered_set>
+
+namespace wave::engine::assets {
+
+namespace {
+
+// 'reference' relative to 'base' (a directory key, "" = root), normalized;
+// empty if it is absolute or leaves the root.
+std::string resolve(std::string_view base, std::string_view reference) {
+    if (reference.empty() || reference.front() == '/' || reference.find(':') != std::string_view::npos) {
+        return {};
+    }
+
+    const std::filesystem::path joined = base.empty() ? std::filesystem::path(reference)
+                                                      : std::filesystem::path(base) / reference;
+    std::string key = joined.lexically_normal().generic_string();
+
+    if (key.empty() || key == "." || key.ends_with('/') || key == ".." || key.starts_with("../")) {
+        return {};
+    }
+    return key;
+}
+
+std::string_view directory_of(std::string_view key) {
+    const auto slash = key.find_last_of('/');
+    return slash == std::string_view::npos ? std::string_view() : key.substr(0, slash);
+}
+
+void scan_includes(std::string_view relativePath, std::string_view text, std::vector<std::string>& out) {
+    const std::string_view dir = directory_of(relativePath);
+
+    for (std::size_t pos = 0; pos < text.size();) {
+        const auto eol = std::min(text.find('\n', pos), text.size());
+        std::string_view line = text.substr(pos, eol - pos);
+        pos = eol + 1;
+
+        const auto first = line.find_first_not_of(" \t");
+        if (first == std::string_view::npos || line[first] != '#') {
+            continue;
+        }
+        line.remove_prefix(first + 1);
+        line.remove_prefix(std::min(line.find_first_not_of(" \t"), line.size()));
+        if (!line.starts_with("include")) {
+            continue;
+        }
+        line.remove_prefix(7);
+        line.remove_prefix(std::min(line.find_first_not_of(" \t"), line.size()));
+
+        if (line.empty() || (line.front() != '"' && line.front() != '<')) {
+            continue;
+        }
+        const char close = line.front() == '"' ? '"' : '>';
+        const auto end = line.find(close, 1);
+        if (end == std::string_view::npos) {
+            continue;
+        }
+
+        if (std::string key = resolve(dir, line.substr(1, end - 1)); !key.empty()) {
+            out.push_back(std::move(key));
+        }
+    }
+}
+
+bool is_path_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '-' ||
+           c == '.' || c == '/';
+}
+
+void scan_references(std::string_view text, std::vector<std::string>& out) {
+    for (std::size_t pos = 0; pos < text.size();) {
+        if (!is_path_char(text[pos])) {
+            ++pos;
+            continue;
+        }
+
+        std::size_t end = pos;
+        while (end < text.size() && is_path_char(text[end])) {
+            ++end;
+        }
+        const std::string_view token = text.substr(pos, end - pos);
+        pos = end;
+
+        if (asset_type_from_path(token) != AssetType::Unknown) {
+            if (std::string key = resolve({}, token); !key.empty()) {
+                out.push_back(std::move(key));
+            }
+        }
+    }
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Scanning
+// -----------------------------------------------------------------------------
+
+bool has_dependencies(AssetType type) {
+    return type == AssetType::Shader || type == AssetType::Material || type == AssetType::Scene;
+}
+
+void scan_dependencies(std::string_view relativePath, AssetType type, std::string_view text,
+                       std::vector<std::string>& out) {
+    out.clear();
+
+    switch (type) {
+        case AssetType::Shader:
+            scan_includes(relativePath, text, out);
+            break;
+        case AssetType::Material:
+        case AssetType::Scene:
+            scan_references(text, out);
+            break;
+        default:
+            return;
+    }
+
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+// -----------------------------------------------------------------------------
+// Graph
+// -----------------------------------------------------------------------------
+
+void DependencyGraph::set(const AssetID& dependent, std::vector<std::string> dependencies) {
+    if (dependencies.empty()) {
+        remove(dependent);
+        return;
+    }
+
+    auto [it, inserted] = m_forward.try_emplace(dependent);
+    if (!inserted) {
+        if (it->second == dependencies) {
+            return;
+        }
+        unlink(dependent, it->second);
+    }
+
+    for (const auto& path : dependencies) {
+        auto reverse = m_reverse.find(path);
+        if (reverse == m_reverse.end()) {
+            reverse = m_reverse.emplace(path, std::vector<AssetID>()).first;
+        }
+        reverse->second.push_back(dependent);
+    }
+    it->second = std::move(dependencies);
+}
+
+void DependencyGraph::remove(const AssetID& dependent) {
+    auto it = m_forward.find(dependent);
+    if (it == m_forward.end()) {
+        return;
+    }
+    unlink(dependent, it->second);
+    m_forward.erase(it);
+}
+
+void DependencyGraph::clear() {
+    m_forward.clear();
+    m_reverse.clear();
+}
+
+void DependencyGraph::unlink(const AssetID& dependent, const std::vector<std::string>& dependencies) {
+    for (const auto& path : dependencies) {
+        auto reverse = m_reverse.find(path);
+        if (reverse == m_reverse.end()) {
+            continue;
+        }
+
+        auto& dependents = reverse->second;
+        if (auto pos = std::find(dependents.begin(), dependents.end(), dependent); pos != dependents.end()) {
+            *pos = dependents.back();
+            dependents.pop_back();
+        }
+        if (dependents.empty()) {
+            m_reverse.erase(reverse);
+        }
+    }
+}
+
+std::span<const std::string> DependencyGraph::dependencies_of(const AssetID& dependent) const {
+    auto it = m_forward.find(dependent);
+    return it != m_forward.end() ? std::span<const std::string>(it->second) : std::span<const std::string>();
+}
+
+std::span<const AssetID> DependencyGraph::dependents_of(std::string_view path) const {
+    auto it = m_reverse.find(path);
+    return it != m_reverse.end() ? std::span<const AssetID>(it->second) : std::span<const AssetID>();
+}
+
+void DependencyGraph::collect_dependents(std::string_view path, const AssetTable& table,
+                                         std::vector<AssetTable::Slot>& out) const {
+    out.clear();
+
+    std::vector<bool> visited(table.slot_count());
+    std::vector<std::string_view> pending{path};
+
+    while (!pending.empty()) {
+        const std::string_view current = pending.back();
+        pending.pop_back();
+
+        for (const AssetID& id : dependents_of(current)) {
+            const AssetTable::Slot slot = table.find(id);
+            if (slot == AssetTable::kNone || visited[slot]) {
+                continue;
+            }
+            visited[slot] = true;
+            out.push_back(slot);
+            pending.push_back(table.path(slot));
+        }
+    }
+}
+
+void DependencyGraph::collect_dependencies(const AssetID& dependent, const AssetTable& table,
+                                           std::vector<std::string>& out) const {
+    out.clear();
+
+    std::unordered_set<std::string_view> seen;
+    std::vector<AssetID> pending{dependent};
+
+    while (!pending.empty()) {
+        const AssetID current = pending.back();
+        pending.pop_back();
+
+        for (const std::string& path : dependencies_of(current)) {
+            if (!seen.insert(path).second) {
+                continue;
+            }
+            out.push_back(path);
+
+            if (const AssetTable::Slot slot = table.find(path); slot != AssetTable::kNone) {
+                pending.push_back(table.id(slot));
+            }
+        }
+    }
+}
+
+} // namespace wave::engine::assets
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "asset_id.hpp"
+#include "asset_metadata.hpp"
+#include "asset_table.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace wave::engine::assets {
+
+// Which assets read which other files: material -> texture, shader ->
+// #include, scene -> mesh.
+//
+// Edges go from an asset (by AssetID, so they follow renames of the asset
+// itself) to a relative path: a reference names a path, and it keeps
+// naming it whether or not anything is there right now. Creating a file at
+// a referenced path therefore invalidates its dependents just like editing
+// it does. Both directions are indexed.
+//
+// Owned by AssetDatabase, which keeps it up to date and publishes it with
+// every AssetSnapshot.
+class DependencyGraph final {
+public:
+    bool empty() const { return m_forward.empty(); }
+
+    // Number of assets that have dependencies.
+    std::size_t size() const { return m_forward.size(); }
+
+    // Replaces the direct dependencies of 'dependent'; empty removes it.
+    void set(const AssetID& dependent, std::vector<std::string> dependencies);
+    void remove(const AssetID& dependent);
+    void clear();
+
+    // Direct edges.
+    std::span<const std::string> dependencies_of(const AssetID& dependent) const;
+    std::span<const AssetID>     dependents_of(std::string_view path) const;
+
+    // Every asset in 'table' that depends on 'path', directly or through
+    // other assets; each once, cycles included. Not the asset at 'path'
+    // itself, unless it is part of a cycle.
+    void collect_dependents(std::string_view path, const AssetTable& table, std::vector<AssetTable::Slot>& out) const;
+
+    // Every path 'dependent' reads, directly or through the assets at those
+    // paths; each once.
+    void collect_dependencies(const AssetID& dependent, const AssetTable& table, std::vector<std::string>& out) const;
+
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (const auto& [id, dependencies] : m_forward) {
+            fn(id, std::span<const std::string>(dependencies));
+        }
+    }
+
+private:
+    struct IDHash {
+        std::size_t operator()(const AssetID& id) const {
+            return static_cast<std::size_t>(id.hi ^ (id.lo * 0x9E3779B97F4A7C15ull));
+        }
+    };
+
+    struct PathHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view path) const { return std::hash<std::string_view>{}(path); }
+    };
+
+    void unlink(const AssetID& dependent, const std::vector<std::string>& dependencies);
+
+private:
+    std::unordered_map<AssetID, std::vector<std::string>, IDHash>               m_forward;
+    std::unordered_map<std::string, std::vector<AssetID>, PathHash, std::equal_to<>> m_reverse;
+};
+
+// References in one source file, as relative paths (generic, relative to the
+// asset root):
+//
+//   Shader             #include "file" / <file>, relative to the shader's
+//                      directory (how ShaderImporter resolves them)
+//   Material, Scene    every token that names a known asset type, e.g.
+//                      albedo = textures/wood.png; relative to the asset root
+//
+// Other types have no dependencies. References that leave the asset root
+// are dropped. Paths with spaces are not recognized in materials or scenes.
+bool has_dependencies(AssetType type);
+void scan_dependencies(std::string_view relativePath, AssetType type, std::string_view text,
+                       std::vector<std::string>& out);
+
+} // namespace wave::engine::assets
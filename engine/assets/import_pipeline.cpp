@@ -0,0 +1,391 @@
+#include "import_pipeline.hpp"
+#include "asset_database.hpp"
+
+#include "engine/core/filesystem/mapped_file.hpp"
+#include "engine/core/jobs/job_system.hpp"
+#include "engine/core/logging/log.hpp"
+#include "engine/core/utils/hash.hpp"
+
+#include <optional>
+#include <utility>
+
+namespace wave::engine::assets {
+
+namespace {
+
+// Lower-case extension (with the dot) of the last path component.
+std::string extension_of(std::string_view relativePath) {
+    const std::string_view name = relativePath.substr(relativePath.find_last_of('/') + 1);
+    const auto dot = name.find_last_of('.');
+    if (dot == std::string_view::npos || dot == 0) {
+        return {};
+    }
+
+    std::string ext(name.substr(dot));
+    for (char& c : ext) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    return ext;
+}
+
+std::uint64_t mix(std::uint64_t hash, std::uint64_t value) {
+    return core::utils::fnv1a_64(std::string_view(reinterpret_cast<const char*>(&value), sizeof(value)), hash);
+}
+
+// Cheap stand-in for the state of an asset's dependencies in 'table': it
+// changes whenever one of them is edited, created or removed.
+std::uint64_t dependency_stamp(const AssetTable& table, const std::vector<std::string>& dependencies) {
+    std::uint64_t stamp = 0;
+    for (const auto& path : dependencies) {
+        const AssetTable::Slot slot = table.find(path);
+        if (slot == AssetTable::kNone) {
+            stamp = mix(stamp, 0);
+            continue;
+        }
+        stamp = mix(stamp, table.file_size(slot));
+        stamp = mix(stamp, static_cast<std::uint64_t>(table.last_write_time(slot).time_since_epoch().count()));
+        stamp = mix(stamp, table.content_hash(slot));
+    }
+    return stamp;
+}
+
+// ArtifactKey::dependencyHash: the relative path and contents of each
+// dependency. Missing files hash as absent, so creating one changes the key.
+// known_dependency_hash() computes the same value from the database.
+std::uint64_t hash_dependencies(const fs::path& root, const std::vector<std::string>& dependencies) {
+    if (dependencies.empty()) {
+        return 0;
+    }
+
+    std::uint64_t hash = core::utils::kFnv1aOffset64;
+    for (const auto& path : dependencies) {
+        hash = core::utils::fnv1a_64(path, hash);
+
+        core::filesystem::MappedFile file;
+        if (file.open(root / path, core::filesystem::MapAccess::Sequential)) {
+            hash = mix(hash, 1);
+            hash = mix(hash, core::utils::fnv1a_64(file.text()));
+        } else {
+            hash = mix(hash, 0);
+        }
+    }
+    return hash;
+}
+
+// hash_dependencies() from the content hashes in 'table', without reading
+// anything; nullopt if one of them is not known there.
+std::optional<std::uint64_t> known_dependency_hash(const AssetTable& table, const std::vector<std::string>& dependencies) {
+    if (dependencies.empty()) {
+        return 0;
+    }
+
+    std::uint64_t hash = core::utils::kFnv1aOffset64;
+    for (const auto& path : dependencies) {
+        const AssetTable::Slot slot = table.find(path);
+        if (slot == AssetTable::kNone || table.content_hash(slot) == 0) {
+            return std::nullopt;
+        }
+        hash = core::utils::fnv1a_64(path, hash);
+        hash = mix(hash, 1);
+        hash = mix(hash, table.content_hash(slot));
+    }
+    return hash;
+}
+
+} // namespace
+
+ImportPipeline::ImportPipeline(AssetDatabase& database, const ArtifactCache& cache)
+    : m_database(database), m_cache(cache) {}
+
+ImportPipeline::~ImportPipeline() {
+    wait_idle();
+}
+
+void ImportPipeline::add_importer(std::unique_ptr<AssetImporter> importer) {
+    m_importers.push_back(std::move(importer));
+}
+
+const AssetImporter* ImportPipeline::importer_for(std::string_view relativePath) const {
+    const std::string ext = extension_of(relativePath);
+    if (ext.empty()) {
+        return nullptr;
+    }
+
+    for (const auto& importer : m_importers) {
+        if (importer->accepts(ext)) {
+            return importer.get();
+        }
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+// Scheduling
+// -----------------------------------------------------------------------------
+
+std::size_t ImportPipeline::update() {
+    flush_imported();
+
+    auto snapshot = m_database.snapshot();
+    {
+        std::scoped_lock lock(m_mutex);
+
+        // Nothing can have become due unless the database changed or a job
+        // finished (an asset edited while queued is picked up afterwards).
+        if (snapshot == m_lastSnapshot && !m_finishedSinceUpdate) {
+            return 0;
+        }
+        m_finishedSinceUpdate = false;
+    }
+    const auto previous = std::exchange(m_lastSnapshot, snapshot);
+
+    const AssetTable&      table = snapshot->table();
+    const DependencyGraph& graph = snapshot->dependencies();
+
+    std::vector<std::pair<Job, Attempt>> candidates;
+    std::vector<std::string> dependencies;
+    auto consider = [&](AssetRef asset) {
+        dependencies.clear();
+        if (!graph.dependencies_of(asset.id()).empty()) {
+            graph.collect_dependencies(asset.id(), table, dependencies);
+        }
+
+        const Attempt state{asset.file_size(), asset.last_write_time(), asset.content_hash(),
+                            dependency_stamp(table, dependencies)};
+
+        // Already imported (or failed) at this state: only a change brings it
+        // back. A dependency that changed while the asset was being imported
+        // counts even if the flag was cleared by that import. Assets that
+        // were never imported this session are checked once, which is a
+        // cache hit unless the cache is new.
+        if (auto it = m_attempts.find(asset.id()); it != m_attempts.end()) {
+            const bool due = asset.needs_reimport() || it->second.dependencyStamp != state.dependencyStamp;
+            if (!due || it->second == state) {
+                return;
+            }
+        }
+
+        const AssetImporter* importer = importer_for(asset.relative_path());
+        if (!importer) {
+            return;
+        }
+
+        Job job;
+        job.id             = asset.id();
+        job.relativePath   = std::string(asset.relative_path());
+        job.absolutePath   = asset.absolute_path();
+        job.type           = asset.type();
+        job.importer       = importer;
+        job.root           = snapshot->root();
+        job.dependencies   = dependencies;
+        job.contentHash    = asset.content_hash();
+        job.dependencyHash = known_dependency_hash(table, dependencies);
+        candidates.emplace_back(std::move(job), state);
+    };
+
+    // Only what changed since the last look (every flag change, including
+    // dependents invalidated by an edit, is a change), plus assets that were
+    // still being imported then. The whole snapshot the first time, or when
+    // the database can no longer say.
+    std::vector<AssetID> changed;
+    const bool incremental = previous && m_database.changes_since(previous->version(), changed);
+    if (incremental) {
+        changed.insert(changed.end(), m_deferred.begin(), m_deferred.end());
+
+        std::unordered_set<AssetID, HiLoHash> seen;
+        for (const AssetID& id : changed) {
+            if (!seen.insert(id).second) {
+                continue;
+            }
+            if (AssetRef asset = snapshot->find(id)) {
+                consider(asset);
+            } else {
+                m_attempts.erase(id);   // erased, or renamed to a new ID
+            }
+        }
+    } else {
+        for (AssetRef asset : *snapshot) {
+            consider(asset);
+        }
+        std::erase_if(m_attempts, [&](const auto& attempt) { return !snapshot->find(attempt.first); });
+    }
+    m_deferred.clear();
+
+    std::vector<Job> jobs;
+    {
+        std::scoped_lock lock(m_mutex);
+        for (auto& [job, state] : candidates) {
+            if (!m_queued.insert(job.id).second) {
+                m_deferred.push_back(job.id);   // looked at again once that import finishes
+                continue;
+            }
+            m_attempts[job.id] = state;
+            jobs.push_back(std::move(job));
+        }
+        m_pending += jobs.size();
+    }
+
+    const bool async = m_jobs && m_jobs->is_initialized();
+    for (auto& job : jobs) {
+        if (async) {
+            m_jobs->submit([this, job = std::move(job)]() { run(job); });
+        } else {
+            run(job);
+        }
+    }
+
+    return jobs.size();
+}
+
+void ImportPipeline::wait_idle() {
+    {
+        std::unique_lock lock(m_mutex);
+        m_idle.wait(lock, [this] { return m_pending == 0; });
+    }
+    flush_imported();
+}
+
+std::size_t ImportPipeline::pending() const {
+    std::scoped_lock lock(m_mutex);
+    return m_pending;
+}
+
+std::vector<ImportResult> ImportPipeline::take_results() {
+    std::scoped_lock lock(m_mutex);
+    return std::exchange(m_results, {});
+}
+
+std::optional<ArtifactHash> ImportPipeline::artifact(const AssetID& id) const {
+    std::scoped_lock lock(m_mutex);
+    auto it = m_artifacts.find(id);
+    return it != m_artifacts.end() ? std::optional<ArtifactHash>(it->second) : std::nullopt;
+}
+
+ImportPipeline::Stats ImportPipeline::stats() const {
+    std::scoped_lock lock(m_mutex);
+    return m_stats;
+}
+
+void ImportPipeline::flush_imported() {
+    std::vector<std::pair<AssetID, std::uint64_t>> imported;
+    {
+        std::scoped_lock lock(m_mutex);
+        imported.swap(m_imported);
+    }
+
+    if (!imported.empty()) {
+        m_database.mark_imported(imported);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Import job
+// -----------------------------------------------------------------------------
+
+void ImportPipeline::run(const Job& job) {
+    ImportResult result;
+    result.id           = job.id;
+    result.relativePath = job.relativePath;
+
+    ArtifactKey key;
+    key.importer        = job.importer->name();
+    key.importerVersion = job.importer->version();
+    key.settingsHash    = job.importer->settings_hash();
+
+    // With the hashes the database already has, an unchanged asset is a
+    // lookup: nothing is read.
+    bool cached = false;
+    if (job.contentHash != 0 && job.dependencyHash) {
+        key.sourceHash     = job.contentHash;
+        key.dependencyHash = *job.dependencyHash;
+        cached             = m_cache.contains(key.hash());
+    }
+
+    // Unknown, or a miss about to be cooked: key the bytes on disk now,
+    // which are the ones cook() gets, in case they changed since the scan.
+    core::filesystem::MappedFile source;
+    if (!cached) {
+        if (!source.open(job.absolutePath, core::filesystem::MapAccess::Sequential)) {
+            result.error = "cannot read " + job.absolutePath.string();
+            std::scoped_lock lock(m_mutex);
+            finish(job, 0, std::move(result));
+            return;
+        }
+        key.sourceHash     = core::utils::fnv1a_64(source.text());
+        key.dependencyHash = hash_dependencies(job.root, job.dependencies);
+    }
+
+    const ArtifactHash hash = key.hash();
+    result.artifact = hash;
+
+    {
+        // Someone is cooking this exact key right now: let that job finish
+        // this one too.
+        std::scoped_lock lock(m_mutex);
+        auto [it, first] = m_inFlight.try_emplace(hash);
+        if (!first) {
+            it->second.push_back(Joiner{job, key.sourceHash});
+            return;
+        }
+    }
+
+    if (cached || m_cache.contains(hash)) {
+        result.success = true;
+        result.cached  = true;
+    } else {
+        ImportSource input;
+        input.relativePath = job.relativePath;
+        input.absolutePath = job.absolutePath;
+        input.type         = job.type;
+        input.bytes        = source.bytes();
+
+        std::vector<std::uint8_t> cooked;
+        if (job.importer->cook(input, cooked, result.error)) {
+            result.success = m_cache.store(hash, cooked);
+            if (!result.success) {
+                result.error = "cannot write " + m_cache.path_of(hash).string();
+            }
+        }
+    }
+
+    std::scoped_lock lock(m_mutex);
+
+    auto joiners = std::move(m_inFlight[hash]);
+    m_inFlight.erase(hash);
+
+    for (auto& joiner : joiners) {
+        ImportResult joined;
+        joined.id           = joiner.job.id;
+        joined.relativePath = joiner.job.relativePath;
+        joined.artifact     = hash;
+        joined.success      = result.success;
+        joined.cached       = result.success;
+        joined.error        = result.error;
+        finish(joiner.job, joiner.sourceHash, std::move(joined));
+    }
+
+    finish(job, key.sourceHash, std::move(result));
+}
+
+void ImportPipeline::finish(const Job& job, std::uint64_t sourceHash, ImportResult result) {
+    if (result.success) {
+        m_artifacts[job.id] = result.artifact;
+        m_imported.emplace_back(job.id, sourceHash);
+        ++(result.cached ? m_stats.cacheHits : m_stats.cooked);
+    } else {
+        ++m_stats.failed;
+        WAVE_LOG_CH_WARN(Assets, "Import failed: ", job.relativePath, ": ", result.error);
+    }
+
+    m_queued.erase(job.id);
+    m_results.push_back(std::move(result));
+    m_finishedSinceUpdate = true;
+
+    if (--m_pending == 0) {
+        m_idle.notify_all();
+    }
+}
+
+} // namespace wave::engine::assets
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "artifact_cache.hpp"
+#include "asset_id.hpp"
+#include "asset_importer.hpp"
+#include "asset_snapshot.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace wave::engine::core::jobs {
+class JobSystem;
+}
+
+namespace wave::engine::assets {
+
+class AssetDatabase;
+
+// Outcome of importing one asset, handed out by take_results().
+struct ImportResult {
+    AssetID      id;
+    std::string  relativePath;
+    ArtifactHash artifact;        // valid on success
+    bool         success{false};
+    bool         cached{false};   // artifact already existed; nothing was cooked
+    std::string  error;
+};
+
+// Cooks source assets into runtime artifacts in the background.
+//
+// update() picks every asset the database flags needsReimport (and every
+// asset not yet imported this session), and imports it on the JobSystem.
+// After the first call it only looks at the assets the database reports
+// changed since (AssetDatabase::changes_since()), not the whole project:
+// the ArtifactKey (content hashes of the source and everything it reads
+// (DependencyGraph), importer name/version/settings) is looked up in the
+// ArtifactCache. The content hashes come from the database where it has
+// them, so a warm start reads no sources; only a miss (or an unknown hash)
+// reads and rehashes the files, and only a miss is cooked. Jobs that
+// arrive at the same key while it is being cooked wait for that cook
+// instead of starting their own, so identical inputs are cooked at most
+// once per cache, not once per asset.
+//
+// On success artifact() returns the new hash, and the next update() clears
+// the database flags of everything imported since, in one batch (unless the
+// file changed again meanwhile). A failed asset is not retried until its
+// file changes.
+//
+//   ImportPipeline pipeline(database, cache);
+//   pipeline.add_importer(std::make_unique<TextureImporter>());
+//   pipeline.set_job_system(&jobs);
+//   ...
+//   pipeline.update();                      // e.g. once per frame
+//   for (auto& result : pipeline.take_results()) { ... }
+class ImportPipeline final {
+public:
+    // Both must outlive the pipeline.
+    ImportPipeline(AssetDatabase& database, const ArtifactCache& cache);
+    ~ImportPipeline();
+
+    ImportPipeline(const ImportPipeline&) = delete;
+    ImportPipeline& operator=(const ImportPipeline&) = delete;
+
+    ImportPipeline(ImportPipeline&&) noexcept = delete;
+    ImportPipeline& operator=(ImportPipeline&&) noexcept = delete;
+
+    // Not while imports are running. The first importer that accepts an
+    // extension wins.
+    void add_importer(std::unique_ptr<AssetImporter> importer);
+
+    // Jobs run here; null (the default) imports on the calling thread inside
+    // update(). Must outlive the pipeline or be reset.
+    void set_job_system(core::jobs::JobSystem* jobs) { m_jobs = jobs; }
+
+    // Queue everything that needs importing; returns how many were queued.
+    std::size_t update();
+
+    // Block until every queued import has finished, then clear their flags.
+    void wait_idle();
+
+    std::size_t pending() const;
+
+    // Results since the last call, in completion order.
+    std::vector<ImportResult> take_results();
+
+    // Latest artifact imported for 'id' this session.
+    std::optional<ArtifactHash> artifact(const AssetID& id) const;
+
+    struct Stats {
+        std::uint64_t cooked{0};
+        std::uint64_t cacheHits{0};   // includes jobs that joined an in-flight cook
+        std::uint64_t failed{0};
+    };
+
+    Stats stats() const;
+
+private:
+    struct Job {
+        AssetID              id;
+        std::string          relativePath;
+        fs::path             absolutePath;
+        AssetType            type{AssetType::Unknown};
+        const AssetImporter* importer{nullptr};
+        fs::path             root;
+        std::vector<std::string> dependencies;  // transitive, relative to root
+
+        // From the database when it has them; 0 / nullopt = read the files.
+        std::uint64_t                contentHash{0};
+        std::optional<std::uint64_t> dependencyHash;
+    };
+
+    // A job waiting on another job's cook of the same key.
+    struct Joiner {
+        Job           job;
+        std::uint64_t sourceHash{0};
+    };
+
+    struct HiLoHash {
+        template <typename T>
+        std::size_t operator()(const T& value) const {
+            return static_cast<std::size_t>(value.hi ^ (value.lo * 0x9E3779B97F4A7C15ull));
+        }
+    };
+
+    // File state an asset (and what it depends on) was last queued with.
+    struct Attempt {
+        std::uint64_t      fileSize{0};
+        fs::file_time_type lastWrite{};
+        std::uint64_t      contentHash{0};
+        std::uint64_t      dependencyStamp{0};
+
+        bool operator==(const Attempt&) const = default;
+    };
+
+    const AssetImporter* importer_for(std::string_view relativePath) const;
+
+    void run(const Job& job);
+    void finish(const Job& job, std::uint64_t sourceHash, ImportResult result);   // m_mutex held
+    void flush_imported();
+
+private:
+    AssetDatabase&       m_database;
+    const ArtifactCache& m_cache;
+
+    std::vector<std::unique_ptr<AssetImporter>> m_importers;
+
+    core::jobs::JobSystem* m_jobs{nullptr};
+
+    mutable std::mutex      m_mutex;
+    std::condition_variable m_idle;
+
+    std::size_t                                                     m_pending{0};
+    std::unordered_set<AssetID, HiLoHash>                           m_queued;   // no second job per asset
+    std::unordered_map<AssetID, ArtifactHash, HiLoHash>             m_artifacts;
+    std::unordered_map<ArtifactHash, std::vector<Joiner>, HiLoHash> m_inFlight;
+    std::vector<std::pair<AssetID, std::uint64_t>>                  m_imported; // for the next flush
+    std::vector<ImportResult>                                       m_results;
+    Stats                                                           m_stats;
+    bool                                                            m_finishedSinceUpdate{false};
+
+    // update() thread only. m_attempts holds assets of the last snapshot.
+    std::shared_ptr<const AssetSnapshot>           m_lastSnapshot;
+    std::unordered_map<AssetID, Attempt, HiLoHash> m_attempts;
+    std::vector<AssetID>                           m_deferred;   // due while still queued
+};
+
+} // namespace wave::engine::assets
@@ -11,8 +11,34 @@
 //   -D WAVE_INTERNAL_BUILD=ON
 //   -D WAVE_ENABLE_LOGGING=ON
 //   -D WAVE_ENABLE_ASSERTS=ON
+//   -D WAVE_LOG_COMPILE_LEVEL=2
 //
 
+// Log level values usable from the preprocessor.
+// They mirror wave::engine::core::logging::LogLevel, plus an "off" value.
+#define WAVE_LOG_LEVEL_TRACE    0
+#define WAVE_LOG_LEVEL_DEBUG    1
+#define WAVE_LOG_LEVEL_INFO     2
+#define WAVE_LOG_LEVEL_WARN     3
+#define WAVE_LOG_LEVEL_ERROR    4
+#define WAVE_LOG_LEVEL_CRITICAL 5
+#define WAVE_LOG_LEVEL_OFF      6
+
+// Minimum log level compiled into the binary.
+// Defaults:
+//   - Everything in Debug
+//   - Info and above in Release (shipping builds pay nothing for trace/debug)
+//   - Nothing when WAVE_ENABLE_LOGGING=0
+#if !defined(WAVE_LOG_COMPILE_LEVEL)
+    #if defined(WAVE_ENABLE_LOGGING) && !WAVE_ENABLE_LOGGING
+        #define WAVE_LOG_COMPILE_LEVEL WAVE_LOG_LEVEL_OFF
+    #elif !defined(NDEBUG)
+        #define WAVE_LOG_COMPILE_LEVEL WAVE_LOG_LEVEL_TRACE
+    #else
+        #define WAVE_LOG_COMPILE_LEVEL WAVE_LOG_LEVEL_INFO
+    #endif
+#endif
+
 namespace wave::engine::core::build
 {
     // Internal vs public build
@@ -32,17 +58,23 @@ namespace wave::engine::core::build
     //
     // Logging can be enabled or disabled at compile time.
     // Defaults:
-    //   - Enabled in Debug / RelWithDebInfo
-    //   - Can be disabled in Release for performance if desired.
+    //   - Enabled whenever WAVE_LOG_COMPILE_LEVEL (below) keeps any level.
+    //   - Release keeps Info and above; Trace / Debug are stripped.
 
 #if defined(WAVE_ENABLE_LOGGING)
     constexpr bool kLoggingEnabled = (WAVE_ENABLE_LOGGING != 0);
-#elif !defined(NDEBUG)
-    constexpr bool kLoggingEnabled = true;
 #else
-    constexpr bool kLoggingEnabled = true; // change to false if you want silent Release
+    constexpr bool kLoggingEnabled = (WAVE_LOG_COMPILE_LEVEL < WAVE_LOG_LEVEL_OFF);
 #endif
 
+    // Compile-time log level
+    // ----------------------
+    //
+    // Lowest level that is compiled into the binary at all. WAVE_LOG_*
+    // macros below it expand to nothing and never evaluate their arguments.
+
+    constexpr int kLogCompileLevel = WAVE_LOG_COMPILE_LEVEL;
+
     // Assert toggle
     // -------------
     //
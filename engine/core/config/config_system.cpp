@@ -1,6 +1,7 @@
 #include "config_system.hpp"
 
-#include <fstream>
+#include "engine/core/filesystem/mapped_file.hpp"
+
 #include <sstream>
 #include <charconv>
 #include <algorithm>
@@ -221,17 +222,29 @@ bool ConfigSystem::load_from_file(const fs::path& path, ConfigFormat format) {
     return load_simple_format(path);
 }
 
+bool ConfigSystem::load_from_memory(std::string_view text, ConfigFormat format) {
+    // For now, all formats use the same simple parser.
+    (void)format;
+    return parse_simple_format(text);
+}
+
 bool ConfigSystem::load_simple_format(const fs::path& path) {
-    std::ifstream file(path);
-    if (!file) {
+    // Parsed straight out of the mapping; no copy of the file text.
+    filesystem::MappedFile file;
+    if (!file.open(path)) {
         return false;
     }
 
+    return parse_simple_format(file.text());
+}
+
+bool ConfigSystem::parse_simple_format(std::string_view text) {
     m_table = ConfigTable{};
 
-    std::string line;
-    while (std::getline(file, line)) {
-        std::string_view sv(line);
+    while (!text.empty()) {
+        const std::size_t lineEnd = text.find('\n');
+        std::string_view sv = text.substr(0, lineEnd);
+        text.remove_prefix(lineEnd == std::string_view::npos ? text.size() : lineEnd + 1);
 
         // Strip comments starting with # or //
         if (auto pos = sv.find('#'); pos != std::string_view::npos) {
@@ -99,6 +99,10 @@ public:
     // proper parsers without changing this API.
     bool load_from_file(const fs::path& path, ConfigFormat format = ConfigFormat::Auto);
 
+    // Same as load_from_file for text already in memory, e.g. a mapped
+    // resource (ResourceSystem::map_binary) or an archive entry.
+    bool load_from_memory(std::string_view text, ConfigFormat format = ConfigFormat::Simple);
+
     const ConfigTable& table() const { return m_table; }
           ConfigTable& table()       { return m_table; }
 
@@ -111,6 +115,7 @@ public:
 
 private:
     bool load_simple_format(const fs::path& path);
+    bool parse_simple_format(std::string_view text);
 
 private:
     ConfigTable m_table;
@@ -59,4 +59,9 @@ namespace wave::engine::core::environment
         return m_engine_root / "tools";
     }
 
+    fs::path Environment::cache_path() const
+    {
+        return m_engine_root / "cache";
+    }
+
 } // namespace wave::engine::core::environment
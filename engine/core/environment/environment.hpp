@@ -28,6 +28,7 @@ namespace wave::engine::core::environment
         [[nodiscard]] fs::path resources_path() const;   // engine_root/resources/
         [[nodiscard]] fs::path editor_path() const;      // engine_root/editor/
         [[nodiscard]] fs::path tools_path() const;       // engine_root/tools/
+        [[nodiscard]] fs::path cache_path() const;       // engine_root/cache/
 
     private:
         fs::path m_engine_root;
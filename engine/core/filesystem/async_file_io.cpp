@@ -0,0 +1,718 @@
+#include "async_file_io.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <span>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+    #define WAVE_IO_URING_AVAILABLE 1
+    #include <fcntl.h>
+    #include <linux/io_uring.h>
+    #include <linux/stat.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#else
+    #define WAVE_IO_URING_AVAILABLE 0
+#endif
+
+namespace wave::engine::core::filesystem {
+
+// -----------------------------------------------------------------------------
+// ReadAwaitable
+// -----------------------------------------------------------------------------
+
+void ReadAwaitable::await_suspend(std::coroutine_handle<> handle) {
+    // May complete (and resume) before read() returns; nothing touches
+    // 'this' after the call.
+    m_io->read(std::move(m_request), [this, handle](ReadResult&& result) {
+        m_result = std::move(result);
+        handle.resume();
+    });
+}
+
+// -----------------------------------------------------------------------------
+// io_uring plumbing (raw syscalls, no liburing dependency)
+// -----------------------------------------------------------------------------
+
+#if WAVE_IO_URING_AVAILABLE
+
+struct AsyncFileIO::Ring {
+    int fd{-1};
+
+    void*         sqPtr{nullptr};
+    std::size_t   sqSize{0};
+    void*         cqPtr{nullptr};
+    std::size_t   cqSize{0};
+    io_uring_sqe* sqes{nullptr};
+    std::size_t   sqesSize{0};
+
+    unsigned* sqHead{nullptr};
+    unsigned* sqTail{nullptr};
+    unsigned* sqArray{nullptr};
+    unsigned  sqMask{0};
+    unsigned  sqEntries{0};
+
+    unsigned*     cqHead{nullptr};
+    unsigned*     cqTail{nullptr};
+    io_uring_cqe* cqes{nullptr};
+    unsigned      cqMask{0};
+    unsigned      cqEntries{0};
+
+    ~Ring() {
+        if (sqes) {
+            ::munmap(sqes, sqesSize);
+        }
+        if (cqPtr && cqPtr != sqPtr) {
+            ::munmap(cqPtr, cqSize);
+        }
+        if (sqPtr) {
+            ::munmap(sqPtr, sqSize);
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    int enter(unsigned toSubmit, unsigned minComplete, unsigned flags) const {
+        for (;;) {
+            const long ret = ::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0);
+            if (ret >= 0 || errno != EINTR) {
+                return static_cast<int>(ret);
+            }
+        }
+    }
+
+    // Caller serializes producers. Returns null if the queue is full.
+    io_uring_sqe* next_sqe() {
+        const unsigned head = std::atomic_ref<unsigned>(*sqHead).load(std::memory_order_acquire);
+        const unsigned tail = *sqTail;
+        if (tail - head >= sqEntries) {
+            return nullptr;
+        }
+
+        const unsigned index = tail & sqMask;
+        io_uring_sqe* sqe = &sqes[index];
+        *sqe = io_uring_sqe{};
+        sqArray[index] = index;
+        std::atomic_ref<unsigned>(*sqTail).store(tail + 1, std::memory_order_release);
+        return sqe;
+    }
+};
+
+// One read request. Whole-file reads first statx the path; then the file is
+// read by one linked chain on a direct (registered) descriptor:
+//
+//   OPENAT -> READ ... READ -> CLOSE
+//
+// so every request costs at most two trips through the ring, and all chains
+// of a batch go in with one io_uring_enter. Reads are hard links: a failed
+// or short read never cancels the CLOSE. A failed OPENAT cancels the rest.
+//
+// Aligned so the low bits of user_data can say which SQE a CQE is for.
+struct alignas(64) AsyncFileIO::Op {
+    enum class Stage {
+        Stat,
+        Read
+    };
+
+    // user_data tags.
+    static constexpr std::uint64_t kTagMask  = 63;
+    static constexpr std::uint64_t kTagStat  = 0;
+    static constexpr std::uint64_t kTagOpen  = 1;
+    static constexpr std::uint64_t kTagClose = 2;
+    static constexpr std::uint64_t kTagRead  = 3;   // + chunk index
+
+    // One READ moves at most this much.
+    static constexpr std::uint64_t kChunk     = 1ull << 30;
+    static constexpr std::uint64_t kMaxChunks = kTagMask - kTagRead + 1;
+
+    Stage         stage{Stage::Read};
+    ReadRequest   request;
+    std::string   nativePath;
+    struct statx  stx{};
+    std::uint32_t fileSlot{0};
+    std::uint64_t want{0};
+    std::uint64_t valid{~0ull};      // bytes read before the first short read
+    std::uint32_t outstanding{0};    // CQEs still expected for the chain
+    ReadResult    result;
+    ReadCallback  callback;
+
+    std::uint64_t chunks() const { return (want + kChunk - 1) / kChunk; }
+
+    // SQEs (and CQEs) the current stage takes.
+    std::uint32_t sqe_count() const {
+        return stage == Stage::Stat ? 1u : static_cast<std::uint32_t>(chunks() + 2);
+    }
+
+    void fail(int err) {
+        if (!result.error) {
+            result.error = std::error_code(err, std::system_category());
+        }
+    }
+};
+
+namespace {
+
+constexpr std::uint64_t kWakeUserData = ~0ull;
+
+bool probe_ops(int ringFd) {
+    constexpr unsigned kOps = 256;
+
+    std::vector<std::uint8_t> storage(sizeof(io_uring_probe) + kOps * sizeof(io_uring_probe_op));
+    auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+
+    if (::syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_PROBE, probe, kOps) < 0) {
+        return false;
+    }
+
+    for (unsigned op : { IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_CLOSE }) {
+        if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool AsyncFileIO::start_ring(std::uint32_t queueDepth) {
+    io_uring_params params{};
+    const long fd = ::syscall(__NR_io_uring_setup, std::max<std::uint32_t>(queueDepth, 8u), &params);
+    if (fd < 0) {
+        return false; // ENOSYS, EPERM (seccomp / io_uring_disabled), ...
+    }
+
+    auto ring = std::make_unique<Ring>();
+    ring->fd = static_cast<int>(fd);
+
+    // Opening into and closing direct descriptors (5.15) is what lets a whole
+    // read be one linked chain. There is no feature bit for it; CQE_SKIP
+    // (5.17) stands in for "new enough".
+#if defined(IORING_FEAT_CQE_SKIP)
+    if (!(params.features & IORING_FEAT_CQE_SKIP) || !probe_ops(ring->fd)) {
+        return false;
+    }
+#else
+    return false;
+#endif
+
+    ring->sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMmap) {
+        ring->sqSize = ring->cqSize = std::max(ring->sqSize, ring->cqSize);
+    }
+
+    void* sq = ::mmap(nullptr, ring->sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring->fd, IORING_OFF_SQ_RING);
+    if (sq == MAP_FAILED) {
+        return false;
+    }
+    ring->sqPtr = sq;
+
+    if (singleMmap) {
+        ring->cqPtr = sq;
+    } else {
+        void* cq = ::mmap(nullptr, ring->cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          ring->fd, IORING_OFF_CQ_RING);
+        if (cq == MAP_FAILED) {
+            return false;
+        }
+        ring->cqPtr = cq;
+    }
+
+    ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = ::mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring->fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        return false;
+    }
+    ring->sqes = static_cast<io_uring_sqe*>(sqes);
+
+    auto* sqBase = static_cast<char*>(ring->sqPtr);
+    ring->sqHead    = reinterpret_cast<unsigned*>(sqBase + params.sq_off.head);
+    ring->sqTail    = reinterpret_cast<unsigned*>(sqBase + params.sq_off.tail);
+    ring->sqArray   = reinterpret_cast<unsigned*>(sqBase + params.sq_off.array);
+    ring->sqMask    = *reinterpret_cast<unsigned*>(sqBase + params.sq_off.ring_mask);
+    ring->sqEntries = params.sq_entries;
+
+    auto* cqBase = static_cast<char*>(ring->cqPtr);
+    ring->cqHead    = reinterpret_cast<unsigned*>(cqBase + params.cq_off.head);
+    ring->cqTail    = reinterpret_cast<unsigned*>(cqBase + params.cq_off.tail);
+    ring->cqes      = reinterpret_cast<io_uring_cqe*>(cqBase + params.cq_off.cqes);
+    ring->cqMask    = *reinterpret_cast<unsigned*>(cqBase + params.cq_off.ring_mask);
+    ring->cqEntries = params.cq_entries;
+
+    // Every SQE yields exactly one CQE; keep one slot for the shutdown
+    // wake-up so the completion queue can never overflow.
+    m_maxInFlight = std::min(ring->sqEntries, ring->cqEntries) - 1;
+
+    // One direct descriptor per chain in flight, which also caps the files
+    // open at once. Registered empty (-1) and filled by OPENAT.
+    const std::uint32_t fileSlots = std::max<std::uint32_t>(m_maxInFlight / 3, 1u);
+    std::vector<int> empty(fileSlots, -1);
+    if (::syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_FILES, empty.data(), fileSlots) < 0) {
+        return false;
+    }
+
+    m_freeFiles.clear();
+    for (std::uint32_t slot = fileSlots; slot > 0; --slot) {
+        m_freeFiles.push_back(slot - 1);
+    }
+    m_ring = std::move(ring);
+
+    m_ringThread = std::jthread([this](std::stop_token stopToken) {
+        ring_loop(stopToken);
+    });
+    return true;
+}
+
+AsyncFileIO::Op* AsyncFileIO::make_op(ReadRequest request, ReadCallback callback) {
+    auto op = std::make_unique<Op>();
+    op->nativePath  = request.path.string();
+    op->request     = std::move(request);
+    op->callback    = std::move(callback);
+    op->result.data = std::move(op->request.buffer);
+
+    if (op->request.size > max_chain_bytes()) {
+        op->fail(EFBIG);   // more than one chain can read; never hand back a short buffer
+    } else if (op->request.size > 0) {
+        op->want = op->request.size;
+        op->result.data.resize(op->want);
+    } else {
+        op->stage = Op::Stage::Stat;
+    }
+    return op.release();
+}
+
+std::uint64_t AsyncFileIO::max_chain_bytes() const {
+    // A chain must fit the ring on its own (open + reads + close) and its
+    // chunk index must fit the user_data tag.
+    const std::uint64_t chunks = std::min<std::uint64_t>(Op::kMaxChunks, m_maxInFlight - 2);
+    return chunks * Op::kChunk;
+}
+
+bool AsyncFileIO::ring_fits(const Op* op) const {
+    // Caller holds m_submitMutex.
+    return m_inFlight + op->sqe_count() <= m_maxInFlight &&
+           (op->stage == Op::Stage::Stat || !m_freeFiles.empty());
+}
+
+void AsyncFileIO::ring_submit(Op* op) {
+    // Caller holds m_submitMutex and checked ring_fits(). next_sqe() cannot
+    // fail: SQEs in flight never exceed m_maxInFlight.
+    const auto base = reinterpret_cast<std::uint64_t>(op);
+    m_inFlight += op->sqe_count();
+
+    if (op->stage == Op::Stage::Stat) {
+        io_uring_sqe* sqe = m_ring->next_sqe();
+        sqe->opcode    = IORING_OP_STATX;
+        sqe->fd        = AT_FDCWD;
+        sqe->addr      = reinterpret_cast<std::uint64_t>(op->nativePath.c_str());
+        sqe->len       = STATX_SIZE;
+        sqe->off       = reinterpret_cast<std::uint64_t>(&op->stx);
+        sqe->user_data = base | Op::kTagStat;
+        return;
+    }
+
+    op->fileSlot = m_freeFiles.back();
+    m_freeFiles.pop_back();
+    op->outstanding = op->sqe_count();
+
+    io_uring_sqe* open = m_ring->next_sqe();
+    open->opcode     = IORING_OP_OPENAT;
+    open->fd         = AT_FDCWD;
+    open->addr       = reinterpret_cast<std::uint64_t>(op->nativePath.c_str());
+    open->open_flags = O_RDONLY;   // no O_CLOEXEC: not a real fd, and rejected for direct opens
+    open->file_index = op->fileSlot + 1;
+    open->flags      = IOSQE_IO_LINK;
+    open->user_data  = base | Op::kTagOpen;
+
+    for (std::uint64_t chunk = 0; chunk < op->chunks(); ++chunk) {
+        const std::uint64_t start = chunk * Op::kChunk;
+
+        io_uring_sqe* read = m_ring->next_sqe();
+        read->opcode    = IORING_OP_READ;
+        read->fd        = static_cast<int>(op->fileSlot);
+        read->flags     = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK;
+        read->addr      = reinterpret_cast<std::uint64_t>(op->result.data.data() + start);
+        read->len       = static_cast<std::uint32_t>(std::min(Op::kChunk, op->want - start));
+        read->off       = op->request.offset + start;
+        read->user_data = base | (Op::kTagRead + chunk);
+    }
+
+    io_uring_sqe* close = m_ring->next_sqe();
+    close->opcode     = IORING_OP_CLOSE;
+    close->file_index = op->fileSlot + 1;
+    close->user_data  = base | Op::kTagClose;
+}
+
+bool AsyncFileIO::ring_advance(Op* op, std::uint64_t tag, std::int32_t res) {
+    if (tag == Op::kTagStat) {
+        if (res < 0) {
+            op->fail(-res);
+            return true;
+        }
+
+        op->want = op->stx.stx_size > op->request.offset ? op->stx.stx_size - op->request.offset : 0;
+        if (op->want > max_chain_bytes()) {
+            op->fail(EFBIG);
+            return true;
+        }
+        op->result.data.resize(op->want);
+        op->stage = Op::Stage::Read;
+        return op->want == 0;
+    }
+
+    if (tag == Op::kTagOpen) {
+        if (res < 0) {
+            op->fail(-res);   // the reads and the close come back cancelled
+        }
+    } else if (tag >= Op::kTagRead) {
+        const std::uint64_t start = (tag - Op::kTagRead) * Op::kChunk;
+        const std::uint64_t len   = std::min(Op::kChunk, op->want - start);
+
+        if (res < 0) {
+            if (res != -ECANCELED) {
+                op->fail(-res);
+            }
+            op->valid = std::min(op->valid, start);
+        } else if (static_cast<std::uint64_t>(res) < len) {
+            op->valid = std::min(op->valid, start + static_cast<std::uint64_t>(res));   // file shrank / past EOF
+        }
+    }
+
+    return --op->outstanding == 0;
+}
+
+std::uint32_t AsyncFileIO::drain_backlog() {
+    // Caller holds m_submitMutex. Returns the number of SQEs queued.
+    std::uint32_t queued = 0;
+    while (!m_backlog.empty() && ring_fits(m_backlog.front())) {
+        Op* op = m_backlog.front();
+        m_backlog.pop_front();
+        queued += op->sqe_count();
+        ring_submit(op);
+    }
+    return queued;
+}
+
+void AsyncFileIO::ring_enqueue(std::span<Op* const> ops) {
+    std::vector<Op*> rejected;   // failed in make_op, nothing to submit
+
+    {
+        std::scoped_lock lock(m_submitMutex);
+        for (Op* op : ops) {
+            if (op->result.error) {
+                rejected.push_back(op);
+            } else {
+                m_backlog.push_back(op);
+            }
+        }
+
+        // One syscall for the whole batch.
+        if (const std::uint32_t queued = drain_backlog(); queued > 0) {
+            m_ring->enter(queued, 0, 0);
+        }
+    }
+
+    for (Op* op : rejected) {
+        ring_complete(op);
+    }
+}
+
+void AsyncFileIO::ring_loop(std::stop_token stopToken) {
+    std::vector<Op*> next;       // stat done, chain to submit
+    std::vector<Op*> finished;
+
+    while (!stopToken.stop_requested()) {
+        if (m_ring->enter(0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EBUSY) {
+            continue;
+        }
+
+        // Single consumer: only this thread touches the CQ head.
+        unsigned head = *m_ring->cqHead;
+        const unsigned tail = std::atomic_ref<unsigned>(*m_ring->cqTail).load(std::memory_order_acquire);
+
+        std::uint32_t reaped = 0;
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = m_ring->cqes[head & m_ring->cqMask];
+            if (cqe.user_data == kWakeUserData) {
+                continue;
+            }
+            ++reaped;
+
+            Op* op = reinterpret_cast<Op*>(cqe.user_data & ~Op::kTagMask);
+            const Op::Stage before = op->stage;
+            if (ring_advance(op, cqe.user_data & Op::kTagMask, cqe.res)) {
+                finished.push_back(op);
+            } else if (before == Op::Stage::Stat) {
+                next.push_back(op);
+            }
+        }
+
+        std::atomic_ref<unsigned>(*m_ring->cqHead).store(head, std::memory_order_release);
+
+        if (reaped == 0) {
+            continue;
+        }
+
+        {
+            std::scoped_lock lock(m_submitMutex);
+
+            m_inFlight -= reaped;
+            for (Op* op : finished) {
+                if (op->stage == Op::Stage::Read && op->want > 0) {
+                    m_freeFiles.push_back(op->fileSlot);
+                }
+            }
+
+            // Files already stat'ed go ahead of new requests.
+            m_backlog.insert(m_backlog.begin(), next.begin(), next.end());
+
+            if (const std::uint32_t queued = drain_backlog(); queued > 0) {
+                m_ring->enter(queued, 0, 0);
+            }
+        }
+        next.clear();
+
+        for (Op* op : finished) {
+            ring_complete(op);
+        }
+        finished.clear();
+    }
+}
+
+void AsyncFileIO::ring_complete(Op* op) {
+    std::unique_ptr<Op> owned(op);
+    owned->result.path = std::move(owned->request.path);
+
+    if (owned->result.error) {
+        owned->result.data.clear();
+    } else if (owned->valid < owned->result.data.size()) {
+        owned->result.data.resize(owned->valid);
+    }
+
+    if (owned->callback) {
+        owned->callback(std::move(owned->result));
+    }
+    finish_one();
+}
+
+#else // !WAVE_IO_URING_AVAILABLE
+
+struct AsyncFileIO::Ring {};
+struct AsyncFileIO::Op {};
+
+bool AsyncFileIO::start_ring(std::uint32_t) { return false; }
+void AsyncFileIO::ring_loop(std::stop_token) {}
+AsyncFileIO::Op* AsyncFileIO::make_op(ReadRequest, ReadCallback) { return nullptr; }
+std::uint64_t AsyncFileIO::max_chain_bytes() const { return 0; }
+bool AsyncFileIO::ring_fits(const Op*) const { return false; }
+void AsyncFileIO::ring_submit(Op*) {}
+bool AsyncFileIO::ring_advance(Op*, std::uint64_t, std::int32_t) { return false; }
+void AsyncFileIO::ring_enqueue(std::span<Op* const>) {}
+void AsyncFileIO::ring_complete(Op*) {}
+std::uint32_t AsyncFileIO::drain_backlog() { return 0; }
+
+#endif
+
+// -----------------------------------------------------------------------------
+// AsyncFileIO
+// -----------------------------------------------------------------------------
+
+AsyncFileIO::AsyncFileIO() = default;
+
+AsyncFileIO::~AsyncFileIO() {
+    shutdown();
+}
+
+void AsyncFileIO::initialize(jobs::JobSystem* jobs, std::uint32_t queueDepth, bool allowIoUring) {
+    if (m_initialized) {
+        return;
+    }
+
+    m_jobs = jobs;
+
+    if (allowIoUring && start_ring(queueDepth)) {
+        m_backend = Backend::IoUring;
+    } else {
+        m_ring.reset();
+        m_backend = (jobs && jobs->is_initialized()) ? Backend::ThreadPool : Backend::Inline;
+    }
+
+    m_initialized = true;
+}
+
+void AsyncFileIO::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    // Let queued work finish. Pool jobs only run while the JobSystem does,
+    // and a JobSystem shut down under us drops its queue without a word, so
+    // the wait still wakes now and then to check on it.
+    {
+        std::unique_lock lock(m_idleMutex);
+        while (m_pending.load(std::memory_order_acquire) > 0) {
+            if (m_backend == Backend::ThreadPool && !(m_jobs && m_jobs->is_initialized())) {
+                break;
+            }
+            m_idleCv.wait_for(lock, std::chrono::milliseconds(10));
+        }
+    }
+
+#if WAVE_IO_URING_AVAILABLE
+    if (m_ringThread.joinable()) {
+        m_ringThread.request_stop();
+        {
+            std::scoped_lock lock(m_submitMutex);
+            if (io_uring_sqe* sqe = m_ring->next_sqe()) {
+                sqe->opcode    = IORING_OP_NOP;
+                sqe->user_data = kWakeUserData;
+                m_ring->enter(1, 0, 0);
+            }
+        }
+        m_ringThread.join();
+    }
+#endif
+
+    m_ring.reset();
+    m_backend     = Backend::Inline;
+    m_jobs        = nullptr;
+    m_initialized = false;
+}
+
+void AsyncFileIO::read(ReadRequest request, ReadCallback callback) {
+    m_pending.fetch_add(1, std::memory_order_acq_rel);
+
+#if WAVE_IO_URING_AVAILABLE
+    if (m_backend == Backend::IoUring) {
+        Op* op = make_op(std::move(request), std::move(callback));
+        ring_enqueue(std::span<Op* const>(&op, 1));
+        return;
+    }
+#endif
+
+    if (m_backend == Backend::ThreadPool && m_jobs && m_jobs->is_initialized()) {
+        run_pool(std::move(request), std::move(callback));
+        return;
+    }
+
+    ReadResult result;
+    result.data = std::move(request.buffer);
+    read_blocking(request, result);
+    if (callback) {
+        callback(std::move(result));
+    }
+    finish_one();
+}
+
+void AsyncFileIO::run_pool(ReadRequest request, ReadCallback callback) {
+    m_jobs->submit([this, request = std::move(request), callback = std::move(callback)]() mutable {
+        ReadResult result;
+        result.data = std::move(request.buffer);
+        read_blocking(request, result);
+        if (callback) {
+            callback(std::move(result));
+        }
+        finish_one();
+    });
+}
+
+void AsyncFileIO::finish_one() {
+    // Under the lock so shutdown() cannot miss the last completion, nor
+    // return (and destroy *this) before the notify is done.
+    std::scoped_lock lock(m_idleMutex);
+    if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        m_idleCv.notify_all();
+    }
+}
+
+jobs::JobHandle AsyncFileIO::read_batch(std::vector<ReadRequest> requests, std::vector<ReadResult>& results) {
+    results.clear();
+    results.resize(requests.size());
+
+    if (requests.empty()) {
+        return {};
+    }
+
+    auto counter = std::make_shared<std::atomic<std::uint32_t>>(
+        static_cast<std::uint32_t>(requests.size())
+    );
+
+    auto callback_for = [&results, counter](std::size_t i) {
+        return [&results, i, counter](ReadResult&& result) {
+            results[i] = std::move(result);
+            counter->fetch_sub(1u, std::memory_order_acq_rel);
+        };
+    };
+
+#if WAVE_IO_URING_AVAILABLE
+    if (m_backend == Backend::IoUring) {
+        // Every request's SQEs are queued under one lock and go to the kernel
+        // with one io_uring_enter (as many as fit; the rest follow as
+        // completions free slots).
+        std::vector<Op*> ops;
+        ops.reserve(requests.size());
+        for (std::size_t i = 0; i < requests.size(); ++i) {
+            ops.push_back(make_op(std::move(requests[i]), callback_for(i)));
+        }
+
+        m_pending.fetch_add(static_cast<std::uint32_t>(ops.size()), std::memory_order_acq_rel);
+        ring_enqueue(ops);
+        return jobs::JobHandle{counter};
+    }
+#endif
+
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        read(std::move(requests[i]), callback_for(i));
+    }
+
+    return jobs::JobHandle{counter};
+}
+
+void AsyncFileIO::read_blocking(const ReadRequest& request, ReadResult& out) {
+    out.path  = request.path;
+    out.error = {};
+    out.data.clear();
+
+    std::ifstream file(request.path, std::ios::in | std::ios::binary);
+    if (!file) {
+        std::error_code ec;
+        out.error = fs::exists(request.path, ec) ? std::make_error_code(std::errc::permission_denied)
+                                                 : std::make_error_code(std::errc::no_such_file_or_directory);
+        return;
+    }
+
+    file.seekg(0, std::ios::end);
+    const auto end = file.tellg();
+    if (end < 0) {
+        out.error = std::make_error_code(std::errc::io_error);
+        return;
+    }
+
+    const auto fileSize = static_cast<std::uint64_t>(end);
+    if (request.offset >= fileSize) {
+        return;
+    }
+
+    std::uint64_t count = fileSize - request.offset;
+    if (request.size > 0) {
+        count = std::min(count, request.size);
+    }
+
+    out.data.resize(static_cast<std::size_t>(count));
+    file.seekg(static_cast<std::streamoff>(request.offset), std::ios::beg);
+
+    if (!file.read(reinterpret_cast<char*>(out.data.data()), static_cast<std::streamsize>(count))) {
+        out.data.clear();
+        out.error = std::make_error_code(std::errc::io_error);
+    }
+}
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "engine/core/jobs/job_system.hpp"
+
+namespace wave::engine::core::filesystem {
+
+namespace fs = std::filesystem;
+
+struct ReadRequest {
+    fs::path      path;
+    std::uint64_t offset{0};
+
+    // Bytes to read starting at offset; 0 = to end of file. The io_uring
+    // backend fails reads larger than one chain can hold with EFBIG.
+    std::uint64_t size{0};
+
+    // Optional storage for the result. Its capacity is reused, so callers
+    // that recycle buffers (StreamReader) read without allocating.
+    std::vector<std::uint8_t> buffer{};
+};
+
+struct ReadResult {
+    fs::path                  path;
+    std::vector<std::uint8_t> data;
+    std::error_code           error;
+
+    bool ok() const { return !error; }
+};
+
+using ReadCallback = std::function<void(ReadResult&&)>;
+
+class AsyncFileIO;
+
+// co_await io.read_async({path}) -> ReadResult
+class ReadAwaitable {
+public:
+    ReadAwaitable(AsyncFileIO& io, ReadRequest request)
+        : m_io(&io), m_request(std::move(request)) {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle);
+    ReadResult await_resume() { return std::move(m_result); }
+
+private:
+    AsyncFileIO* m_io;
+    ReadRequest  m_request;
+    ReadResult   m_result;
+};
+
+// Asynchronous whole-file / range reads.
+//
+// Backends, picked in initialize():
+//   - IoUring:    Linux io_uring (5.17+). Each file is a statx (skipped when
+//                 the size is given) and then one linked open -> read ->
+//                 close chain on a registered descriptor; read_batch() queues
+//                 every request and submits them with a single syscall, so
+//                 loading thousands of small files costs a handful of
+//                 syscalls per batch instead of four blocking syscalls per
+//                 file. Completions are reaped on one I/O thread.
+//   - ThreadPool: each request is a blocking read on a JobSystem worker.
+//                 Used where io_uring is missing or blocked (seccomp, old
+//                 kernels, non-Linux).
+//   - Inline:     no JobSystem given and no io_uring; reads run on the caller.
+//
+// Completion callbacks (and coroutines resumed by read_async) run on the I/O
+// thread or the job worker that finished the read. Keep them short and hand
+// heavy work to the JobSystem.
+class AsyncFileIO final {
+public:
+    enum class Backend {
+        Inline,
+        ThreadPool,
+        IoUring
+    };
+
+    AsyncFileIO();
+    ~AsyncFileIO();
+
+    AsyncFileIO(const AsyncFileIO&) = delete;
+    AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+
+    AsyncFileIO(AsyncFileIO&&) noexcept = delete;
+    AsyncFileIO& operator=(AsyncFileIO&&) noexcept = delete;
+
+    // jobs may be null. queueDepth is the io_uring submission queue size and
+    // also caps the number of files open at once.
+    void initialize(jobs::JobSystem* jobs, std::uint32_t queueDepth = 256, bool allowIoUring = true);
+
+    // Waits for in-flight requests, then stops the I/O thread.
+    void shutdown();
+
+    bool is_initialized() const { return m_initialized; }
+    Backend backend() const { return m_backend; }
+
+    // Queue one read; 'callback' receives the result.
+    void read(ReadRequest request, ReadCallback callback);
+
+    // Queue many reads. results[i] is filled for requests[i]; the handle
+    // completes once all of them are done. 'results' must outlive the handle.
+    jobs::JobHandle read_batch(std::vector<ReadRequest> requests, std::vector<ReadResult>& results);
+
+    ReadAwaitable read_async(ReadRequest request) { return ReadAwaitable(*this, std::move(request)); }
+
+    // Number of requests queued or in flight.
+    std::uint32_t pending() const { return m_pending.load(std::memory_order_acquire); }
+
+    // Blocking read used by the ThreadPool / Inline backends.
+    static void read_blocking(const ReadRequest& request, ReadResult& out);
+
+private:
+    struct Ring;
+    struct Op;
+
+    bool          start_ring(std::uint32_t queueDepth);
+    void          ring_loop(std::stop_token stopToken);
+    Op*           make_op(ReadRequest request, ReadCallback callback);
+    void          ring_enqueue(std::span<Op* const> ops);
+    bool          ring_fits(const Op* op) const;
+    std::uint64_t max_chain_bytes() const;
+    void          ring_submit(Op* op);
+    bool          ring_advance(Op* op, std::uint64_t tag, std::int32_t res);   // true once the op is done
+    void          ring_complete(Op* op);
+    std::uint32_t drain_backlog();
+
+    void run_pool(ReadRequest request, ReadCallback callback);
+    void finish_one();
+
+private:
+    jobs::JobSystem* m_jobs{nullptr};
+    Backend          m_backend{Backend::Inline};
+    bool             m_initialized{false};
+
+    std::atomic<std::uint32_t> m_pending{0};
+    std::mutex                 m_idleMutex;
+    std::condition_variable    m_idleCv;   // signalled when m_pending reaches 0
+
+    // io_uring state -----------------------------------------------------------
+
+    std::unique_ptr<Ring> m_ring;
+    std::jthread          m_ringThread;
+
+    // Guards the submission queue, m_backlog, m_inFlight and m_freeFiles.
+    std::mutex                 m_submitMutex;
+    std::deque<Op*>            m_backlog;      // waiting for free slots
+    std::uint32_t              m_inFlight{0};  // SQEs whose CQE is not reaped yet
+    std::uint32_t              m_maxInFlight{0};
+    std::vector<std::uint32_t> m_freeFiles;    // free direct descriptor slots
+};
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,179 @@
+#include "engine/core/filesystem/async_file_writer.hpp"
+
+#include "engine/core/filesystem/file_system.hpp"
+#include "engine/core/logging/log.hpp"
+
+namespace wave::engine::core::filesystem {
+
+AsyncFileWriter::~AsyncFileWriter() {
+    shutdown();
+}
+
+void AsyncFileWriter::initialize(std::chrono::milliseconds coalesceWindow, bool durable) {
+    std::scoped_lock lock(m_mutex);
+    if (m_running) {
+        return;
+    }
+
+    m_coalesceWindow = coalesceWindow;
+    m_durable        = durable;
+    m_running        = true;
+    m_thread         = std::jthread([this](std::stop_token stopToken) { writer_loop(stopToken); });
+    m_callbackThread = m_thread.get_id();
+}
+
+void AsyncFileWriter::shutdown() {
+    {
+        std::scoped_lock lock(m_mutex);
+        if (!m_running || !m_thread.joinable()) {
+            return;
+        }
+    }
+
+    // The loop drains the queue before it exits.
+    m_thread.request_stop();
+    m_thread.join();
+
+    // Anything queued between the last batch and the join.
+    std::unique_lock lock(m_mutex);
+    m_running        = false;
+    m_callbackThread = std::this_thread::get_id();
+
+    auto leftovers = std::move(m_queue);
+    m_queue.clear();
+    lock.unlock();
+
+    for (auto& [key, pending] : leftovers) {
+        const bool ok = write_now(pending);
+        for (auto& callback : pending.callbacks) {
+            callback(pending.path, ok);
+        }
+    }
+
+    lock.lock();
+    m_writtenSerial  = m_queuedSerial;
+    m_callbackThread = {};
+    m_doneCv.notify_all();
+}
+
+bool AsyncFileWriter::is_initialized() const {
+    std::scoped_lock lock(m_mutex);
+    return m_running;
+}
+
+void AsyncFileWriter::write(fs::path path, std::vector<std::uint8_t> bytes, WriteCallback callback) {
+    std::string key = path.lexically_normal().generic_string();
+
+    std::unique_lock lock(m_mutex);
+    ++m_stats.queued;
+
+    if (!m_running) {
+        lock.unlock();
+
+        PendingWrite pending{std::move(path), std::move(bytes), {}};
+        const bool ok = write_now(pending);
+        if (callback) {
+            callback(pending.path, ok);
+        }
+        return;
+    }
+
+    ++m_queuedSerial;
+
+    auto [it, inserted] = m_queue.try_emplace(std::move(key));
+    if (!inserted) {
+        ++m_stats.coalesced;
+    }
+
+    it->second.path  = std::move(path);
+    it->second.bytes = std::move(bytes);
+    if (callback) {
+        it->second.callbacks.push_back(std::move(callback));
+    }
+
+    lock.unlock();
+    m_cv.notify_one();
+}
+
+void AsyncFileWriter::write_text(fs::path path, std::string_view text, WriteCallback callback) {
+    const auto* begin = reinterpret_cast<const std::uint8_t*>(text.data());
+    write(std::move(path), std::vector<std::uint8_t>(begin, begin + text.size()), std::move(callback));
+}
+
+void AsyncFileWriter::flush() {
+    std::unique_lock lock(m_mutex);
+
+    const std::uint64_t target = m_queuedSerial;
+    if (m_writtenSerial >= target || std::this_thread::get_id() == m_callbackThread) {
+        return;
+    }
+
+    // Only cut the coalesce window short when something is still queued;
+    // if just the running batch is left, waiting for it is enough and the
+    // next burst keeps its window.
+    if (!m_queue.empty()) {
+        m_flushRequested = true;
+        m_cv.notify_one();
+    }
+    m_doneCv.wait(lock, [this, target] { return m_writtenSerial >= target; });
+}
+
+std::size_t AsyncFileWriter::pending() const {
+    std::scoped_lock lock(m_mutex);
+    return m_queue.size();
+}
+
+FileWriterStats AsyncFileWriter::stats() const {
+    std::scoped_lock lock(m_mutex);
+    return m_stats;
+}
+
+void AsyncFileWriter::writer_loop(std::stop_token stopToken) {
+    std::unique_lock lock(m_mutex);
+
+    for (;;) {
+        m_cv.wait(lock, stopToken, [this] { return !m_queue.empty(); });
+        if (m_queue.empty()) {
+            break; // stop requested, nothing left to write
+        }
+
+        // Give a burst of writes time to coalesce, unless a flush or the
+        // shutdown is waiting on us.
+        if (!m_flushRequested && !stopToken.stop_requested()) {
+            m_cv.wait_for(lock, stopToken, m_coalesceWindow, [this] { return m_flushRequested; });
+        }
+        m_flushRequested = false;
+
+        auto batch = std::move(m_queue);
+        m_queue.clear();
+
+        const std::uint64_t serial = m_queuedSerial;
+        ++m_stats.batches;
+
+        lock.unlock();
+
+        for (auto& [key, pending] : batch) {
+            const bool ok = write_now(pending);
+            for (auto& callback : pending.callbacks) {
+                callback(pending.path, ok);
+            }
+        }
+
+        lock.lock();
+        m_writtenSerial = serial;
+        m_doneCv.notify_all();
+    }
+}
+
+bool AsyncFileWriter::write_now(PendingWrite& pending) {
+    const bool ok = write_file_atomic(pending.path, pending.bytes, m_durable);
+    if (!ok) {
+        WAVE_LOG_CH_ERROR(Filesystem, "Failed to write ", pending.path.string());
+    }
+
+    std::scoped_lock lock(m_mutex);
+    ++(ok ? m_stats.written : m_stats.failed);
+    return ok;
+}
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace wave::engine::core::filesystem {
+
+namespace fs = std::filesystem;
+
+struct FileWriterStats {
+    std::uint64_t queued{0};      // write() calls
+    std::uint64_t coalesced{0};   // writes replaced by a newer one before hitting disk
+    std::uint64_t written{0};     // files written
+    std::uint64_t failed{0};
+    std::uint64_t batches{0};
+};
+
+// Write-behind file writer for autosave, config persistence, metadata
+// sidecars and caches.
+//
+// write() only moves the bytes into a queue and returns; a background
+// thread writes them out with write_file_atomic() (temp file + rename), so
+// the calling frame never waits on the disk and a crash never leaves a
+// half-written file.
+//
+// Writes to the same path that are still queued are coalesced: only the
+// latest contents are written. The writer waits 'coalesceWindow' after the
+// first queued write before starting a batch, so bursts (autosave touching
+// the same files every frame, repeated config edits) collapse into one
+// write per file.
+//
+// Callbacks run on the writer thread; when writes are coalesced, every
+// callback of the path receives the result of the write that happened.
+// Callbacks must not wait on flush(): called from a callback it returns
+// at once, since the batch it would wait for is the one running it.
+//
+// Before initialize() (or after shutdown()), write() is synchronous.
+// Thread safe.
+class AsyncFileWriter final {
+public:
+    using WriteCallback = std::function<void(const fs::path& path, bool ok)>;
+
+    AsyncFileWriter() = default;
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    // 'durable' fsyncs every file before the rename. Cache files can turn it
+    // off; user data (autosave, settings) should not.
+    void initialize(std::chrono::milliseconds coalesceWindow = std::chrono::milliseconds(100), bool durable = true);
+
+    // Writes everything still queued, then stops the writer thread.
+    void shutdown();
+
+    bool is_initialized() const;
+
+    void write(fs::path path, std::vector<std::uint8_t> bytes, WriteCallback callback = {});
+    void write_text(fs::path path, std::string_view text, WriteCallback callback = {});
+
+    // Blocks until every write queued before this call is on disk.
+    void flush();
+
+    // Paths queued and not yet written.
+    std::size_t pending() const;
+
+    FileWriterStats stats() const;
+
+private:
+    struct PendingWrite {
+        fs::path                   path;
+        std::vector<std::uint8_t>  bytes;
+        std::vector<WriteCallback> callbacks;
+    };
+
+    void writer_loop(std::stop_token stopToken);
+    bool write_now(PendingWrite& write);
+
+private:
+    mutable std::mutex          m_mutex;
+    std::condition_variable_any m_cv;      // wakes the writer thread
+    std::condition_variable     m_doneCv;  // wakes flush()
+
+    // Keyed by the normalized path, so "a/./b" and "a/b" coalesce.
+    std::unordered_map<std::string, PendingWrite> m_queue;
+
+    std::uint64_t m_queuedSerial{0};   // bumped by every write()
+    std::uint64_t m_writtenSerial{0};  // every write up to this one is on disk
+    bool          m_flushRequested{false};
+    bool          m_running{false};
+
+    std::thread::id m_callbackThread;  // thread running the callbacks right now
+
+    std::chrono::milliseconds m_coalesceWindow{100};
+    bool                      m_durable{true};
+    FileWriterStats           m_stats;
+
+    std::jthread m_thread;
+};
+
+} // namespace wave::engine::core::filesystem
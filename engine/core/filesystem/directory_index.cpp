@@ -0,0 +1,297 @@
+#include "engine/core/filesystem/directory_index.hpp"
+
+#include "engine/core/filesystem/pak_format.hpp"
+
+#include <algorithm>
+
+namespace wave::engine::core::filesystem {
+
+std::string_view DirectoryEntry::name() const {
+    const auto slash = relativePath.find_last_of('/');
+    return slash == std::string::npos ? std::string_view(relativePath)
+                                      : std::string_view(relativePath).substr(slash + 1);
+}
+
+// -----------------------------------------------------------------------------
+// Setup
+// -----------------------------------------------------------------------------
+
+DirectoryIndex::DirectoryIndex(fs::path root) {
+    set_root(std::move(root));
+}
+
+void DirectoryIndex::set_root(fs::path root) {
+    // Canonical, so every consumer agrees on the paths in events.
+    std::error_code ec;
+    if (!root.empty()) {
+        if (fs::path canonical = fs::weakly_canonical(root, ec); !ec) {
+            root = std::move(canonical);
+        }
+    }
+
+    std::unique_lock lock(m_mutex);
+
+    m_rootKey = root.lexically_normal().generic_string();
+    while (m_rootKey.size() > 1 && m_rootKey.back() == '/') {
+        m_rootKey.pop_back();
+    }
+    m_root = fs::path(m_rootKey);
+
+    // The watcher's snapshot is the index; this is the only walk.
+    m_watcher.set_root(m_root, true);
+    rebuild_children();
+}
+
+std::size_t DirectoryIndex::refresh() {
+    std::vector<FileChangeEvent> events;
+    {
+        std::unique_lock lock(m_mutex);
+        m_watcher.update();
+        events = m_watcher.poll_events();
+        apply(events);
+
+        // A vanished root produces no events; the watcher only drops its
+        // snapshot. Report what is still listed as erased so subscribers
+        // forget it too.
+        if (m_watcher.entry_count() == 0) {
+            erase_all(events);
+        }
+    }
+
+    if (events.empty()) {
+        return 0;
+    }
+
+    // Copy so listeners may (un)subscribe from inside the callback.
+    std::vector<std::pair<Subscription, Listener>> listeners;
+    {
+        std::scoped_lock lock(m_listenerMutex);
+        listeners = m_listeners;
+    }
+
+    for (auto& [id, listener] : listeners) {
+        listener(events);
+    }
+
+    return events.size();
+}
+
+// -----------------------------------------------------------------------------
+// Subscriptions
+// -----------------------------------------------------------------------------
+
+DirectoryIndex::Subscription DirectoryIndex::subscribe(Listener listener) {
+    std::scoped_lock lock(m_listenerMutex);
+    const Subscription id = m_nextSubscription++;
+    m_listeners.emplace_back(id, std::move(listener));
+    return id;
+}
+
+void DirectoryIndex::unsubscribe(Subscription id) {
+    std::scoped_lock lock(m_listenerMutex);
+    std::erase_if(m_listeners, [id](const auto& entry) { return entry.first == id; });
+}
+
+// -----------------------------------------------------------------------------
+// Queries
+// -----------------------------------------------------------------------------
+
+std::optional<DirectoryEntry> DirectoryIndex::find(std::string_view relativePath) const {
+    std::string rel = normalize_pak_path(relativePath);
+
+    std::shared_lock lock(m_mutex);
+    const FileWatcher::EntryInfo* info = m_watcher.find(watcher_key(rel));
+    if (!info) {
+        return std::nullopt;
+    }
+
+    return make_entry(std::move(rel), *info);
+}
+
+std::vector<DirectoryEntry> DirectoryIndex::list(std::string_view relativeDirectory) const {
+    const std::string dir = normalize_pak_path(relativeDirectory);
+
+    std::shared_lock lock(m_mutex);
+
+    std::vector<DirectoryEntry> out;
+
+    const auto it = m_children.find(dir);
+    if (it == m_children.end()) {
+        return out;
+    }
+
+    out.reserve(it->second.size());
+    for (const auto& name : it->second) {
+        std::string rel = dir.empty() ? name : dir + '/' + name;
+        if (const FileWatcher::EntryInfo* info = m_watcher.find(watcher_key(rel))) {
+            out.push_back(make_entry(std::move(rel), *info));
+        }
+    }
+
+    return out;
+}
+
+void DirectoryIndex::for_each_file(std::string_view relativeDirectory,
+                                   const std::function<void(const DirectoryEntry& entry)>& fn) const {
+    const std::string dir = normalize_pak_path(relativeDirectory);
+
+    std::shared_lock lock(m_mutex);
+
+    const std::string prefix = (dir.empty() ? m_rootKey : watcher_key(dir)) + '/';
+    const std::size_t skip = m_rootKey.size() + 1;
+
+    m_watcher.for_each([&](std::string_view key, const FileWatcher::EntryInfo& info) {
+        if (info.isDirectory || !key.starts_with(prefix)) {
+            return;
+        }
+        fn(make_entry(std::string(key.substr(skip)), info));
+    });
+}
+
+std::size_t DirectoryIndex::entry_count() const {
+    std::shared_lock lock(m_mutex);
+    return m_watcher.entry_count();
+}
+
+fs::path DirectoryIndex::absolute(std::string_view relativePath) const {
+    std::shared_lock lock(m_mutex);
+    return fs::path(watcher_key(normalize_pak_path(relativePath)));
+}
+
+std::optional<std::string> DirectoryIndex::relative(const fs::path& path) const {
+    const std::string key = path.lexically_normal().generic_string();
+
+    std::shared_lock lock(m_mutex);
+    if (key == m_rootKey) {
+        return std::string();
+    }
+    if (key.size() > m_rootKey.size() && key.starts_with(m_rootKey) && key[m_rootKey.size()] == '/') {
+        return normalize_pak_path(std::string_view(key).substr(m_rootKey.size() + 1));
+    }
+    return std::nullopt;
+}
+
+// -----------------------------------------------------------------------------
+// Maintenance (exclusive lock held)
+// -----------------------------------------------------------------------------
+
+void DirectoryIndex::rebuild_children() {
+    m_children.clear();
+
+    const std::size_t skip = m_rootKey.size() + 1;
+    m_watcher.for_each([&](std::string_view key, const FileWatcher::EntryInfo& info) {
+        if (key.size() <= skip) {
+            return;
+        }
+
+        const std::string_view rel = key.substr(skip);
+        const std::string_view parent = parent_of(rel);
+        const std::string_view name = parent.empty() ? rel : rel.substr(parent.size() + 1);
+
+        m_children[std::string(parent)].emplace(name);
+        if (info.isDirectory) {
+            m_children.try_emplace(std::string(rel));
+        }
+    });
+}
+
+void DirectoryIndex::apply(const std::vector<FileChangeEvent>& events) {
+    const std::size_t skip = m_rootKey.size() + 1;
+
+    auto relativeOf = [skip](const fs::path& path) {
+        std::string key = path.generic_string();
+        return key.size() > skip ? key.substr(skip) : std::string();
+    };
+
+    auto add = [this](const std::string& rel) {
+        const std::string_view parent = parent_of(rel);
+        const std::string_view name = parent.empty() ? std::string_view(rel)
+                                                     : std::string_view(rel).substr(parent.size() + 1);
+        m_children[std::string(parent)].emplace(name);
+    };
+
+    auto remove = [this](const std::string& rel) {
+        const std::string_view parent = parent_of(rel);
+        const std::string_view name = parent.empty() ? std::string_view(rel)
+                                                     : std::string_view(rel).substr(parent.size() + 1);
+        if (auto it = m_children.find(std::string(parent)); it != m_children.end()) {
+            if (auto child = it->second.find(name); child != it->second.end()) {
+                it->second.erase(child);
+            }
+        }
+        m_children.erase(rel);
+    };
+
+    for (const auto& event : events) {
+        const std::string rel = relativeOf(event.path);
+        if (rel.empty()) {
+            continue;
+        }
+
+        switch (event.type) {
+            case FileChangeType::Created:
+                add(rel);
+                break;
+            case FileChangeType::Erased:
+                remove(rel);
+                break;
+            case FileChangeType::Renamed:
+                remove(relativeOf(event.oldPath));
+                add(rel);
+                break;
+            case FileChangeType::Modified:
+                break;
+        }
+    }
+}
+
+void DirectoryIndex::erase_all(std::vector<FileChangeEvent>& events) {
+    std::vector<std::string> rels;
+    for (const auto& [dir, names] : m_children) {
+        for (const auto& name : names) {
+            rels.push_back(dir.empty() ? name : dir + '/' + name);
+        }
+    }
+    m_children.clear();
+
+    // Children before their directory.
+    std::sort(rels.begin(), rels.end(), std::greater<>());
+
+    const auto detectedAt = std::chrono::steady_clock::now();
+    for (const auto& rel : rels) {
+        FileChangeEvent event;
+        event.type       = FileChangeType::Erased;
+        event.path       = watcher_key(rel);
+        event.detectedAt = detectedAt;
+        events.push_back(std::move(event));
+    }
+}
+
+DirectoryEntry DirectoryIndex::make_entry(std::string relativePath, const FileWatcher::EntryInfo& info) const {
+    DirectoryEntry entry;
+    entry.relativePath = std::move(relativePath);
+    entry.isDirectory  = info.isDirectory;
+    entry.size         = info.size;
+    entry.lastWrite    = info.lastWrite;
+    return entry;
+}
+
+std::string DirectoryIndex::watcher_key(std::string_view relativePath) const {
+    if (relativePath.empty()) {
+        return m_rootKey;
+    }
+
+    std::string key;
+    key.reserve(m_rootKey.size() + 1 + relativePath.size());
+    key.append(m_rootKey);
+    key += '/';
+    key.append(relativePath);
+    return key;
+}
+
+std::string_view DirectoryIndex::parent_of(std::string_view relativePath) {
+    const auto slash = relativePath.find_last_of('/');
+    return slash == std::string_view::npos ? std::string_view() : relativePath.substr(0, slash);
+}
+
+} // namespace wave::engine::core::filesystem
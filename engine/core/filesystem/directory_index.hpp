@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/filesystem/file_watcher.hpp"
+
+namespace wave::engine::core::filesystem {
+
+namespace fs = std::filesystem;
+
+struct DirectoryEntry {
+    std::string        relativePath;   // generic, relative to the index root ("" = root)
+    bool               isDirectory{false};
+    std::uintmax_t     size{0};
+    fs::file_time_type lastWrite{};
+
+    // Last path component.
+    std::string_view name() const;
+};
+
+// One shared, incrementally maintained view of a directory tree.
+//
+// FileWatcher, AssetDatabase and the editor's resource browser all need the
+// same listing of the project tree. Instead of each walking it, one index
+// owns the watcher that does the walking; refresh() updates it and hands
+// the resulting change events to every subscriber, and queries read the
+// watcher's snapshot plus a per-directory child list kept up to date from
+// those events.
+//
+//   DirectoryIndex index("/project/assets");
+//   assetDatabase.attach(index);                       // initial scan + events
+//   browser.refresh_from_index(index);                 // folder listing
+//   ...
+//   index.refresh();                                   // once per frame / tick
+//
+// Thread safe: refresh() takes an exclusive lock, queries a shared one.
+// Subscribers are called from refresh() after the lock is released, so they
+// may query the index.
+class DirectoryIndex final {
+public:
+    using Listener     = std::function<void(const std::vector<FileChangeEvent>& events)>;
+    using Subscription = std::uint64_t;
+
+    DirectoryIndex() = default;
+    explicit DirectoryIndex(fs::path root);
+
+    DirectoryIndex(const DirectoryIndex&) = delete;
+    DirectoryIndex& operator=(const DirectoryIndex&) = delete;
+
+    // Re-roots the index (made canonical) and rebuilds it with a full walk.
+    // Subscribers stay registered but get no events for the switch.
+    void set_root(fs::path root);
+
+    const fs::path& root() const { return m_root; }
+
+    // Pick up changes on disk and notify subscribers. Returns the number of
+    // events delivered. If the root itself is removed, every entry is
+    // reported as erased.
+    std::size_t refresh();
+
+    // Subscriptions ------------------------------------------------------------
+
+    Subscription subscribe(Listener listener);
+    void unsubscribe(Subscription id);
+
+    // Queries ------------------------------------------------------------------
+    //
+    // Relative paths use '/' and no leading "./"; "" is the root.
+
+    std::optional<DirectoryEntry> find(std::string_view relativePath) const;
+
+    // Direct children of a directory, sorted by name.
+    std::vector<DirectoryEntry> list(std::string_view relativeDirectory) const;
+
+    // Every file (not directory) under 'relativeDirectory', recursively.
+    void for_each_file(std::string_view relativeDirectory,
+                       const std::function<void(const DirectoryEntry& entry)>& fn) const;
+
+    std::size_t entry_count() const;
+
+    // Absolute path of an index-relative path, and the reverse. relative()
+    // returns nullopt for paths outside the root.
+    fs::path absolute(std::string_view relativePath) const;
+    std::optional<std::string> relative(const fs::path& path) const;
+
+private:
+    void rebuild_children();
+    void apply(const std::vector<FileChangeEvent>& events);
+    void erase_all(std::vector<FileChangeEvent>& events);
+
+    DirectoryEntry make_entry(std::string relativePath, const FileWatcher::EntryInfo& info) const;
+    std::string    watcher_key(std::string_view relativePath) const;
+
+    static std::string_view parent_of(std::string_view relativePath);
+
+private:
+    fs::path    m_root;
+    std::string m_rootKey;   // watcher key prefix: normalized generic root
+
+    FileWatcher m_watcher;
+
+    // Directory (relative) -> names of its direct children.
+    std::unordered_map<std::string, std::set<std::string, std::less<>>> m_children;
+
+    mutable std::shared_mutex m_mutex;
+
+    std::mutex                                          m_listenerMutex;
+    std::vector<std::pair<Subscription, Listener>>      m_listeners;
+    Subscription                                        m_nextSubscription{1};
+};
+
+} // namespace wave::engine::core::filesystem
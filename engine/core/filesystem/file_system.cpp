@@ -1,6 +1,22 @@
 #include "engine/core/filesystem/file_system.hpp"
 
+#include <atomic>
 #include <fstream>
+#include <string>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
 
 namespace wave::engine::core::filesystem
 {
@@ -29,6 +45,39 @@ namespace wave::engine::core::filesystem
         return true;
     }
 
+    bool read_binary_file(const fs::path& path, std::vector<std::uint8_t>& out) noexcept
+    {
+        out.clear();
+
+        try
+        {
+            std::ifstream file(path, std::ios::in | std::ios::binary);
+            if (!file)
+                return false;
+
+            file.seekg(0, std::ios::end);
+            const auto size = file.tellg();
+            if (size < 0)
+                return false;
+
+            out.resize(static_cast<std::size_t>(size));
+            file.seekg(0, std::ios::beg);
+
+            if (!file.read(reinterpret_cast<char*>(out.data()), size))
+            {
+                out.clear();
+                return false;
+            }
+
+            return true;
+        }
+        catch (...)
+        {
+            out.clear();
+            return false;
+        }
+    }
+
     bool write_text_file(const fs::path& path, std::string_view text) noexcept
     {
         try
@@ -58,6 +107,122 @@ namespace wave::engine::core::filesystem
         }
     }
 
+    namespace
+    {
+        // Unique per process and call, so concurrent writers of one path
+        // never share a temp file.
+        fs::path make_temp_path(const fs::path& path)
+        {
+            static std::atomic<std::uint32_t> counter{ 0 };
+
+#if defined(_WIN32)
+            const auto pid = static_cast<unsigned long>(GetCurrentProcessId());
+#else
+            const auto pid = static_cast<unsigned long>(getpid());
+#endif
+
+            fs::path temp = path;
+            temp += ".tmp" + std::to_string(pid) + "_" + std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+            return temp;
+        }
+
+#if !defined(_WIN32)
+        bool write_all(int fd, std::span<const std::uint8_t> bytes)
+        {
+            while (!bytes.empty())
+            {
+                const ssize_t written = ::write(fd, bytes.data(), bytes.size());
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return false;
+                }
+                bytes = bytes.subspan(static_cast<std::size_t>(written));
+            }
+            return true;
+        }
+#endif
+    } // namespace
+
+    bool write_file_atomic(const fs::path& path, std::span<const std::uint8_t> bytes, bool durable) noexcept
+    {
+        try
+        {
+            const fs::path parent = path.parent_path();
+            if (!parent.empty())
+            {
+                std::error_code ec;
+                fs::create_directories(parent, ec);
+                if (ec)
+                    return false;
+            }
+
+            const fs::path temp = make_temp_path(path);
+
+#if defined(_WIN32)
+            {
+                std::ofstream file(temp, std::ios::out | std::ios::binary | std::ios::trunc);
+                if (!file)
+                    return false;
+
+                file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+                file.flush();
+                if (!file)
+                {
+                    file.close();
+                    std::error_code ec;
+                    fs::remove(temp, ec);
+                    return false;
+                }
+            }
+
+            const DWORD flags = MOVEFILE_REPLACE_EXISTING | (durable ? MOVEFILE_WRITE_THROUGH : 0);
+            if (!MoveFileExW(temp.c_str(), path.c_str(), flags))
+            {
+                std::error_code ec;
+                fs::remove(temp, ec);
+                return false;
+            }
+
+            return true;
+#else
+            const int fd = ::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd < 0)
+                return false;
+
+            bool ok = write_all(fd, bytes);
+            if (ok && durable)
+                ok = ::fsync(fd) == 0;
+            ok = (::close(fd) == 0) && ok;
+
+            if (!ok || ::rename(temp.c_str(), path.c_str()) != 0)
+            {
+                ::unlink(temp.c_str());
+                return false;
+            }
+
+            if (durable)
+            {
+                // Persist the rename itself.
+                const fs::path dir = parent.empty() ? fs::path(".") : parent;
+                const int dirFd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+                if (dirFd >= 0)
+                {
+                    ::fsync(dirFd);
+                    ::close(dirFd);
+                }
+            }
+
+            return true;
+#endif
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
     bool ensure_directory(const fs::path& path) noexcept
     {
         try
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 #include <filesystem>
+#include <vector>
 
 namespace wave::engine::core::filesystem
 {
@@ -16,11 +19,22 @@ namespace wave::engine::core::filesystem
     // Returns true on success, false on any error.
     bool read_text_file(const fs::path& path, std::string& out) noexcept;
 
+    // Same as read_text_file, into a byte vector.
+    // Prefer MappedFile (mapped_file.hpp) when the data is only read.
+    bool read_binary_file(const fs::path& path, std::vector<std::uint8_t>& out) noexcept;
+
     // Write the given text to a file, overwriting any existing contents.
     // Creates parent directories if needed.
     // Returns true on success, false on any error.
     bool write_text_file(const fs::path& path, std::string_view text) noexcept;
 
+    // Crash-safe replacement of a file's contents: writes a sibling temp
+    // file and renames it over 'path', so readers (and a crash at any
+    // point) see either the old or the new contents, never a torn file.
+    // 'durable' also fsyncs the data and the directory entry before
+    // returning. Creates parent directories if needed.
+    bool write_file_atomic(const fs::path& path, std::span<const std::uint8_t> bytes, bool durable = true) noexcept;
+
     // Ensure a directory exists (recursively created if needed).
     // Returns true if the directory exists or was created successfully.
     bool ensure_directory(const fs::path& path) noexcept;
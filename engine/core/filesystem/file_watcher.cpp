@@ -1,31 +1,394 @@
 #include "file_watcher.hpp"
 
+#include "engine/core/jobs/job_system.hpp"
+#include "engine/core/logging/log.hpp"
+
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+    #include <cerrno>
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/stat.h>
+#endif
 
 namespace wave::engine::core::filesystem {
 
+struct FileWatcher::Inotify {
+    int fd{-1};
+
+    // Watches are keyed by snapshot node, so a moved directory needs no
+    // bookkeeping: its node (and inode) stay the same.
+    std::unordered_map<int, SnapshotTree::NodeId> dirs;   // watch descriptor -> directory
+    std::unordered_map<SnapshotTree::NodeId, int> wds;    // directory -> watch descriptor
+
+    Inotify() = default;
+    Inotify(const Inotify&) = delete;
+    Inotify& operator=(const Inotify&) = delete;
+
+    ~Inotify() {
+#if defined(__linux__)
+        if (fd >= 0) {
+            ::close(fd);
+        }
+#endif
+    }
+};
+
+namespace {
+
+struct ScanEntry {
+    std::string            name;
+    FileWatcher::EntryInfo info;
+    bool                   exists{false};
+};
+
+} // namespace
+
+struct FileWatcher::DirScan {
+    using Entry = ScanEntry;
+
+    NodeId dir{SnapshotTree::kNone};
+    bool   listed{false};    // full listing, sorted by name; else one entry per known child
+    bool   failed{false};    // could not be read; left as is
+
+    std::vector<Entry> entries;
+};
+
+struct FileWatcher::PendingChange {
+    std::string key;
+
+    // Net change since the last delivered event for this path.
+    bool existedBefore{false};
+    bool existsNow{false};
+    bool changed{false};
+
+    // Pre-existing path this one was moved from, and the reverse link; an
+    // entry with movedTo set is delivered together with its target.
+    std::string renamedFrom;
+    std::string movedTo;
+
+    std::chrono::steady_clock::time_point lastSeen{};
+    bool delivered{false};
+};
+
+namespace {
+
+// Hands event batches from the watcher thread to poll_events(). A push links
+// one batch in with a CAS; a drain takes the whole list with one exchange and
+// never dereferences the head it competes on, so there is no ABA and no lock
+// on either side.
+class EventQueue {
+public:
+    EventQueue() = default;
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+
+    ~EventQueue() {
+        std::vector<FileChangeEvent> dropped;
+        drain(dropped);
+    }
+
+    void push(std::vector<FileChangeEvent> events) {
+        auto* batch = new Batch{std::move(events), m_head.load(std::memory_order_relaxed)};
+        while (!m_head.compare_exchange_weak(batch->next, batch, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+        }
+    }
+
+    // Appends every published event to 'out', oldest first.
+    void drain(std::vector<FileChangeEvent>& out) {
+        if (m_head.load(std::memory_order_relaxed) == nullptr) {
+            return;
+        }
+
+        // The list is newest first; reverse it before copying out.
+        Batch* oldest = nullptr;
+        for (Batch* batch = m_head.exchange(nullptr, std::memory_order_acquire); batch;) {
+            Batch* next = batch->next;
+            batch->next = oldest;
+            oldest      = batch;
+            batch       = next;
+        }
+
+        while (oldest) {
+            Batch* next = oldest->next;
+            if (out.empty()) {
+                out = std::move(oldest->events);
+            } else {
+                out.insert(out.end(), std::make_move_iterator(oldest->events.begin()),
+                           std::make_move_iterator(oldest->events.end()));
+            }
+            delete oldest;
+            oldest = next;
+        }
+    }
+
+private:
+    struct Batch {
+        std::vector<FileChangeEvent> events;
+        Batch*                       next{nullptr};
+    };
+
+    std::atomic<Batch*> m_head{nullptr};
+};
+
+} // namespace
+
+struct FileWatcher::Background {
+    EventQueue queue;
+
+    std::chrono::milliseconds interval{250};
+
+    // Sleep between polls; stop requests wake it through the stop token.
+    std::mutex                  sleepMutex;
+    std::condition_variable_any sleepCv;
+
+    // eventfd polled next to the inotify fd, so stop() can interrupt the
+    // wait; -1 elsewhere.
+    int wakeFd{-1};
+
+    std::jthread thread;
+
+    Background() = default;
+    Background(const Background&) = delete;
+    Background& operator=(const Background&) = delete;
+
+    ~Background() {
+#if defined(__linux__)
+        if (wakeFd >= 0) {
+            ::close(wakeFd);
+        }
+#endif
+    }
+
+    void wake() {
+#if defined(__linux__)
+        if (wakeFd >= 0) {
+            const std::uint64_t one = 1;
+            [[maybe_unused]] const ssize_t n = ::write(wakeFd, &one, sizeof(one));
+        }
+#endif
+    }
+};
+
+namespace {
+
+// Directories whose mtime is this close to (or after) the previous scan may
+// have changed again within the same timestamp tick, after that scan listed
+// them; they are listed again rather than trusted. Covers coarse (FAT, some
+// network) timestamps, not clock skew between client and server.
+constexpr auto kRacyWindow = std::chrono::seconds(2);
+
+// Below this many directories in one depth level the scan stays on the
+// calling thread.
+constexpr std::size_t kParallelMinDirs = 8;
+
+// Regular files and directories only; false for anything else or on error.
+bool read_entry_info(const fs::path& path, FileWatcher::EntryInfo& info) {
+#if defined(__unix__) || defined(__APPLE__)
+    // One stat() for type, size, mtime and identity; the std::filesystem
+    // accessors would each stat the path again.
+    struct stat st {};
+    if (::stat(path.c_str(), &st) != 0 || (!S_ISREG(st.st_mode) && !S_ISDIR(st.st_mode))) {
+        return false;
+    }
+
+    #if defined(__APPLE__)
+    const auto mtime = std::chrono::seconds(st.st_mtimespec.tv_sec) + std::chrono::nanoseconds(st.st_mtimespec.tv_nsec);
+    #else
+    const auto mtime = std::chrono::seconds(st.st_mtim.tv_sec) + std::chrono::nanoseconds(st.st_mtim.tv_nsec);
+    #endif
+
+    info.isDirectory = S_ISDIR(st.st_mode);
+    info.size        = info.isDirectory ? 0 : static_cast<std::uintmax_t>(st.st_size);
+    info.lastWrite   = std::chrono::file_clock::from_sys(
+        std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(mtime)));
+    info.device      = static_cast<std::uint64_t>(st.st_dev);
+    info.inode       = static_cast<std::uint64_t>(st.st_ino);
+    return true;
+#else
+    std::error_code ec;
+
+    const auto status = fs::status(path, ec);
+    if (ec || (!fs::is_regular_file(status) && !fs::is_directory(status))) {
+        return false;
+    }
+
+    info.isDirectory = fs::is_directory(status);
+
+    info.lastWrite = fs::last_write_time(path, ec);
+    if (ec) {
+        info.lastWrite = {};
+    }
+
+    info.size = info.isDirectory ? 0 : fs::file_size(path, ec);
+    if (ec) {
+        info.size = 0;
+    }
+
+    return true;
+#endif
+}
+
+// A replaced file (new inode at the same path) counts as modified even if
+// size and mtime happen to match.
+bool same_info(const FileWatcher::EntryInfo& a, const FileWatcher::EntryInfo& b) {
+    return a.lastWrite == b.lastWrite && a.size == b.size && a.isDirectory == b.isDirectory &&
+           a.device == b.device && a.inode == b.inode;
+}
+
+using Change = std::pair<std::string, FileWatcher::EntryInfo>;
+
+// Pairs erased and created entries that are the same file: same device and
+// inode, and for files the same size and mtime too, which a rename keeps
+// and a freshly reused inode almost never matches. Returns (created,
+// erased) index pairs.
+std::vector<std::pair<std::size_t, std::size_t>> match_renames(const std::vector<Change>& erased,
+                                                               const std::vector<Change>& created) {
+    std::vector<std::pair<std::size_t, std::size_t>> matches;
+    if (erased.empty() || created.empty()) {
+        return matches;
+    }
+
+    struct IdHash {
+        std::size_t operator()(const std::pair<std::uint64_t, std::uint64_t>& id) const {
+            return std::hash<std::uint64_t>()(id.first * 0x9E3779B97F4A7C15ull ^ id.second);
+        }
+    };
+
+    std::unordered_map<std::pair<std::uint64_t, std::uint64_t>, std::size_t, IdHash> byId;
+    for (std::size_t i = 0; i < erased.size(); ++i) {
+        const auto& info = erased[i].second;
+        if (info.inode != 0) {
+            byId.emplace(std::make_pair(info.device, info.inode), i);
+        }
+    }
+
+    for (std::size_t i = 0; i < created.size() && !byId.empty(); ++i) {
+        const auto& info = created[i].second;
+        auto it = byId.find({info.device, info.inode});
+        if (info.inode == 0 || it == byId.end()) {
+            continue;
+        }
+
+        const auto& old = erased[it->second].second;
+        const bool same = old.isDirectory == info.isDirectory &&
+                          (info.isDirectory || (old.size == info.size && old.lastWrite == info.lastWrite));
+        if (same) {
+            matches.emplace_back(i, it->second);
+            byId.erase(it);
+        }
+    }
+
+    return matches;
+}
+
+std::string join(std::string_view dir, std::string_view name) {
+    std::string path;
+    path.reserve(dir.size() + 1 + name.size());
+    path.append(dir);
+    if (path.empty() || path.back() != '/') {
+        path += '/';
+    }
+    path.append(name);
+    return path;
+}
+
+// Entries of one directory sorted by name; false if it cannot be read.
+bool list_sorted(const std::string& dir, std::vector<ScanEntry>& out) {
+    std::error_code ec;
+    fs::directory_iterator it(dir, ec);
+    if (ec) {
+        return false;
+    }
+
+    for (const fs::directory_iterator end; it != end && !ec; it.increment(ec)) {
+        ScanEntry entry;
+        if (read_entry_info(it->path(), entry.info)) {
+            entry.name   = it->path().filename().generic_string();
+            entry.exists = true;
+            out.push_back(std::move(entry));
+        }
+    }
+
+    std::sort(out.begin(), out.end(), [](const auto& a, const auto& b) { return a.name < b.name; });
+    return true;
+}
+
+} // namespace
+
 // -----------------------------------------------------------------------------
 // Construction / setup
 // -----------------------------------------------------------------------------
 
-FileWatcher::FileWatcher(fs::path root, bool recursive) {
-    set_root(std::move(root), recursive);
+FileWatcher::FileWatcher() = default;
+
+FileWatcher::~FileWatcher() {
+    stop();
 }
 
-void FileWatcher::set_root(fs::path root, bool recursive) {
-    m_root      = std::move(root);
-    m_recursive = recursive;
+FileWatcher::FileWatcher(fs::path root, bool recursive, bool allowNative) {
+    set_root(std::move(root), recursive, allowNative);
+}
+
+void FileWatcher::set_root(fs::path root, bool recursive, bool allowNative) {
+    const bool restart = running();
+    stop();
+
+    std::unique_lock lock(m_snapshotMutex);
 
+    m_root          = std::move(root);
+    m_recursive     = recursive;
+    m_allowNative   = allowNative;
+    m_restartNative = false;
+
+    std::string rootKey = m_root.lexically_normal().generic_string();
+    while (rootKey.size() > 1 && rootKey.back() == '/') {
+        rootKey.pop_back();
+    }
+    m_tree.reset(std::move(rootKey));
+
+    m_inotify.reset();
     clear_snapshot();
     m_events.clear();
+    m_pending.clear();
+    m_pendingIndex.clear();
 
     if (!m_root.empty() && fs::exists(m_root) && fs::is_directory(m_root)) {
-        snapshot_current(m_snapshot);
+        // Initial state; reported as nothing.
+        m_collecting = false;
+        if (m_allowNative && start_inotify()) {
+            populate(SnapshotTree::kRoot, m_tree.root_key(), {});
+        } else {
+            rescan();
+        }
+        m_collecting = true;
+    }
+
+    lock.unlock();
+    if (restart) {
+        start(m_pollInterval);
     }
 }
 
 void FileWatcher::clear_snapshot() {
-    m_snapshot.clear();
+    m_tree.reset(m_tree.root_key());
+    m_lastScanStart = {};
+
+    m_passActive = false;
+    m_passDirs.clear();
+    m_scanCreated.clear();
+    m_scanErased.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -33,128 +396,948 @@ void FileWatcher::clear_snapshot() {
 // -----------------------------------------------------------------------------
 
 void FileWatcher::update() {
+    if (m_background) {
+        return;
+    }
+
+    std::unique_lock lock(m_snapshotMutex);
+    update_now();
+}
+
+void FileWatcher::update_now() {
     if (m_root.empty() || !fs::exists(m_root) || !fs::is_directory(m_root)) {
         // Root missing; report nothing and clear snapshot so new root content
         // will be treated as "created" when it reappears.
         clear_snapshot();
+        if (m_inotify) {
+            m_inotify.reset();
+            m_restartNative = true;
+        }
         return;
     }
 
-    std::unordered_map<std::string, EntryInfo> newSnapshot;
-    snapshot_current(newSnapshot);
-    compute_diff(newSnapshot);
-    m_snapshot = std::move(newSnapshot);
+    if (m_restartNative) {
+        m_restartNative = false;
+        if (start_inotify()) {
+            // The snapshot is empty, so this reports everything as created.
+            populate(SnapshotTree::kRoot, m_tree.root_key(), std::chrono::steady_clock::now());
+            return;
+        }
+    }
+
+    if (m_inotify) {
+        update_inotify();
+    } else if (m_scanBudget > 0) {
+        rescan_slice();
+    } else {
+        rescan();
+    }
 }
 
 std::vector<FileChangeEvent> FileWatcher::poll_events() {
     std::vector<FileChangeEvent> result;
+
+    if (m_background) {
+        m_background->queue.drain(result);
+        return result;
+    }
+
+    flush_pending(std::chrono::steady_clock::now());
     result.swap(m_events);
     return result;
 }
 
 // -----------------------------------------------------------------------------
-// Snapshot
+// Background mode
 // -----------------------------------------------------------------------------
 
-void FileWatcher::snapshot_current(std::unordered_map<std::string, EntryInfo>& outSnapshot) {
-    const auto now = std::chrono::steady_clock::now(); // used only for events
+void FileWatcher::start(std::chrono::milliseconds pollInterval) {
+    stop();
 
-    (void)now; // silence unused warning in this function; kept for symmetry
+    m_pollInterval = std::max(pollInterval, std::chrono::milliseconds(1));
 
-    auto addEntry = [&outSnapshot](const fs::directory_entry& entry) {
-        if (!entry.is_regular_file() && !entry.is_directory()) {
-            return;
+    auto background = std::make_unique<Background>();
+    background->interval = m_pollInterval;
+#if defined(__linux__)
+    background->wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
+
+    // Events collected in the foreground are handed out first.
+    if (!m_events.empty()) {
+        background->queue.push(std::move(m_events));
+        m_events.clear();
+    }
+
+    m_background = std::move(background);
+    m_background->thread = std::jthread([this](std::stop_token stopToken) { watch_loop(stopToken); });
+}
+
+void FileWatcher::stop() {
+    if (!m_background) {
+        return;
+    }
+
+    m_background->thread.request_stop();
+    m_background->wake();
+    m_background->thread.join();
+
+    // Published but not yet polled; back to the foreground queue, ahead of
+    // anything still pending.
+    std::vector<FileChangeEvent> events;
+    m_background->queue.drain(events);
+    events.insert(events.end(), std::make_move_iterator(m_events.begin()), std::make_move_iterator(m_events.end()));
+    m_events = std::move(events);
+
+    m_background.reset();
+}
+
+void FileWatcher::watch_loop(std::stop_token stopToken) {
+    while (!stopToken.stop_requested()) {
+        {
+            std::unique_lock lock(m_snapshotMutex);
+            update_now();
         }
 
-        const auto p = entry.path();
-        std::string key = p.lexically_normal().generic_string();
+        // The pending set and m_events are this thread's alone.
+        const auto now = std::chrono::steady_clock::now();
+        flush_pending(now);
+        if (!m_events.empty()) {
+            m_background->queue.push(std::move(m_events));
+            m_events.clear();
+        }
 
-        EntryInfo info{};
-        std::error_code ec;
+        wait_for_changes(stopToken, next_flush(now));
+    }
+}
 
-        info.lastWrite = fs::last_write_time(p, ec);
-        if (ec) {
-            info.lastWrite = TimePoint{};
+void FileWatcher::wait_for_changes(std::stop_token stopToken,
+                                   std::optional<std::chrono::steady_clock::duration> flushIn) {
+    Background& background = *m_background;
+
+    // Round up, so a deadline a fraction of a millisecond away is not a spin.
+    const auto flushMs = flushIn ? std::optional(std::chrono::ceil<std::chrono::milliseconds>(*flushIn))
+                                 : std::nullopt;
+
+#if defined(__linux__)
+    // Only this thread touches m_inotify while running.
+    if (m_inotify && background.wakeFd >= 0) {
+        pollfd fds[2] = {};
+        fds[0].fd     = m_inotify->fd;
+        fds[0].events = POLLIN;
+        fds[1].fd     = background.wakeFd;
+        fds[1].events = POLLIN;
+
+        // Nothing held back: sleep until the kernel has something.
+        const int timeout = flushMs ? static_cast<int>(std::min<std::int64_t>(flushMs->count(), 60 * 1000)) : -1;
+        if (::poll(fds, 2, timeout) > 0 && (fds[1].revents & POLLIN)) {
+            std::uint64_t count = 0;
+            [[maybe_unused]] const ssize_t n = ::read(background.wakeFd, &count, sizeof(count));
         }
+        return; // EINTR: the loop checks for stop and waits again
+    }
+#endif
+
+    const auto wait = flushMs ? std::min(*flushMs, background.interval) : background.interval;
+
+    std::unique_lock lock(background.sleepMutex);
+    background.sleepCv.wait_for(lock, stopToken, wait, [] { return false; });
+}
+
+// -----------------------------------------------------------------------------
+// Snapshot queries
+// -----------------------------------------------------------------------------
+
+const FileWatcher::EntryInfo* FileWatcher::find(std::string_view path) const {
+    std::shared_lock lock(m_snapshotMutex);
+    const NodeId node = m_tree.find(path);
+    return node == SnapshotTree::kNone || node == SnapshotTree::kRoot ? nullptr : &m_tree.info(node);
+}
+
+std::optional<FileWatcher::EntryInfo> FileWatcher::lookup(std::string_view path) const {
+    std::shared_lock lock(m_snapshotMutex);
+    const NodeId node = m_tree.find(path);
+    if (node == SnapshotTree::kNone || node == SnapshotTree::kRoot) {
+        return std::nullopt;
+    }
+    return m_tree.info(node);
+}
+
+void FileWatcher::for_each(const std::function<void(std::string_view path, const EntryInfo& info)>& fn) const {
+    std::shared_lock lock(m_snapshotMutex);
+    m_tree.for_each(fn);
+}
+
+std::size_t FileWatcher::entry_count() const {
+    std::shared_lock lock(m_snapshotMutex);
+    return m_tree.size();
+}
+
+// -----------------------------------------------------------------------------
+// Polling scan
+// -----------------------------------------------------------------------------
+
+void FileWatcher::rescan() {
+    m_passActive = false;
+    m_passDirs.clear();
+
+    EntryInfo rootInfo{};
+    if (!read_entry_info(m_tree.root_key(), rootInfo)) {
+        return;
+    }
+
+    const auto scanStart  = fs::file_time_type::clock::now();
+    const auto detectedAt = std::chrono::steady_clock::now();
+
+    std::vector<std::pair<NodeId, bool>> level{{SnapshotTree::kRoot, needs_relist(m_tree.info(SnapshotTree::kRoot), rootInfo)}};
+    m_tree.info(SnapshotTree::kRoot) = rootInfo;
+
+    // Breadth first, one depth level at a time: the directories of a level
+    // are scanned in parallel (reading the tree only), then merged in on
+    // this thread, which yields the next level.
+    const bool parallel = m_jobs && m_jobs->is_initialized();
+
+    std::vector<DirScan> scans;
+    while (!level.empty()) {
+        scans.clear();
+        scans.resize(level.size());
+
+        if (parallel && level.size() >= kParallelMinDirs) {
+            m_jobs->parallel_for(0, static_cast<std::int32_t>(level.size()), [&](std::int32_t i) {
+                const auto index = static_cast<std::size_t>(i);
+                scans[index] = scan_directory(level[index].first, level[index].second);
+            }).wait();
+        } else {
+            for (std::size_t i = 0; i < level.size(); ++i) {
+                scans[i] = scan_directory(level[i].first, level[i].second);
+            }
+        }
+
+        std::vector<std::pair<NodeId, bool>> next;
+        for (auto& scan : scans) {
+            apply_scan(scan, next, detectedAt);
+        }
+        level = std::move(next);
+    }
+
+    m_lastScanStart = scanStart;
+    emit_changes(detectedAt);
+}
+
+void FileWatcher::rescan_slice() {
+    if (!m_passActive) {
+        EntryInfo rootInfo{};
+        if (!read_entry_info(m_tree.root_key(), rootInfo)) {
+            return;
+        }
+
+        m_passActive = true;
+        m_passStart  = fs::file_time_type::clock::now();
+        m_passDirs.assign(1, {SnapshotTree::kRoot, needs_relist(m_tree.info(SnapshotTree::kRoot), rootInfo)});
+        m_tree.info(SnapshotTree::kRoot) = rootInfo;
+    }
+
+    const auto detectedAt = std::chrono::steady_clock::now();
+
+    // Depth first, so the pending list stays short.
+    std::size_t visited = 0;
+    while (!m_passDirs.empty() && visited < m_scanBudget) {
+        const auto [dir, relist] = m_passDirs.back();
+        m_passDirs.pop_back();
+
+        DirScan scan = scan_directory(dir, relist);
+        visited += std::max<std::size_t>(1, scan.entries.size());
+        apply_scan(scan, m_passDirs, detectedAt);
+    }
+
+    if (!m_passDirs.empty()) {
+        return;
+    }
+
+    m_passActive    = false;
+    m_lastScanStart = m_passStart;
+    emit_changes(detectedAt);
+}
+
+bool FileWatcher::needs_relist(const EntryInfo& before, const EntryInfo& now) const {
+    return before.lastWrite != now.lastWrite || now.lastWrite + kRacyWindow >= m_lastScanStart;
+}
+
+FileWatcher::DirScan FileWatcher::scan_directory(NodeId dir, bool relist) const {
+    DirScan scan;
+    scan.dir    = dir;
+    scan.listed = relist;
+
+    const std::string path = m_tree.path(dir);
+
+    if (relist) {
+        scan.failed = !list_sorted(path, scan.entries);
+        return scan;
+    }
+
+    // Unchanged directory mtime: same set of names, so skip reading the
+    // directory and only re-stat what it held (contents can still change).
+    const auto children = m_tree.children(dir);
+    scan.entries.resize(children.size());
+    for (std::size_t i = 0; i < children.size(); ++i) {
+        auto& entry  = scan.entries[i];
+        entry.name   = m_tree.name(children[i]);
+        entry.exists = read_entry_info(join(path, entry.name), entry.info);
+    }
+    return scan;
+}
 
-        info.size = entry.is_regular_file() ? entry.file_size(ec) : 0;
-        if (ec) {
-            info.size = 0;
+void FileWatcher::apply_scan(DirScan& scan, std::vector<std::pair<NodeId, bool>>& subdirs,
+                             std::chrono::steady_clock::time_point detectedAt) {
+    if (scan.failed || !m_tree.alive(scan.dir)) {
+        return;
+    }
+
+    // Created and erased entries are reported once the scan or pass is
+    // done, so they can be paired into renames first.
+    auto eraseWithInfo = [this](NodeId node) {
+        m_tree.release(node, [this](NodeId n, std::string_view path) {
+            if (m_collecting) {
+                m_scanErased.emplace_back(std::string(path), m_tree.info(n));
+            }
+        });
+    };
+
+    auto create = [&](std::string_view name, const EntryInfo& info) {
+        const NodeId node = m_tree.create(scan.dir, name, info);
+        if (m_collecting) {
+            m_scanCreated.emplace_back(m_tree.path(node), info);
+        }
+        if (info.isDirectory && m_recursive) {
+            subdirs.emplace_back(node, true);
         }
+        return node;
+    };
 
-        outSnapshot.emplace(std::move(key), info);
+    auto refresh = [&](NodeId node, const EntryInfo& info) {
+        EntryInfo& old = m_tree.info(node);
+        const bool relist = info.isDirectory && needs_relist(old, info);
+        if (!same_info(old, info)) {
+            old = info;
+            push_event(FileChangeType::Modified, m_tree.path(node), detectedAt);
+        }
+        if (info.isDirectory && m_recursive) {
+            subdirs.emplace_back(node, relist);
+        }
     };
 
-    std::error_code ec;
-    if (m_recursive) {
-        for (fs::recursive_directory_iterator it(m_root, ec), end; it != end && !ec; it.increment(ec)) {
-            addEntry(*it);
+    const auto children = m_tree.children(scan.dir);
+    std::vector<NodeId> merged;
+    merged.reserve(std::max(children.size(), scan.entries.size()));
+
+    if (!scan.listed) {
+        for (std::size_t i = 0; i < children.size(); ++i) {
+            const NodeId node = children[i];
+            auto& entry = scan.entries[i];
+
+            if (!entry.exists) {
+                eraseWithInfo(node);
+            } else if (entry.info.isDirectory != m_tree.info(node).isDirectory) {
+                eraseWithInfo(node);
+                merged.push_back(create(entry.name, entry.info));
+            } else {
+                refresh(node, entry.info);
+                merged.push_back(node);
+            }
         }
     } else {
-        for (fs::directory_iterator it(m_root, ec), end; it != end && !ec; it.increment(ec)) {
-            addEntry(*it);
+        // Both sides are sorted by name: one merge pass.
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < scan.entries.size() || j < children.size()) {
+            const int order = i == scan.entries.size() ? 1
+                            : j == children.size()     ? -1
+                            : scan.entries[i].name.compare(m_tree.name(children[j]));
+
+            if (order < 0) {
+                merged.push_back(create(scan.entries[i].name, scan.entries[i].info));
+                ++i;
+            } else if (order > 0) {
+                eraseWithInfo(children[j]);
+                ++j;
+            } else {
+                const NodeId node = children[j];
+                auto& entry = scan.entries[i];
+                if (entry.info.isDirectory != m_tree.info(node).isDirectory) {
+                    eraseWithInfo(node);
+                    merged.push_back(create(entry.name, entry.info));
+                } else {
+                    refresh(node, entry.info);
+                    merged.push_back(node);
+                }
+                ++i;
+                ++j;
+            }
         }
     }
+
+    // 'children' views the old list, which stays intact until here.
+    m_tree.set_children(scan.dir, std::move(merged));
 }
 
 // -----------------------------------------------------------------------------
-// Diff computation
+// Diff reporting
 // -----------------------------------------------------------------------------
 
-void FileWatcher::compute_diff(const std::unordered_map<std::string, EntryInfo>& newSnapshot) {
+void FileWatcher::emit_changes(std::chrono::steady_clock::time_point detectedAt) {
+    // Renamed: an erased and a created entry that are the same file.
+    std::vector<bool> erasedMatched(m_scanErased.size(), false);
+    std::vector<bool> createdMatched(m_scanCreated.size(), false);
+
+    for (const auto& [createdIndex, erasedIndex] : match_renames(m_scanErased, m_scanCreated)) {
+        push_event(FileChangeType::Renamed, m_scanCreated[createdIndex].first, detectedAt,
+                   m_scanErased[erasedIndex].first);
+        createdMatched[createdIndex] = true;
+        erasedMatched[erasedIndex]   = true;
+    }
+
+    for (std::size_t i = 0; i < m_scanCreated.size(); ++i) {
+        if (!createdMatched[i]) {
+            push_event(FileChangeType::Created, m_scanCreated[i].first, detectedAt);
+        }
+    }
+
+    for (std::size_t i = 0; i < m_scanErased.size(); ++i) {
+        if (!erasedMatched[i]) {
+            push_event(FileChangeType::Erased, m_scanErased[i].first, detectedAt);
+        }
+    }
+
+    m_scanCreated.clear();
+    m_scanErased.clear();
+}
+
+// -----------------------------------------------------------------------------
+// Inotify backend
+// -----------------------------------------------------------------------------
+
+#if defined(__linux__)
+
+namespace {
+
+constexpr std::uint32_t kWatchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB |
+                                     IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+
+struct RawEvent {
+    int           wd;
+    std::uint32_t mask;
+    std::uint32_t cookie;
+    std::string   name;
+};
+
+} // namespace
+
+bool FileWatcher::start_inotify() {
+    const int fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        WAVE_LOG_CH_WARN(Filesystem, "inotify unavailable, polling ", m_root.string());
+        return false;
+    }
+
+    m_inotify = std::make_unique<Inotify>();
+    m_inotify->fd = fd;
+
+    watch_directory(SnapshotTree::kRoot, m_tree.root_key());
+    return m_inotify != nullptr;
+}
+
+void FileWatcher::watch_directory(NodeId dir, const std::string& path) {
+    if (!m_inotify) {
+        return;
+    }
+
+    const int wd = ::inotify_add_watch(m_inotify->fd, path.c_str(), kWatchMask);
+    if (wd < 0) {
+        if (errno == ENOSPC || errno == ENOMEM) {
+            // fs.inotify.max_user_watches exhausted; a partial set of watches
+            // would silently miss changes, so poll the whole tree instead.
+            WAVE_LOG_CH_WARN(Filesystem, "inotify watch limit reached, polling ", m_root.string());
+            m_inotify.reset();
+        }
+        return; // ENOENT etc.: the directory is already gone
+    }
+
+    // Same inode already watched under an older node: that node is stale.
+    if (auto it = m_inotify->dirs.find(wd); it != m_inotify->dirs.end() && it->second != dir) {
+        m_inotify->wds.erase(it->second);
+    }
+
+    m_inotify->dirs[wd]  = dir;
+    m_inotify->wds[dir]  = wd;
+}
+
+void FileWatcher::unwatch(NodeId dir) {
+    if (!m_inotify) {
+        return;
+    }
+
+    auto it = m_inotify->wds.find(dir);
+    if (it == m_inotify->wds.end()) {
+        return;
+    }
+
+    // Moved-away directories keep their watches; drop them so they do not
+    // report paths outside the tree.
+    ::inotify_rm_watch(m_inotify->fd, it->second);
+    m_inotify->dirs.erase(it->second);
+    m_inotify->wds.erase(it);
+}
+
+void FileWatcher::watch_all() {
+    if (!m_recursive) {
+        return;
+    }
+
+    m_tree.for_each_in(SnapshotTree::kRoot, [this](NodeId node, std::string_view path) {
+        if (node != SnapshotTree::kRoot && m_tree.info(node).isDirectory) {
+            watch_directory(node, std::string(path));
+        }
+    });
+}
+
+void FileWatcher::update_inotify() {
+    std::vector<RawEvent> raw;
+    bool overflow = false;
+
+    alignas(struct inotify_event) char buffer[64 * 1024];
+    for (;;) {
+        const ssize_t n = ::read(m_inotify->fd, buffer, sizeof(buffer));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            overflow = errno != EAGAIN; // unexpected error: resync below
+            break;
+        }
+        if (n == 0) {
+            break;
+        }
+
+        for (const char* p = buffer; p < buffer + n;) {
+            const auto* event = reinterpret_cast<const struct inotify_event*>(p);
+            if (event->mask & IN_Q_OVERFLOW) {
+                overflow = true;
+            } else {
+                raw.push_back({event->wd, event->mask, event->cookie,
+                               event->len > 0 ? std::string(event->name) : std::string()});
+            }
+            p += sizeof(struct inotify_event) + event->len;
+        }
+    }
+
+    if (overflow) {
+        // Events were lost; rebuild the watches and diff the whole tree once.
+        // Watches go in after the walk here, so a change in that gap shows
+        // up at the next overflow or restart; overflows are rare enough.
+        WAVE_LOG_CH_WARN(Filesystem, "inotify queue overflow, rescanning ", m_root.string());
+        m_inotify.reset();
+        start_inotify();
+        rescan();
+        watch_all();
+        return;
+    }
+
     const auto detectedAt = std::chrono::steady_clock::now();
+    std::vector<NodeId> touchedDirs;
 
-    // Track matches by key.
-    // Created: in newSnapshot but not in m_snapshot.
-    // Erased: in m_snapshot but not in newSnapshot.
-    // Modified: in both, but metadata differs.
-
-    // 1) Created + Modified
-    for (const auto& [pathKey, newInfo] : newSnapshot) {
-        auto oldIt = m_snapshot.find(pathKey);
-
-        if (oldIt == m_snapshot.end()) {
-            // New file or directory
-            FileChangeEvent evt{};
-            evt.type       = FileChangeType::Created;
-            evt.path       = fs::path(pathKey);
-            evt.detectedAt = detectedAt;
-            m_events.push_back(std::move(evt));
-        } else {
-            const EntryInfo& oldInfo = oldIt->second;
+    for (std::size_t i = 0; i < raw.size() && m_inotify; ++i) {
+        const RawEvent& event = raw[i];
 
-            const bool timeChanged = newInfo.lastWrite != oldInfo.lastWrite;
-            const bool sizeChanged = newInfo.size != oldInfo.size;
+        auto dirIt = m_inotify->dirs.find(event.wd);
+        if (event.mask & IN_IGNORED) {
+            if (dirIt != m_inotify->dirs.end()) {
+                if (auto wdIt = m_inotify->wds.find(dirIt->second);
+                    wdIt != m_inotify->wds.end() && wdIt->second == event.wd) {
+                    m_inotify->wds.erase(wdIt);
+                }
+                m_inotify->dirs.erase(dirIt);
+            }
+            continue;
+        }
+
+        // Events about a watched directory itself also arrive, named, on its
+        // parent's watch; only the named form is used.
+        if (dirIt == m_inotify->dirs.end() || event.name.empty()) {
+            continue;
+        }
 
-            if (timeChanged || sizeChanged) {
-                FileChangeEvent evt{};
-                evt.type       = FileChangeType::Modified;
-                evt.path       = fs::path(pathKey);
-                evt.detectedAt = detectedAt;
-                m_events.push_back(std::move(evt));
+        const NodeId dir = dirIt->second;
+        if (!m_tree.alive(dir)) {
+            continue;
+        }
+
+        if (event.mask & (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO)) {
+            touchedDirs.push_back(dir);
+        }
+
+        if (event.mask & IN_MOVED_FROM) {
+            // The kernel queues both halves of a rename back to back.
+            const bool paired = i + 1 < raw.size() && (raw[i + 1].mask & IN_MOVED_TO) &&
+                                raw[i + 1].cookie == event.cookie;
+            if (paired) {
+                const RawEvent& to = raw[++i];
+                auto toIt = m_inotify->dirs.find(to.wd);
+                if (toIt != m_inotify->dirs.end() && m_tree.alive(toIt->second)) {
+                    touchedDirs.push_back(toIt->second);
+                    on_renamed(dir, event.name, toIt->second, to.name, detectedAt);
+                    continue;
+                }
+            }
+            // Moved out of the tree.
+            if (const NodeId node = m_tree.child(dir, event.name); node != SnapshotTree::kNone) {
+                on_erased(node, detectedAt);
+            }
+        } else if (event.mask & (IN_CREATE | IN_MOVED_TO)) {
+            on_created(dir, event.name, detectedAt);
+        } else if (event.mask & IN_DELETE) {
+            if (const NodeId node = m_tree.child(dir, event.name); node != SnapshotTree::kNone) {
+                on_erased(node, detectedAt);
+            }
+        } else if (event.mask & (IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB)) {
+            if (const NodeId node = m_tree.child(dir, event.name); node != SnapshotTree::kNone) {
+                on_modified(node, detectedAt);
+            } else {
+                on_created(dir, event.name, detectedAt);
             }
         }
     }
 
-    // 2) Erased
-    for (const auto& [pathKey, oldInfo] : m_snapshot) {
-        (void)oldInfo;
+    if (!m_inotify) {
+        // Ran out of watches while following new directories.
+        rescan();
+        return;
+    }
 
-        if (newSnapshot.find(pathKey) == newSnapshot.end()) {
-            FileChangeEvent evt{};
-            evt.type       = FileChangeType::Erased;
-            evt.path       = fs::path(pathKey);
-            evt.detectedAt = detectedAt;
-            m_events.push_back(std::move(evt));
+    // Entries added or removed change the parent's mtime; keep it current
+    // (and report it, as the polling backend does).
+    std::sort(touchedDirs.begin(), touchedDirs.end());
+    touchedDirs.erase(std::unique(touchedDirs.begin(), touchedDirs.end()), touchedDirs.end());
+    for (const NodeId dir : touchedDirs) {
+        if (dir != SnapshotTree::kRoot && m_tree.alive(dir)) {
+            on_modified(dir, detectedAt);
         }
     }
+}
+
+#else
+
+bool FileWatcher::start_inotify() { return false; }
+void FileWatcher::watch_directory(NodeId, const std::string&) {}
+void FileWatcher::unwatch(NodeId) {}
+void FileWatcher::watch_all() {}
+void FileWatcher::update_inotify() { rescan(); }
+
+#endif
+
+// -----------------------------------------------------------------------------
+// Incremental snapshot maintenance
+// -----------------------------------------------------------------------------
+
+void FileWatcher::populate(NodeId dir, const std::string& path, std::chrono::steady_clock::time_point detectedAt) {
+    // Watch before listing, so nothing created meanwhile is missed.
+    if (m_inotify && (m_recursive || dir == SnapshotTree::kRoot)) {
+        watch_directory(dir, path);
+    }
+
+    if (dir == SnapshotTree::kRoot) {
+        EntryInfo rootInfo{};
+        if (read_entry_info(path, rootInfo)) {
+            m_tree.info(dir) = rootInfo;
+        }
+    }
+
+    std::vector<ScanEntry> entries;
+    if (!list_sorted(path, entries)) {
+        return;
+    }
+
+    // Entries events already added stay; the rest are new.
+    std::vector<NodeId> merged(m_tree.children(dir).begin(), m_tree.children(dir).end());
+    std::vector<std::pair<NodeId, std::string>> subdirs;
+
+    for (const auto& entry : entries) {
+        if (m_tree.child(dir, entry.name) != SnapshotTree::kNone) {
+            continue;
+        }
+
+        const NodeId node = m_tree.create(dir, entry.name, entry.info);
+        merged.push_back(node);
+
+        std::string childPath = join(path, entry.name);
+        push_event(FileChangeType::Created, childPath, detectedAt);
+        if (entry.info.isDirectory && m_recursive) {
+            subdirs.emplace_back(node, std::move(childPath));
+        }
+    }
+
+    std::sort(merged.begin(), merged.end(),
+              [this](NodeId a, NodeId b) { return m_tree.name(a) < m_tree.name(b); });
+    m_tree.set_children(dir, std::move(merged));
+
+    for (const auto& [node, childPath] : subdirs) {
+        populate(node, childPath, detectedAt);
+    }
+}
+
+void FileWatcher::on_created(NodeId dir, std::string_view name, std::chrono::steady_clock::time_point detectedAt) {
+    if (const NodeId existing = m_tree.child(dir, name); existing != SnapshotTree::kNone) {
+        on_modified(existing, detectedAt);
+        return;
+    }
+
+    const std::string path = join(m_tree.path(dir), name);
+
+    EntryInfo info{};
+    if (!read_entry_info(path, info)) {
+        return; // already gone again, or not a file / directory
+    }
+
+    const NodeId node = m_tree.insert(dir, name, info);
+    push_event(FileChangeType::Created, path, detectedAt);
+
+    // Contents may have been created before the watch existed (mkdir -p,
+    // directory moved in, archive extracted); pick them up now.
+    if (info.isDirectory && m_recursive) {
+        populate(node, path, detectedAt);
+    }
+}
+
+void FileWatcher::on_modified(NodeId node, std::chrono::steady_clock::time_point detectedAt) {
+    if (node == SnapshotTree::kRoot) {
+        return; // the root itself is not part of the snapshot
+    }
+
+    const std::string path = m_tree.path(node);
+
+    EntryInfo info{};
+    if (!read_entry_info(path, info)) {
+        return; // deleted; its own event follows
+    }
+
+    EntryInfo& old = m_tree.info(node);
+    if (info.isDirectory != old.isDirectory) {
+        // Replaced by something of the other kind.
+        const NodeId dir = m_tree.parent(node);
+        const std::string name(m_tree.name(node));
+        on_erased(node, detectedAt);
+        on_created(dir, name, detectedAt);
+        return;
+    }
+
+    if (!same_info(info, old)) {
+        old = info;
+        push_event(FileChangeType::Modified, path, detectedAt);
+    }
+}
+
+void FileWatcher::on_erased(NodeId node, std::chrono::steady_clock::time_point detectedAt) {
+    m_tree.erase(node, [this, detectedAt](NodeId n, std::string_view path) {
+        push_event(FileChangeType::Erased, std::string(path), detectedAt);
+        unwatch(n);
+    });
+}
+
+void FileWatcher::on_renamed(NodeId fromDir, std::string_view fromName, NodeId toDir, std::string_view toName,
+                             std::chrono::steady_clock::time_point detectedAt) {
+    const NodeId node = m_tree.child(fromDir, fromName);
+    if (node == SnapshotTree::kNone) {
+        on_created(toDir, toName, detectedAt);
+        return;
+    }
+
+    // Whatever the move replaced is gone.
+    if (const NodeId target = m_tree.child(toDir, toName); target != SnapshotTree::kNone && target != node) {
+        on_erased(target, detectedAt);
+    }
+
+    // Every path below moves with it; the subtree (and its watches, which
+    // follow the inode) is relinked, not rebuilt. Child order is unchanged,
+    // so both walks visit the same nodes in the same order.
+    std::vector<std::string> oldPaths;
+    m_tree.for_each_in(node, [&oldPaths](NodeId, std::string_view path) { oldPaths.emplace_back(path); });
+
+    m_tree.move(node, toDir, toName);
+
+    std::size_t index = 0;
+    m_tree.for_each_in(node, [&](NodeId n, std::string_view path) {
+        if (n == node) {
+            EntryInfo info = m_tree.info(n);
+            if (read_entry_info(fs::path(path), info)) {
+                m_tree.info(n) = info;
+            }
+        }
+        push_event(FileChangeType::Renamed, std::string(path), detectedAt, oldPaths[index++]);
+    });
+}
+
+// -----------------------------------------------------------------------------
+// Debouncing
+// -----------------------------------------------------------------------------
+
+void FileWatcher::push_event(FileChangeType type, const std::string& key,
+                             std::chrono::steady_clock::time_point detectedAt, const std::string& oldKey) {
+    if (!m_collecting) {
+        return;
+    }
+
+    switch (type) {
+        case FileChangeType::Created: {
+            auto& change = m_pending[pending_index(key, false)];
+            change.existsNow = true;
+            change.changed   = true;
+            change.lastSeen  = detectedAt;
+            break;
+        }
+        case FileChangeType::Modified: {
+            auto& change = m_pending[pending_index(key, true)];
+            change.existsNow = true;
+            change.changed   = true;
+            change.lastSeen  = detectedAt;
+            break;
+        }
+        case FileChangeType::Erased: {
+            auto& change = m_pending[pending_index(key, true)];
+            change.existsNow = false;
+            change.lastSeen  = detectedAt;
+            break;
+        }
+        case FileChangeType::Renamed: {
+            const std::size_t from = pending_index(oldKey, true);
+            m_pending[from].existsNow = false;
+            m_pending[from].lastSeen  = detectedAt;
+
+            // Follow chains (a -> tmp -> b) back to the path consumers know;
+            // a source that only appeared within the window has none.
+            std::string origin;
+            if (!m_pending[from].renamedFrom.empty()) {
+                origin = std::move(m_pending[from].renamedFrom);
+                m_pending[from].renamedFrom.clear();
+            } else if (m_pending[from].existedBefore) {
+                origin = oldKey;
+            }
+
+            const std::size_t to = pending_index(key, false);
+            auto& change = m_pending[to];
+            change.existsNow = true;
+            change.changed   = true;
+            change.lastSeen  = detectedAt;
+
+            if (!origin.empty() && origin != key) {
+                change.renamedFrom = origin;
+                auto& source = m_pending[m_pendingIndex.at(origin)];
+                source.movedTo  = key;
+                source.lastSeen = detectedAt;
+            } else if (origin == key) {
+                // Moved back where it started.
+                change.movedTo.clear();
+            }
+            break;
+        }
+    }
+}
+
+std::size_t FileWatcher::pending_index(const std::string& key, bool existedBefore) {
+    auto [it, inserted] = m_pendingIndex.try_emplace(key, m_pending.size());
+    if (inserted) {
+        PendingChange change;
+        change.key           = key;
+        change.existedBefore = existedBefore;
+        m_pending.push_back(std::move(change));
+    }
+    return it->second;
+}
+
+void FileWatcher::flush_pending(std::chrono::steady_clock::time_point now) {
+    if (m_pending.empty()) {
+        return;
+    }
+
+    auto emit = [this](FileChangeType type, const PendingChange& change, const std::string& oldKey = {}) {
+        FileChangeEvent evt{};
+        evt.type       = type;
+        evt.path       = fs::path(change.key);
+        evt.oldPath    = oldKey.empty() ? fs::path() : fs::path(oldKey);
+        evt.detectedAt = change.lastSeen;
+        m_events.push_back(std::move(evt));
+    };
+
+    // Net effect of one path on its own.
+    auto emitNet = [&emit](PendingChange& change) {
+        if (!change.existedBefore && change.existsNow) {
+            emit(FileChangeType::Created, change);
+        } else if (change.existedBefore && !change.existsNow) {
+            emit(FileChangeType::Erased, change);
+        } else if (change.existedBefore && change.existsNow && change.changed) {
+            emit(FileChangeType::Modified, change);
+        }
+        change.delivered = true;
+    };
+
+    auto quiet = [this, now](const PendingChange& change) { return now - change.lastSeen >= m_debounce; };
+
+    // Delivering a move target releases its source, which may itself be a
+    // target waiting on this one; go round until nothing more is ready.
+    for (bool progress = true; progress;) {
+        progress = false;
+
+        for (auto& change : m_pending) {
+            if (change.delivered || !change.movedTo.empty() || !quiet(change)) {
+                continue;
+            }
+
+            if (change.renamedFrom.empty()) {
+                emitNet(change);
+                continue;
+            }
+
+            auto& source = m_pending[m_pendingIndex.at(change.renamedFrom)];
+            source.movedTo.clear();
+            progress = true;
+
+            if (!change.existedBefore && change.existsNow) {
+                // A plain move: the source path no longer exists downstream.
+                emit(FileChangeType::Renamed, change, source.key);
+                change.delivered     = true;
+                source.existedBefore = false;
+            } else {
+                // Moved over an existing file (or moved and deleted again):
+                // the target keeps its own identity and the source goes away.
+                emitNet(change);
+            }
+        }
+    }
+
+    std::erase_if(m_pending, [](const PendingChange& change) { return change.delivered; });
+
+    m_pendingIndex.clear();
+    for (std::size_t i = 0; i < m_pending.size(); ++i) {
+        m_pendingIndex.emplace(m_pending[i].key, i);
+    }
+}
+
+std::optional<std::chrono::steady_clock::duration> FileWatcher::next_flush(
+    std::chrono::steady_clock::time_point now) const {
+    if (m_pending.empty()) {
+        return std::nullopt;
+    }
+
+    // Move sources go out with their target, so only targets and plain
+    // changes set the deadline.
+    auto soonest = std::chrono::steady_clock::time_point::max();
+    for (const auto& change : m_pending) {
+        if (change.movedTo.empty()) {
+            soonest = std::min(soonest, change.lastSeen + m_debounce);
+        }
+    }
+    if (soonest == std::chrono::steady_clock::time_point::max()) {
+        return std::nullopt;
+    }
 
-    // 3) Renames (optional heuristic)
-    //
-    // Accurate rename detection is platform-specific; with pure snapshots
-    // we cannot know for sure whether "A was renamed to B" or "A deleted, B created".
-    //
-    // For now we leave rename detection out or could add a heuristic later.
+    return std::max<std::chrono::steady_clock::duration>(soonest - now, std::chrono::milliseconds(1));
 }
 
 } // namespace wave::engine::core::filesystem
@@ -6,6 +6,18 @@
 #include <chrono>
 #include <filesystem>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <stop_token>
+#include <string_view>
+
+#include "engine/core/filesystem/snapshot_tree.hpp"
+
+namespace wave::engine::core::jobs {
+class JobSystem;
+}
 
 namespace wave::engine::core::filesystem {
 
@@ -31,63 +43,230 @@ struct FileChangeEvent {
     std::chrono::steady_clock::time_point detectedAt;
 };
 
-// Simple snapshot-based file watcher.
-// It periodically scans a directory tree and reports differences as events.
+// File watcher reporting changes under a directory tree as events.
+//
+// Backends:
+//   - Inotify: Linux kernel notifications. Every directory gets a watch
+//              when it is first seen, and update() only drains the events
+//              the kernel queued, so its cost is O(changes), not O(tree).
+//              A queue overflow falls back to one full rescan + diff.
+//   - Polling: each update() walks the whole tree and diffs it against the
+//              last snapshot. Used off Linux, when inotify is unavailable
+//              (watch limit reached, some network mounts) or not allowed.
+//              With a JobSystem the walk is split by subdirectory across
+//              workers; with a scan budget each update() lists only part
+//              of the tree and a full pass is spread over several calls.
+//
+// Either way the watcher keeps a snapshot of the tree (see find/for_each)
+// and events are retrieved with poll_events().
+//
+// Renames are recognised by file identity (device + inode) as well as from
+// inotify's move pairs, so a moved file keeps its identity downstream. A
+// renamed directory reports a Renamed event for itself and every entry in it.
 //
-// Design:
-//   - You specify a root directory and whether to watch recursively.
-//   - Each call to update() computes differences vs the last snapshot.
-//   - Events are stored internally and can be retrieved with poll_events().
+// Events are coalesced per path before delivery: each path yields at most
+// one event per poll_events(), and with a debounce window it is held until
+// the path has been quiet that long. Save-via-temp-file (write a.tmp, rename
+// over a.txt) then arrives as a single Modified for a.txt.
+//
+// By default the owner drives the watcher with update(). start() hands that
+// to a watcher-owned thread instead; see "Background mode" below.
 class FileWatcher final {
 public:
-    FileWatcher() = default;
-    explicit FileWatcher(fs::path root, bool recursive = true);
+    enum class Backend {
+        Polling,
+        Inotify
+    };
+
+    // What the last scan saw for one path.
+    using EntryInfo = FileEntryInfo;
+
+    FileWatcher();
+    explicit FileWatcher(fs::path root, bool recursive = true, bool allowNative = true);
 
     FileWatcher(const FileWatcher&) = delete;
     FileWatcher& operator=(const FileWatcher&) = delete;
 
-    FileWatcher(FileWatcher&&) noexcept = default;
-    FileWatcher& operator=(FileWatcher&&) noexcept = default;
+    // The background thread points back at the watcher.
+    FileWatcher(FileWatcher&&) noexcept = delete;
+    FileWatcher& operator=(FileWatcher&&) noexcept = delete;
 
-    ~FileWatcher() = default;
+    ~FileWatcher();
 
     // Set / change the root directory being watched.
-    // Clears previous snapshot and events.
-    void set_root(fs::path root, bool recursive = true);
+    // Clears previous snapshot and events. 'allowNative' = false forces the
+    // polling backend. A running background thread is restarted.
+    void set_root(fs::path root, bool recursive = true, bool allowNative = true);
 
     const fs::path& root() const { return m_root; }
     bool recursive() const { return m_recursive; }
+    Backend backend() const { return m_inotify ? Backend::Inotify : Backend::Polling; }
+
+    // Polling backend tuning ----------------------------------------------------
 
-    // Perform a scan and generate events for any detected changes.
+    // Full scans are split across this JobSystem's workers (null = serial).
+    // Must outlive the watcher or be reset.
+    void set_job_system(jobs::JobSystem* jobs) { m_jobs = jobs; }
+
+    // Max entries listed per update() (0 = whole tree every update). A
+    // directory is always listed in full, so a call may overshoot by one
+    // directory's worth. Modified is reported as each slice is scanned;
+    // Created and Erased once a full pass completes, so they can be paired
+    // into renames.
+    void set_scan_budget(std::size_t entriesPerUpdate) { m_scanBudget = entriesPerUpdate; }
+    std::size_t scan_budget() const { return m_scanBudget; }
+
+    // True while an incremental pass is partway through the tree.
+    bool scan_in_progress() const { return m_passActive; }
+
+    // Hold events until their path has been quiet for 'window' (0 = deliver
+    // on the next poll_events(), still coalesced).
+    void set_debounce(std::chrono::milliseconds window) { m_debounce = window; }
+    std::chrono::milliseconds debounce() const { return m_debounce; }
+
+    // Collect changes since the last call and generate events for them.
     // Intended to be called periodically (e.g. once per frame, or via TaskScheduler).
+    // Does nothing while running().
     void update();
 
-    // Retrieve and clear the accumulated events.
+    // Retrieve and clear the accumulated events that are past the debounce
+    // window. Never blocks; while running() it only takes what the thread
+    // has published.
     std::vector<FileChangeEvent> poll_events();
 
+    // Background mode -----------------------------------------------------------
+    //
+    // start() runs update() on a thread owned by the watcher. With inotify the
+    // thread sleeps in poll() until the kernel has events for it (or a
+    // debounce window ends); the polling backend, and inotify while the root
+    // is missing, rescan every 'pollInterval'. Events are published through a
+    // lock-free queue, so poll_events() is one atomic load while nothing
+    // changes and the owner's thread does no scanning at all.
+    //
+    // The tuning setters above must be called while stopped. stop() joins the
+    // thread; events it had not handed out yet are returned by the next
+    // poll_events().
+    void start(std::chrono::milliseconds pollInterval = std::chrono::milliseconds(250));
+    void stop();
+    bool running() const { return m_background != nullptr; }
+
     // Returns true if the watcher has a valid root directory.
     bool valid() const { return !m_root.empty(); }
 
+    // Snapshot queries --------------------------------------------------------
+    //
+    // State as of the last update(). Paths are normalized generic strings
+    // under root(), in the same form as FileChangeEvent::path.
+    //
+    // Safe to call while running(): they wait for the change being applied,
+    // if any. find()'s pointer is only valid until the next change though, so
+    // other threads should use lookup().
+
+    const EntryInfo* find(std::string_view path) const;
+
+    std::optional<EntryInfo> lookup(std::string_view path) const;
+
+    void for_each(const std::function<void(std::string_view path, const EntryInfo& info)>& fn) const;
+
+    std::size_t entry_count() const;
+
 private:
     using TimePoint = std::filesystem::file_time_type;
 
-    struct EntryInfo {
-        TimePoint lastWrite;
-        std::uintmax_t size;
-    };
+    using NodeId = SnapshotTree::NodeId;
+
+    struct Inotify;
+    struct DirScan;   // one directory's scan result
 
     void clear_snapshot();
-    void snapshot_current(std::unordered_map<std::string, EntryInfo>& outSnapshot);
-    void compute_diff(const std::unordered_map<std::string, EntryInfo>& newSnapshot);
+    void update_now();
+
+    // Background thread: apply changes, publish events, sleep until the next
+    // kernel event, poll interval or debounce deadline.
+    struct Background;
+
+    void watch_loop(std::stop_token stopToken);
+    void wait_for_changes(std::stop_token stopToken, std::optional<std::chrono::steady_clock::duration> flushIn);
+
+    // Polling scan. scan_directory() only reads the tree, so a depth level
+    // can be scanned on workers; apply_scan() merges one result in on the
+    // calling thread and queues the subdirectories to visit next.
+    void    rescan();
+    void    rescan_slice();
+    DirScan scan_directory(NodeId dir, bool relist) const;
+    void    apply_scan(DirScan& scan, std::vector<std::pair<NodeId, bool>>& subdirs,
+                       std::chrono::steady_clock::time_point detectedAt);
+    bool    needs_relist(const EntryInfo& before, const EntryInfo& now) const;
+    void    emit_changes(std::chrono::steady_clock::time_point detectedAt);
+
+    // Inotify backend (no-ops elsewhere).
+    bool start_inotify();
+    void watch_directory(NodeId dir, const std::string& path);
+    void unwatch(NodeId dir);
+    void watch_all();
+    void update_inotify();
+
+    // Incremental snapshot maintenance used by the inotify backend.
+    void populate(NodeId dir, const std::string& path, std::chrono::steady_clock::time_point detectedAt);
+    void on_created(NodeId dir, std::string_view name, std::chrono::steady_clock::time_point detectedAt);
+    void on_modified(NodeId node, std::chrono::steady_clock::time_point detectedAt);
+    void on_erased(NodeId node, std::chrono::steady_clock::time_point detectedAt);
+    void on_renamed(NodeId fromDir, std::string_view fromName, NodeId toDir, std::string_view toName,
+                    std::chrono::steady_clock::time_point detectedAt);
+
+    // Debouncing: raw changes are folded into one PendingChange per path,
+    // turned into events once the path is quiet.
+    struct PendingChange;
+
+    void push_event(FileChangeType type, const std::string& key,
+                    std::chrono::steady_clock::time_point detectedAt, const std::string& oldKey = {});
+    std::size_t pending_index(const std::string& key, bool existedBefore);
+    void flush_pending(std::chrono::steady_clock::time_point now);
+
+    // Time until the next pending change is quiet; nullopt if none are held.
+    std::optional<std::chrono::steady_clock::duration> next_flush(std::chrono::steady_clock::time_point now) const;
 
 private:
     fs::path m_root;
     bool     m_recursive{true};
+    bool     m_allowNative{true};
+    bool     m_restartNative{false};   // inotify dropped because the root vanished
+    bool     m_collecting{true};       // false while taking the initial snapshot
+
+    std::unique_ptr<Inotify> m_inotify;
+
+    jobs::JobSystem* m_jobs{nullptr};
+    std::size_t      m_scanBudget{0};
+
+    // The snapshot: root_key() is the normalized generic root.
+    SnapshotTree m_tree;
 
-    // Map of path (string form, normalized) to entry info
-    std::unordered_map<std::string, EntryInfo> m_snapshot;
+    // Start of the last completed scan; directories with an mtime before
+    // it (minus slack) and unchanged since are not listed again.
+    fs::file_time_type m_lastScanStart{};
+
+    // Incremental pass state: directories still to visit (and whether to
+    // list them), and when the pass started.
+    bool                                 m_passActive{false};
+    std::vector<std::pair<NodeId, bool>> m_passDirs;
+    fs::file_time_type                   m_passStart{};
+
+    // Created / erased entries of the current scan or pass, reported at its
+    // end once renames have been paired up.
+    std::vector<std::pair<std::string, EntryInfo>> m_scanCreated;
+    std::vector<std::pair<std::string, EntryInfo>> m_scanErased;
 
     std::vector<FileChangeEvent> m_events;
+
+    std::chrono::milliseconds                    m_debounce{0};
+    std::vector<PendingChange>                   m_pending;
+    std::unordered_map<std::string, std::size_t> m_pendingIndex;
+
+    // Background mode. While it runs, the thread owns everything above and
+    // holds m_snapshotMutex exclusively whenever it changes the snapshot.
+    std::unique_ptr<Background> m_background;
+    std::chrono::milliseconds   m_pollInterval{250};
+    mutable std::shared_mutex   m_snapshotMutex;
 };
 
 } // namespace wave::engine::core::filesystem
@@ -0,0 +1,246 @@
+#include "engine/core/filesystem/mapped_file.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <new>
+#include <utility>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace wave::engine::core::filesystem
+{
+    namespace
+    {
+#if defined(_WIN32)
+        // Zero-length files have nothing to map; they still open successfully.
+        constexpr std::uint8_t kEmpty[1] = {};
+#else
+        int to_madvise(MapAccess access)
+        {
+            switch (access)
+            {
+                case MapAccess::Random:   return MADV_RANDOM;
+                case MapAccess::WillNeed: return MADV_WILLNEED;
+                default:                  return MADV_SEQUENTIAL;
+            }
+        }
+#endif
+    } // namespace
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        swap(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            swap(other);
+        }
+        return *this;
+    }
+
+    void MappedFile::swap(MappedFile& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_open, other.m_open);
+        std::swap(m_mapping, other.m_mapping);
+        std::swap(m_buffer, other.m_buffer);
+        std::swap(m_owner, other.m_owner);
+    }
+
+    void MappedFile::close() noexcept
+    {
+        if (m_mapping)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(m_mapping);
+#else
+            ::munmap(m_mapping, m_size);
+#endif
+        }
+
+        m_mapping = nullptr;
+        m_buffer.reset();
+        m_owner.reset();
+        m_data = nullptr;
+        m_size = 0;
+        m_open = false;
+    }
+
+    void MappedFile::borrow(std::span<const std::uint8_t> bytes, std::shared_ptr<const void> owner) noexcept
+    {
+        close();
+
+        m_owner = std::move(owner);
+        m_data = bytes.data();
+        m_size = bytes.size();
+        m_open = true;
+    }
+
+    void MappedFile::adopt(std::unique_ptr<std::uint8_t[]> buffer, std::size_t size) noexcept
+    {
+        close();
+
+        m_buffer = std::move(buffer);
+        m_data   = m_buffer.get();
+        m_size   = size;
+        m_open   = true;
+    }
+
+#if defined(_WIN32)
+
+    bool MappedFile::open(const fs::path& path, MapAccess access) noexcept
+    {
+        close();
+
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                  nullptr, OPEN_EXISTING,
+                                  access == MapAccess::Random ? FILE_FLAG_RANDOM_ACCESS
+                                                              : FILE_FLAG_SEQUENTIAL_SCAN,
+                                  nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        if (size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            m_data = kEmpty;
+            m_open = true;
+            return true;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+
+        if (mapping)
+        {
+            void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+
+            if (view)
+            {
+                m_mapping = view;
+                m_data    = static_cast<const std::uint8_t*>(view);
+                m_size    = static_cast<std::size_t>(size.QuadPart);
+                m_open    = true;
+                return true;
+            }
+        }
+
+        return read_fallback(path);
+    }
+
+#else
+
+    bool MappedFile::open(const fs::path& path, MapAccess access) noexcept
+    {
+        close();
+
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        // Pipes, devices and /proc files (regular, but size 0) have no usable
+        // size; read them instead. Genuinely empty files end up here too.
+        if (!S_ISREG(st.st_mode) || st.st_size == 0)
+        {
+            ::close(fd);
+            return read_fallback(path);
+        }
+
+        const auto size = static_cast<std::size_t>(st.st_size);
+        void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // The mapping keeps its own reference to the file.
+        ::close(fd);
+
+        if (view == MAP_FAILED)
+            return read_fallback(path);
+
+        ::madvise(view, size, to_madvise(access));
+
+        m_mapping = view;
+        m_data    = static_cast<const std::uint8_t*>(view);
+        m_size    = size;
+        m_open    = true;
+        return true;
+    }
+
+#endif
+
+    bool MappedFile::read_fallback(const fs::path& path) noexcept
+    {
+        std::FILE* file = std::fopen(path.string().c_str(), "rb");
+        if (!file)
+            return false;
+
+        // Size may be unknown (pipes); grow as needed.
+        std::size_t capacity = 64u << 10;
+        std::size_t used     = 0;
+        std::unique_ptr<std::uint8_t[]> buffer(new (std::nothrow) std::uint8_t[capacity]);
+
+        while (buffer)
+        {
+            used += std::fread(buffer.get() + used, 1, capacity - used, file);
+            if (used < capacity)
+                break;
+
+            std::unique_ptr<std::uint8_t[]> bigger(new (std::nothrow) std::uint8_t[capacity * 2]);
+            if (bigger)
+            {
+                std::copy(buffer.get(), buffer.get() + used, bigger.get());
+                capacity *= 2;
+            }
+            buffer = std::move(bigger);
+        }
+
+        const bool ok = buffer && std::ferror(file) == 0;
+        std::fclose(file);
+
+        if (!ok)
+            return false;
+
+        m_buffer = std::move(buffer);
+        m_data   = m_buffer.get();
+        m_size   = used;
+        m_open   = true;
+        return true;
+    }
+
+} // namespace wave::engine::core::filesystem
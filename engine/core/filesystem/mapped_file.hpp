@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace wave::engine::core::filesystem
+{
+    namespace fs = std::filesystem;
+
+    // How a mapping is going to be read; forwarded to madvise() where available.
+    enum class MapAccess
+    {
+        Sequential,   // read front to back once (shaders, configs)
+        Random,       // lookups all over the file (archives, indices)
+        WillNeed      // whole file needed soon; start read-ahead now
+    };
+
+    // Read-only view of a whole file.
+    //
+    // Backed by mmap / MapViewOfFile, so the bytes are the page cache pages
+    // themselves: no copy into a heap buffer and no second copy of the file
+    // in memory. When mapping is not possible (special files, exotic
+    // filesystems) the file is read into an owned buffer instead; callers see
+    // the same span either way.
+    //
+    // The view stays valid until close() / destruction. The data is at least
+    // 16-byte aligned (page aligned when mapped), so it can be reinterpreted
+    // as uint32_t words, e.g. SPIR-V.
+    //
+    // Files replaced via write-to-temp + rename are safe to keep mapped;
+    // truncating a mapped file in place is not (SIGBUS on access).
+    //
+    // Move-only.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&)            = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        // Map 'path' read-only. Replaces any previous mapping.
+        // Returns false if the file cannot be opened or read.
+        bool open(const fs::path& path, MapAccess access = MapAccess::Sequential) noexcept;
+        void close() noexcept;
+
+        // Point at bytes owned elsewhere, e.g. an uncompressed entry of a
+        // mounted PakArchive. 'owner' (if any) is kept alive until close(),
+        // so the bytes stay valid even if the owner is dropped elsewhere
+        // meanwhile (an archive unmounted under live views); without one,
+        // 'bytes' must outlive this object.
+        void borrow(std::span<const std::uint8_t> bytes, std::shared_ptr<const void> owner = {}) noexcept;
+
+        // Take ownership of an already filled buffer (decoded pak entries).
+        void adopt(std::unique_ptr<std::uint8_t[]> buffer, std::size_t size) noexcept;
+
+        [[nodiscard]] bool is_open() const noexcept { return m_open; }
+
+        // True when backed by a mapping rather than the read fallback.
+        [[nodiscard]] bool is_mapped() const noexcept { return m_mapping != nullptr; }
+
+        [[nodiscard]] const std::uint8_t* data() const noexcept { return m_data; }
+        [[nodiscard]] std::size_t         size() const noexcept { return m_size; }
+        [[nodiscard]] bool                empty() const noexcept { return m_size == 0; }
+
+        [[nodiscard]] std::span<const std::uint8_t> bytes() const noexcept { return { m_data, m_size }; }
+
+        [[nodiscard]] std::string_view text() const noexcept
+        {
+            return { reinterpret_cast<const char*>(m_data), m_size };
+        }
+
+    private:
+        bool read_fallback(const fs::path& path) noexcept;
+        void swap(MappedFile& other) noexcept;
+
+    private:
+        const std::uint8_t* m_data = nullptr;
+        std::size_t         m_size = 0;
+        bool                m_open = false;
+
+        // Start of the mapping (nullptr when not mapped).
+        void*               m_mapping = nullptr;
+
+        // Read fallback storage.
+        std::unique_ptr<std::uint8_t[]> m_buffer;
+
+        // Owner of borrowed bytes.
+        std::shared_ptr<const void>     m_owner;
+    };
+
+} // namespace wave::engine::core::filesystem
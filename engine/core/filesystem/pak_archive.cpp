@@ -0,0 +1,147 @@
+#include "engine/core/filesystem/pak_archive.hpp"
+
+#include "engine/core/utils/hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace wave::engine::core::filesystem
+{
+    bool PakArchive::fail(std::string message)
+    {
+        m_error = std::move(message);
+        m_toc   = {};
+        m_names = {};
+        m_file.close();
+        return false;
+    }
+
+    bool PakArchive::open(const fs::path& path)
+    {
+        close();
+        m_path = path;
+
+        if (!m_file.open(path, MapAccess::Random))
+            return fail("cannot open archive");
+
+        const std::uint8_t* base = m_file.data();
+        const std::uint64_t size = m_file.size();
+
+        if (size < sizeof(PakHeader))
+            return fail("file too small");
+
+        PakHeader header;
+        std::memcpy(&header, base, sizeof(header));
+
+        if (std::memcmp(header.magic, kPakMagic, sizeof(kPakMagic)) != 0)
+            return fail("not a .wpak archive");
+
+        if (header.version != kPakVersion)
+            return fail("unsupported .wpak version " + std::to_string(header.version));
+
+        if (header.file_size != size)
+            return fail("archive is truncated or was modified");
+
+        const std::uint64_t toc_bytes = std::uint64_t(header.entry_count) * sizeof(PakTocEntry);
+        if (header.toc_offset % alignof(PakTocEntry) != 0 ||
+            header.toc_offset > size || toc_bytes > size - header.toc_offset ||
+            header.names_offset > size || header.names_size > size - header.names_offset)
+        {
+            return fail("corrupt table of contents");
+        }
+
+        m_toc   = { reinterpret_cast<const PakTocEntry*>(base + header.toc_offset), header.entry_count };
+        m_names = { reinterpret_cast<const char*>(base + header.names_offset),
+                    static_cast<std::size_t>(header.names_size) };
+
+        for (std::size_t i = 0; i < m_toc.size(); ++i)
+        {
+            const PakTocEntry& entry = m_toc[i];
+
+            if (entry.offset > size || entry.stored_size > size - entry.offset ||
+                std::uint64_t(entry.name_offset) + entry.name_size > m_names.size())
+            {
+                return fail("corrupt entry " + std::to_string(i));
+            }
+
+            if (entry.compression > static_cast<std::uint8_t>(PakCompression::Zstd) ||
+                (entry.compression == static_cast<std::uint8_t>(PakCompression::None) &&
+                 entry.stored_size != entry.size))
+            {
+                return fail("corrupt entry " + std::to_string(i));
+            }
+
+            if (i > 0 && entry.path_hash < m_toc[i - 1].path_hash)
+                return fail("table of contents is not sorted");
+        }
+
+        m_error.clear();
+        return true;
+    }
+
+    void PakArchive::close()
+    {
+        m_file.close();
+        m_toc   = {};
+        m_names = {};
+        m_error.clear();
+    }
+
+    const PakTocEntry* PakArchive::find(std::string_view path) const
+    {
+        return find_normalized(normalize_pak_path(path));
+    }
+
+    const PakTocEntry* PakArchive::find_normalized(std::string_view path) const
+    {
+        const std::uint64_t hash = utils::fnv1a_64(path);
+
+        auto it = std::lower_bound(m_toc.begin(), m_toc.end(), hash,
+                                   [](const PakTocEntry& entry, std::uint64_t value)
+                                   {
+                                       return entry.path_hash < value;
+                                   });
+
+        // Entries with equal hashes are adjacent; compare names to rule out collisions.
+        for (; it != m_toc.end() && it->path_hash == hash; ++it)
+        {
+            if (name(*it) == path)
+                return &*it;
+        }
+
+        return nullptr;
+    }
+
+    std::string_view PakArchive::name(const PakTocEntry& entry) const noexcept
+    {
+        return m_names.substr(entry.name_offset, entry.name_size);
+    }
+
+    std::span<const std::uint8_t> PakArchive::stored_bytes(const PakTocEntry& entry) const noexcept
+    {
+        return m_file.bytes().subspan(static_cast<std::size_t>(entry.offset),
+                                      static_cast<std::size_t>(entry.stored_size));
+    }
+
+    std::span<const std::uint8_t> PakArchive::view(const PakTocEntry& entry) const noexcept
+    {
+        if (entry.compression != static_cast<std::uint8_t>(PakCompression::None))
+            return {};
+
+        return stored_bytes(entry);
+    }
+
+    bool PakArchive::read(const PakTocEntry& entry, std::vector<std::uint8_t>& out) const
+    {
+        out.resize(static_cast<std::size_t>(entry.size));
+
+        if (!pak_decompress(static_cast<PakCompression>(entry.compression), stored_bytes(entry), out))
+        {
+            out.clear();
+            return false;
+        }
+
+        return true;
+    }
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/core/filesystem/mapped_file.hpp"
+#include "engine/core/filesystem/pak_format.hpp"
+
+namespace wave::engine::core::filesystem
+{
+    // Read-only view of a .wpak archive (see pak_format.hpp).
+    //
+    // open() maps the file and validates the header and every TOC entry, so
+    // later lookups and reads never bounds-check against the file again.
+    // Lookups do not allocate. Thread safe once opened; all members are const.
+    class PakArchive
+    {
+    public:
+        PakArchive() = default;
+
+        PakArchive(const PakArchive&)            = delete;
+        PakArchive& operator=(const PakArchive&) = delete;
+
+        PakArchive(PakArchive&&) noexcept            = default;
+        PakArchive& operator=(PakArchive&&) noexcept = default;
+
+        bool open(const fs::path& path);
+        void close();
+
+        [[nodiscard]] bool               is_open() const noexcept { return m_file.is_open(); }
+        [[nodiscard]] const fs::path&    path() const noexcept { return m_path; }
+        [[nodiscard]] const std::string& error() const noexcept { return m_error; }
+
+        [[nodiscard]] std::span<const PakTocEntry> entries() const noexcept { return m_toc; }
+
+        // Entry for a path relative to the resource root, or nullptr.
+        // 'path' is normalized first; pass normalized paths to skip that.
+        [[nodiscard]] const PakTocEntry* find(std::string_view path) const;
+        [[nodiscard]] const PakTocEntry* find_normalized(std::string_view path) const;
+
+        [[nodiscard]] std::string_view name(const PakTocEntry& entry) const noexcept;
+
+        // Bytes as stored in the archive (compressed or not).
+        [[nodiscard]] std::span<const std::uint8_t> stored_bytes(const PakTocEntry& entry) const noexcept;
+
+        // Zero-copy view for uncompressed entries; empty span otherwise.
+        [[nodiscard]] std::span<const std::uint8_t> view(const PakTocEntry& entry) const noexcept;
+
+        // Decompress / copy the entry into 'out'.
+        bool read(const PakTocEntry& entry, std::vector<std::uint8_t>& out) const;
+
+    private:
+        bool fail(std::string message);
+
+    private:
+        fs::path                     m_path;
+        MappedFile                   m_file;
+        std::span<const PakTocEntry> m_toc;
+        std::string_view             m_names;
+        std::string                  m_error;
+    };
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,213 @@
+#include "engine/core/filesystem/pak_format.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+
+#if defined(WAVE_HAS_LZ4) && WAVE_HAS_LZ4
+    #include <lz4.h>
+    #include <lz4hc.h>
+#endif
+
+#if defined(WAVE_HAS_ZSTD) && WAVE_HAS_ZSTD
+    #include <zstd.h>
+#endif
+
+namespace wave::engine::core::filesystem
+{
+    std::string normalize_pak_path(std::string_view path)
+    {
+        std::string out;
+        out.reserve(path.size());
+
+        std::size_t i = 0;
+        while (i < path.size())
+        {
+            // Next segment.
+            std::size_t end = i;
+            while (end < path.size() && path[end] != '/' && path[end] != '\\')
+                ++end;
+
+            const std::string_view segment = path.substr(i, end - i);
+            if (!segment.empty() && segment != ".")
+            {
+                if (!out.empty())
+                    out += '/';
+                out.append(segment);
+            }
+
+            i = end + 1;
+        }
+
+        return out;
+    }
+
+    const char* pak_compression_to_string(PakCompression compression) noexcept
+    {
+        switch (compression)
+        {
+            case PakCompression::None: return "none";
+            case PakCompression::LZ4:  return "lz4";
+            case PakCompression::Zstd: return "zstd";
+        }
+        return "unknown";
+    }
+
+    bool parse_pak_compression(std::string_view text, PakCompression& out) noexcept
+    {
+        auto equals = [text](std::string_view name)
+        {
+            return text.size() == name.size() &&
+                   std::equal(text.begin(), text.end(), name.begin(), [](char a, char b)
+                   {
+                       return std::tolower(static_cast<unsigned char>(a)) == b;
+                   });
+        };
+
+        if (equals("none") || equals("store"))
+            out = PakCompression::None;
+        else if (equals("lz4"))
+            out = PakCompression::LZ4;
+        else if (equals("zstd"))
+            out = PakCompression::Zstd;
+        else
+            return false;
+
+        return true;
+    }
+
+    bool pak_compression_available(PakCompression compression) noexcept
+    {
+        switch (compression)
+        {
+            case PakCompression::None:
+                return true;
+            case PakCompression::LZ4:
+#if defined(WAVE_HAS_LZ4) && WAVE_HAS_LZ4
+                return true;
+#else
+                return false;
+#endif
+            case PakCompression::Zstd:
+#if defined(WAVE_HAS_ZSTD) && WAVE_HAS_ZSTD
+                return true;
+#else
+                return false;
+#endif
+        }
+        return false;
+    }
+
+    bool pak_compress(PakCompression compression,
+                      std::span<const std::uint8_t> input,
+                      std::vector<std::uint8_t>& out,
+                      int level)
+    {
+        (void)level; // unused when no codec is compiled in
+        out.clear();
+
+        switch (compression)
+        {
+            case PakCompression::None:
+                out.assign(input.begin(), input.end());
+                return true;
+
+            case PakCompression::LZ4:
+            {
+#if defined(WAVE_HAS_LZ4) && WAVE_HAS_LZ4
+                if (input.size() > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE))
+                    return false;
+
+                const int src_size = static_cast<int>(input.size());
+                out.resize(static_cast<std::size_t>(LZ4_compressBound(src_size)));
+
+                const auto* src = reinterpret_cast<const char*>(input.data());
+                auto*       dst = reinterpret_cast<char*>(out.data());
+
+                // Packing is offline, so level > 0 buys a better ratio with
+                // LZ4HC at the same decode speed.
+                const int written = level > 0
+                    ? LZ4_compress_HC(src, dst, src_size, static_cast<int>(out.size()), level)
+                    : LZ4_compress_default(src, dst, src_size, static_cast<int>(out.size()));
+
+                if (written <= 0)
+                {
+                    out.clear();
+                    return false;
+                }
+
+                out.resize(static_cast<std::size_t>(written));
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            case PakCompression::Zstd:
+            {
+#if defined(WAVE_HAS_ZSTD) && WAVE_HAS_ZSTD
+                out.resize(ZSTD_compressBound(input.size()));
+
+                const std::size_t written = ZSTD_compress(out.data(), out.size(),
+                                                          input.data(), input.size(),
+                                                          level > 0 ? level : 19);
+                if (ZSTD_isError(written))
+                {
+                    out.clear();
+                    return false;
+                }
+
+                out.resize(written);
+                return true;
+#else
+                return false;
+#endif
+            }
+        }
+
+        return false;
+    }
+
+    bool pak_decompress(PakCompression compression,
+                        std::span<const std::uint8_t> input,
+                        std::span<std::uint8_t> out)
+    {
+        switch (compression)
+        {
+            case PakCompression::None:
+                if (input.size() != out.size())
+                    return false;
+                std::copy(input.begin(), input.end(), out.begin());
+                return true;
+
+            case PakCompression::LZ4:
+            {
+#if defined(WAVE_HAS_LZ4) && WAVE_HAS_LZ4
+                if (input.size() > INT_MAX || out.size() > INT_MAX)
+                    return false;
+
+                const int read = LZ4_decompress_safe(reinterpret_cast<const char*>(input.data()),
+                                                     reinterpret_cast<char*>(out.data()),
+                                                     static_cast<int>(input.size()),
+                                                     static_cast<int>(out.size()));
+                return read >= 0 && static_cast<std::size_t>(read) == out.size();
+#else
+                return false;
+#endif
+            }
+
+            case PakCompression::Zstd:
+            {
+#if defined(WAVE_HAS_ZSTD) && WAVE_HAS_ZSTD
+                const std::size_t read = ZSTD_decompress(out.data(), out.size(), input.data(), input.size());
+                return !ZSTD_isError(read) && read == out.size();
+#else
+                return false;
+#endif
+            }
+        }
+
+        return false;
+    }
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wave::engine::core::filesystem
+{
+    // .wpak on-disk layout (little endian, version 1)
+    //
+    //   PakHeader                      64 bytes
+    //   PakTocEntry[entry_count]       sorted by (path_hash, name)
+    //   names                          entry paths, not NUL terminated
+    //   <pad to alignment>
+    //   entry data                     stored entries start on an 'alignment' (4K)
+    //                                  boundary, compressed ones on 16 bytes
+    //
+    // The whole archive is meant to be mapped once (MappedFile, MapAccess::Random).
+    // The header and TOC are then read in place, uncompressed entries are
+    // handed out as views into the mapping, and a lookup is a binary search
+    // over the hashed TOC. No per-file open() or stat() is needed.
+    //
+    // Entry paths are relative to the resource root, use '/' separators and
+    // are case sensitive (see normalize_pak_path).
+
+    static_assert(std::endian::native == std::endian::little, ".wpak is read in place; little endian only");
+
+    inline constexpr char          kPakMagic[4]        = { 'W', 'P', 'A', 'K' };
+    inline constexpr std::uint32_t kPakVersion         = 1;
+    inline constexpr std::uint32_t kPakDataAlignment   = 4096;
+    inline constexpr std::uint32_t kPakPackedAlignment = 16;
+
+    enum class PakCompression : std::uint8_t
+    {
+        None = 0,
+        LZ4  = 1,   // fast decode; needs WAVE_HAS_LZ4
+        Zstd = 2    // better ratio; needs WAVE_HAS_ZSTD
+    };
+
+    struct PakHeader
+    {
+        char          magic[4];
+        std::uint32_t version;
+        std::uint32_t entry_count;
+        std::uint32_t alignment;
+        std::uint64_t toc_offset;
+        std::uint64_t names_offset;
+        std::uint64_t names_size;
+        std::uint64_t data_offset;
+        std::uint64_t file_size;     // catches truncated archives
+        std::uint64_t reserved;
+    };
+
+    struct PakTocEntry
+    {
+        std::uint64_t path_hash;     // utils::fnv1a_64 of the normalized path
+        std::uint64_t offset;        // absolute file offset of the stored bytes
+        std::uint64_t stored_size;   // bytes on disk
+        std::uint64_t size;          // bytes after decompression
+        std::uint32_t name_offset;   // into the names block
+        std::uint16_t name_size;
+        std::uint8_t  compression;   // PakCompression
+        std::uint8_t  flags;
+        std::uint32_t reserved[2];
+    };
+
+    static_assert(sizeof(PakHeader) == 64);
+    static_assert(sizeof(PakTocEntry) == 48);
+
+    // "./shaders\\editor//basic.vert" -> "shaders/editor/basic.vert"
+    [[nodiscard]] std::string normalize_pak_path(std::string_view path);
+
+    [[nodiscard]] const char* pak_compression_to_string(PakCompression compression) noexcept;
+    [[nodiscard]] bool        parse_pak_compression(std::string_view text, PakCompression& out) noexcept;
+
+    // Whether this build can encode / decode 'compression'.
+    [[nodiscard]] bool pak_compression_available(PakCompression compression) noexcept;
+
+    // Compress 'input' into 'out'. level <= 0 picks the codec default.
+    // Returns false if the codec is unavailable or fails.
+    bool pak_compress(PakCompression compression,
+                      std::span<const std::uint8_t> input,
+                      std::vector<std::uint8_t>& out,
+                      int level = 0);
+
+    // Decompress exactly out.size() bytes from 'input'.
+    bool pak_decompress(PakCompression compression,
+                        std::span<const std::uint8_t> input,
+                        std::span<std::uint8_t> out);
+
+} // namespace wave::engine::core::filesystem
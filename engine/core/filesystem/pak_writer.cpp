@@ -0,0 +1,290 @@
+#include "engine/core/filesystem/pak_writer.hpp"
+
+#include "engine/core/filesystem/mapped_file.hpp"
+#include "engine/core/utils/hash.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+namespace wave::engine::core::filesystem
+{
+    namespace
+    {
+        std::uint64_t align_up(std::uint64_t value, std::uint64_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        struct FileCloser
+        {
+            void operator()(std::FILE* f) const noexcept { std::fclose(f); }
+        };
+
+        class Output
+        {
+        public:
+            explicit Output(std::FILE* file) : m_file(file) {}
+
+            bool write(const void* data, std::size_t size)
+            {
+                if (size == 0)
+                    return true;
+
+                const bool ok = std::fwrite(data, 1, size, m_file.get()) == size;
+                m_position += size;
+                return ok;
+            }
+
+            bool pad_to(std::uint64_t position)
+            {
+                static constexpr std::uint8_t kZeros[4096] = {};
+
+                while (m_position < position)
+                {
+                    const auto n = static_cast<std::size_t>(std::min<std::uint64_t>(position - m_position, sizeof(kZeros)));
+                    if (!write(kZeros, n))
+                        return false;
+                }
+                return true;
+            }
+
+            bool rewind()
+            {
+                m_position = 0;
+                return std::fseek(m_file.get(), 0, SEEK_SET) == 0;
+            }
+
+            bool close()
+            {
+                const bool ok = std::fflush(m_file.get()) == 0 && std::ferror(m_file.get()) == 0;
+                return (std::fclose(m_file.release()) == 0) && ok;
+            }
+
+            std::uint64_t position() const { return m_position; }
+
+        private:
+            std::unique_ptr<std::FILE, FileCloser> m_file;
+            std::uint64_t                          m_position = 0;
+        };
+    } // namespace
+
+    PakWriter::PakWriter(PakWriteOptions options)
+        : m_options(options)
+    {
+        if (m_options.alignment == 0)
+            m_options.alignment = 1;
+    }
+
+    void PakWriter::add_file(std::string_view archive_path, fs::path source)
+    {
+        add_file(archive_path, std::move(source), m_options.compression);
+    }
+
+    void PakWriter::add_file(std::string_view archive_path, fs::path source, PakCompression compression)
+    {
+        std::string key = normalize_pak_path(archive_path);
+        if (key.empty())
+            return;
+
+        m_entries[std::move(key)] = Source{ std::move(source), compression };
+    }
+
+    std::size_t PakWriter::add_directory(const fs::path& root,
+                                         const std::function<PakCompression(const fs::path&)>& compression_for)
+    {
+        std::size_t added = 0;
+        std::error_code ec;
+
+        for (fs::recursive_directory_iterator it(root, ec), end; it != end && !ec; it.increment(ec))
+        {
+            if (!it->is_regular_file(ec))
+                continue;
+
+            const fs::path relative = it->path().lexically_relative(root);
+            const PakCompression compression = compression_for ? compression_for(it->path()) : m_options.compression;
+
+            add_file(relative.generic_string(), it->path(), compression);
+            ++added;
+        }
+
+        return added;
+    }
+
+    bool PakWriter::write(const fs::path& output, std::string& error, Stats* stats) const
+    {
+        if (m_entries.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            error = "too many entries";
+            return false;
+        }
+
+        // Names block and TOC skeleton, in path order. Data is written in the
+        // same order so files from one directory end up next to each other.
+        std::string              names;
+        std::vector<PakTocEntry> toc;
+        std::vector<const Source*> sources;
+
+        toc.reserve(m_entries.size());
+        sources.reserve(m_entries.size());
+
+        for (const auto& [path, source] : m_entries)
+        {
+            if (path.size() > std::numeric_limits<std::uint16_t>::max())
+            {
+                error = "path too long: " + path;
+                return false;
+            }
+
+            if (!pak_compression_available(source.compression))
+            {
+                error = std::string("this build has no ") + pak_compression_to_string(source.compression) +
+                        " support (needed for " + path + ")";
+                return false;
+            }
+
+            PakTocEntry entry{};
+            entry.path_hash   = utils::fnv1a_64(path);
+            entry.name_offset = static_cast<std::uint32_t>(names.size());
+            entry.name_size   = static_cast<std::uint16_t>(path.size());
+
+            names += path;
+            if (names.size() > std::numeric_limits<std::uint32_t>::max())
+            {
+                error = "names block too large";
+                return false;
+            }
+
+            toc.push_back(entry);
+            sources.push_back(&source);
+        }
+
+        PakHeader header{};
+        std::memcpy(header.magic, kPakMagic, sizeof(kPakMagic));
+        header.version      = kPakVersion;
+        header.entry_count  = static_cast<std::uint32_t>(toc.size());
+        header.alignment    = m_options.alignment;
+        header.toc_offset   = sizeof(PakHeader);
+        header.names_offset = header.toc_offset + toc.size() * sizeof(PakTocEntry);
+        header.names_size   = names.size();
+        header.data_offset  = align_up(header.names_offset + header.names_size, m_options.alignment);
+
+        fs::path temp_path = output;
+        temp_path += ".tmp";
+
+        std::FILE* file = std::fopen(temp_path.string().c_str(), "wb");
+        if (!file)
+        {
+            error = "cannot create " + temp_path.string();
+            return false;
+        }
+
+        Output out(file);
+        Stats  local;
+
+        auto abort = [&](std::string message)
+        {
+            out.close();
+            std::error_code ec;
+            fs::remove(temp_path, ec);
+            error = std::move(message);
+            return false;
+        };
+
+        if (!out.pad_to(header.data_offset))
+            return abort("write failed");
+
+        std::vector<std::uint8_t> packed;
+
+        for (std::size_t i = 0; i < toc.size(); ++i)
+        {
+            PakTocEntry&  entry  = toc[i];
+            const Source& source = *sources[i];
+
+            MappedFile input;
+            if (!input.open(source.path, MapAccess::Sequential))
+                return abort("cannot read " + source.path.string());
+
+            const auto bytes = input.bytes();
+            std::span<const std::uint8_t> stored = bytes;
+
+            entry.compression = static_cast<std::uint8_t>(PakCompression::None);
+            entry.size        = bytes.size();
+
+            if (source.compression != PakCompression::None && bytes.size() >= m_options.min_compress_size &&
+                pak_compress(source.compression, bytes, packed, m_options.level) &&
+                static_cast<double>(packed.size()) <= static_cast<double>(bytes.size()) * m_options.max_ratio)
+            {
+                stored            = packed;
+                entry.compression = static_cast<std::uint8_t>(source.compression);
+                ++local.compressed;
+            }
+
+            // Stored entries are handed out as views and get the full (page)
+            // alignment; compressed ones are always decoded into a buffer, so
+            // packing them tightly keeps small files from wasting a page each.
+            const std::uint64_t alignment = entry.compression == static_cast<std::uint8_t>(PakCompression::None)
+                ? m_options.alignment
+                : std::min<std::uint64_t>(m_options.alignment, kPakPackedAlignment);
+
+            if (!out.pad_to(align_up(out.position(), alignment)))
+                return abort("write failed");
+
+            entry.offset      = out.position();
+            entry.stored_size = stored.size();
+
+            if (!out.write(stored.data(), stored.size()))
+                return abort("write failed");
+
+            ++local.files;
+            local.input_bytes  += entry.size;
+            local.stored_bytes += entry.stored_size;
+        }
+
+        header.file_size   = out.position();
+        local.archive_size = header.file_size;
+
+        // Lookup order: by hash, ties broken by name.
+        std::sort(toc.begin(), toc.end(), [&names](const PakTocEntry& a, const PakTocEntry& b)
+        {
+            if (a.path_hash != b.path_hash)
+                return a.path_hash < b.path_hash;
+
+            return std::string_view(names).substr(a.name_offset, a.name_size) <
+                   std::string_view(names).substr(b.name_offset, b.name_size);
+        });
+
+        if (!out.rewind() ||
+            !out.write(&header, sizeof(header)) ||
+            !out.write(toc.data(), toc.size() * sizeof(PakTocEntry)) ||
+            !out.write(names.data(), names.size()))
+        {
+            return abort("write failed");
+        }
+
+        if (!out.close())
+        {
+            std::error_code ec;
+            fs::remove(temp_path, ec);
+            error = "write failed";
+            return false;
+        }
+
+        std::error_code ec;
+        fs::rename(temp_path, output, ec);
+        if (ec)
+        {
+            fs::remove(temp_path, ec);
+            error = "cannot replace " + output.string() + ": " + ec.message();
+            return false;
+        }
+
+        if (stats)
+            *stats = local;
+
+        return true;
+    }
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/core/filesystem/pak_format.hpp"
+
+namespace wave::engine::core::filesystem
+{
+    namespace fs = std::filesystem;
+
+    struct PakWriteOptions
+    {
+        // Default codec for entries added without an explicit one.
+        PakCompression compression = PakCompression::None;
+
+        // Codec level (0 = codec default).
+        int            level = 0;
+
+        // Keep an entry compressed only if it shrinks to at most this
+        // fraction of its size; otherwise it is stored and stays zero-copy.
+        double         max_ratio = 0.9;
+
+        // Entries smaller than this are always stored.
+        std::uint64_t  min_compress_size = 512;
+
+        std::uint32_t  alignment = kPakDataAlignment;
+    };
+
+    // Builds a .wpak archive (see pak_format.hpp). Used by wave_pak.
+    class PakWriter
+    {
+    public:
+        explicit PakWriter(PakWriteOptions options = {});
+
+        // Add a file on disk under 'archive_path' (relative to the resource
+        // root). Adding the same path twice keeps the last one.
+        void add_file(std::string_view archive_path, fs::path source);
+        void add_file(std::string_view archive_path, fs::path source, PakCompression compression);
+
+        // Add every regular file below 'root', keyed by its path relative to
+        // 'root'. 'compression_for' may pick a codec per file (e.g. store
+        // already-compressed textures and audio).
+        std::size_t add_directory(const fs::path& root,
+                                  const std::function<PakCompression(const fs::path&)>& compression_for = {});
+
+        [[nodiscard]] std::size_t entry_count() const noexcept { return m_entries.size(); }
+
+        struct Stats
+        {
+            std::uint64_t files        = 0;
+            std::uint64_t compressed   = 0;
+            std::uint64_t input_bytes  = 0;
+            std::uint64_t stored_bytes = 0;
+            std::uint64_t archive_size = 0;
+        };
+
+        // Write the archive (via a temp file + rename). On failure 'error'
+        // describes what went wrong and 'output' is left untouched.
+        bool write(const fs::path& output, std::string& error, Stats* stats = nullptr) const;
+
+    private:
+        struct Source
+        {
+            fs::path       path;
+            PakCompression compression;
+        };
+
+        PakWriteOptions                 m_options;
+        std::map<std::string, Source>   m_entries; // normalized path -> source
+    };
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,338 @@
+#include "engine/core/filesystem/snapshot_tree.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace wave::engine::core::filesystem {
+
+namespace {
+
+// Dead name bytes tolerated before the arena is rewritten.
+constexpr std::size_t kCompactThreshold = 64 * 1024;
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Setup
+// -----------------------------------------------------------------------------
+
+void SnapshotTree::reset(std::string rootKey, const FileEntryInfo& rootInfo) {
+    m_rootKey = std::move(rootKey);
+
+    m_nodes.clear();
+    m_childLists.clear();
+    m_names.clear();
+    m_freeNodes.clear();
+    m_freeChildLists.clear();
+    m_deadNameBytes = 0;
+
+    Node root;
+    root.parent    = kNone;
+    root.childList = 0;
+    root.info      = rootInfo;
+    root.info.isDirectory = true;
+
+    m_nodes.push_back(root);
+    m_childLists.emplace_back();
+    m_live = 1;
+}
+
+// -----------------------------------------------------------------------------
+// Node access / lookup
+// -----------------------------------------------------------------------------
+
+std::string_view SnapshotTree::name(NodeId node) const {
+    const Node& n = m_nodes[node];
+    return std::string_view(m_names).substr(n.nameOffset, n.nameLength);
+}
+
+std::span<const SnapshotTree::NodeId> SnapshotTree::children(NodeId dir) const {
+    const std::uint32_t list = m_nodes[dir].childList;
+    if (list == kNone) {
+        return {};
+    }
+    return m_childLists[list];
+}
+
+SnapshotTree::NodeId SnapshotTree::child(NodeId dir, std::string_view childName) const {
+    const auto list = children(dir);
+    auto it = std::lower_bound(list.begin(), list.end(), childName,
+                               [this](NodeId node, std::string_view n) { return name(node) < n; });
+    return it != list.end() && name(*it) == childName ? *it : kNone;
+}
+
+SnapshotTree::NodeId SnapshotTree::find(std::string_view key) const {
+    if (m_nodes.empty() || !key.starts_with(m_rootKey)) {
+        return kNone;
+    }
+
+    std::string_view rest = key.substr(m_rootKey.size());
+    if (rest.empty()) {
+        return kRoot;
+    }
+    if (m_rootKey.back() != '/') {
+        if (rest.front() != '/') {
+            return kNone; // "/a/bc" is not under "/a/b"
+        }
+        rest.remove_prefix(1);
+    }
+
+    NodeId node = kRoot;
+    while (!rest.empty() && node != kNone) {
+        const auto slash = rest.find('/');
+        node = child(node, rest.substr(0, slash));
+        rest = slash == std::string_view::npos ? std::string_view() : rest.substr(slash + 1);
+    }
+    return node;
+}
+
+std::string SnapshotTree::path(NodeId node) const {
+    std::string out;
+    append_path(node, out);
+    return out;
+}
+
+void SnapshotTree::append_path(NodeId node, std::string& out) const {
+    NodeId chain[64];
+    std::vector<NodeId> deep;
+
+    std::size_t depth = 0;
+    for (NodeId n = node; n != kRoot; n = m_nodes[n].parent) {
+        if (depth < std::size(chain)) {
+            chain[depth] = n;
+        } else {
+            deep.push_back(n);
+        }
+        ++depth;
+    }
+
+    out.append(m_rootKey);
+    for (std::size_t i = depth; i-- > 0;) {
+        const NodeId n = i < std::size(chain) ? chain[i] : deep[i - std::size(chain)];
+        if (out.empty() || out.back() != '/') {
+            out += '/';
+        }
+        out.append(name(n));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Mutation
+// -----------------------------------------------------------------------------
+
+SnapshotTree::NodeId SnapshotTree::create(NodeId dir, std::string_view childName, const FileEntryInfo& info) {
+    const NodeId id = allocate_node();
+
+    Node& node      = m_nodes[id];
+    node.parent     = dir;
+    node.nameOffset = intern(childName);
+    node.nameLength = static_cast<std::uint32_t>(childName.size());
+    node.info       = info;
+    node.childList  = kNone;
+
+    if (info.isDirectory) {
+        if (!m_freeChildLists.empty()) {
+            node.childList = m_freeChildLists.back();
+            m_freeChildLists.pop_back();
+        } else {
+            node.childList = static_cast<std::uint32_t>(m_childLists.size());
+            m_childLists.emplace_back();
+        }
+    }
+
+    ++m_live;
+    return id;
+}
+
+void SnapshotTree::set_children(NodeId dir, std::vector<NodeId> sorted) {
+    assert(m_nodes[dir].childList != kNone);
+    m_childLists[m_nodes[dir].childList] = std::move(sorted);
+}
+
+SnapshotTree::NodeId SnapshotTree::insert(NodeId dir, std::string_view childName, const FileEntryInfo& info) {
+    if (const NodeId existing = child(dir, childName); existing != kNone) {
+        m_nodes[existing].info = info;
+        return existing;
+    }
+
+    const NodeId id = create(dir, childName, info);
+    link(id);
+    return id;
+}
+
+void SnapshotTree::erase(NodeId node, const EraseCallback& onErase) {
+    if (node == kRoot || !alive(node)) {
+        return;
+    }
+    unlink(node);
+    release(node, onErase);
+}
+
+void SnapshotTree::release(NodeId node, const EraseCallback& onErase) {
+    if (node == kRoot || !alive(node)) {
+        return;
+    }
+
+    std::string path;
+    if (onErase) {
+        append_path(node, path);
+    }
+    free_subtree(node, path, onErase);
+
+    if (m_deadNameBytes > kCompactThreshold && m_deadNameBytes > m_names.size() / 2) {
+        compact_names();
+    }
+}
+
+void SnapshotTree::move(NodeId node, NodeId newParent, std::string_view newName) {
+    if (node == kRoot) {
+        return;
+    }
+
+    unlink(node);
+
+    Node& n = m_nodes[node];
+    if (name(node) != newName) {
+        m_deadNameBytes += n.nameLength;
+        const std::uint32_t offset = intern(newName);
+        m_nodes[node].nameOffset = offset;
+        m_nodes[node].nameLength = static_cast<std::uint32_t>(newName.size());
+    }
+    m_nodes[node].parent = newParent;
+
+    link(node);
+}
+
+// -----------------------------------------------------------------------------
+// Traversal
+// -----------------------------------------------------------------------------
+
+void SnapshotTree::for_each_in(NodeId node, const std::function<void(NodeId node, std::string_view path)>& fn) const {
+    std::string path = this->path(node);
+    fn(node, path);
+    walk(node, path, fn);
+}
+
+void SnapshotTree::for_each(const std::function<void(std::string_view path, const FileEntryInfo& info)>& fn) const {
+    if (m_nodes.empty()) {
+        return;
+    }
+
+    std::string path = m_rootKey;
+    walk(kRoot, path, [this, &fn](NodeId node, std::string_view p) { fn(p, m_nodes[node].info); });
+}
+
+void SnapshotTree::walk(NodeId node, std::string& path,
+                        const std::function<void(NodeId, std::string_view)>& fn) const {
+    const std::size_t mark = path.size();
+    for (const NodeId c : children(node)) {
+        if (path.empty() || path.back() != '/') {
+            path += '/';
+        }
+        path.append(name(c));
+
+        fn(c, path);
+        if (m_nodes[c].childList != kNone) {
+            walk(c, path, fn);
+        }
+
+        path.resize(mark);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Internals
+// -----------------------------------------------------------------------------
+
+SnapshotTree::NodeId SnapshotTree::allocate_node() {
+    if (!m_freeNodes.empty()) {
+        const NodeId id = m_freeNodes.back();
+        m_freeNodes.pop_back();
+        return id;
+    }
+
+    m_nodes.emplace_back();
+    return static_cast<NodeId>(m_nodes.size() - 1);
+}
+
+std::uint32_t SnapshotTree::intern(std::string_view childName) {
+    const auto offset = static_cast<std::uint32_t>(m_names.size());
+    m_names.append(childName);
+    return offset;
+}
+
+void SnapshotTree::free_subtree(NodeId node, std::string& path, const EraseCallback& onErase) {
+    if (onErase) {
+        onErase(node, path);
+    }
+
+    Node& n = m_nodes[node];
+    if (n.childList != kNone) {
+        // Detach the list first; callbacks below must not see it change.
+        std::vector<NodeId> list = std::move(m_childLists[n.childList]);
+        m_childLists[n.childList] = {};
+        m_freeChildLists.push_back(n.childList);
+
+        const std::size_t mark = path.size();
+        for (const NodeId c : list) {
+            if (onErase) {
+                path += '/';
+                path.append(name(c));
+            }
+            free_subtree(c, path, onErase);
+            path.resize(mark);
+        }
+    }
+
+    Node& dead = m_nodes[node];
+    m_deadNameBytes += dead.nameLength;
+    dead.parent    = kDead;
+    dead.childList = kNone;
+    m_freeNodes.push_back(node);
+    --m_live;
+}
+
+void SnapshotTree::unlink(NodeId node) {
+    const std::uint32_t list = m_nodes[m_nodes[node].parent].childList;
+    if (list == kNone) {
+        return;
+    }
+
+    auto& siblings = m_childLists[list];
+    const std::string_view n = name(node);
+    auto it = std::lower_bound(siblings.begin(), siblings.end(), n,
+                               [this](NodeId id, std::string_view key) { return name(id) < key; });
+    if (it != siblings.end() && *it == node) {
+        siblings.erase(it);
+    }
+}
+
+void SnapshotTree::link(NodeId node) {
+    const std::uint32_t list = m_nodes[m_nodes[node].parent].childList;
+    assert(list != kNone);
+
+    auto& siblings = m_childLists[list];
+    const std::string_view n = name(node);
+    auto it = std::lower_bound(siblings.begin(), siblings.end(), n,
+                               [this](NodeId id, std::string_view key) { return name(id) < key; });
+    siblings.insert(it, node);
+}
+
+void SnapshotTree::compact_names() {
+    std::string names;
+    names.reserve(m_names.size() - m_deadNameBytes);
+
+    for (auto& node : m_nodes) {
+        if (node.parent == kDead) {
+            continue;
+        }
+        const auto offset = static_cast<std::uint32_t>(names.size());
+        names.append(m_names, node.nameOffset, node.nameLength);
+        node.nameOffset = offset;
+    }
+
+    m_names = std::move(names);
+    m_deadNameBytes = 0;
+}
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wave::engine::core::filesystem {
+
+// What a scan saw for one path.
+struct FileEntryInfo {
+    std::filesystem::file_time_type lastWrite{};
+    std::uintmax_t                  size{0};
+    bool                            isDirectory{false};
+
+    // File identity; 0 where the platform does not provide one.
+    std::uint64_t                   device{0};
+    std::uint64_t                   inode{0};
+};
+
+// Directory tree snapshot stored as an interned path tree.
+//
+// Every entry is one fixed-size node in a flat array: parent index, name
+// as offset + length into a shared string arena, and its FileEntryInfo.
+// Directories also own a child list sorted by name. Full paths are never
+// stored; they are rebuilt from the parent chain when needed, so a deep
+// tree costs one name per entry instead of one full path per entry.
+//
+// Node ids stay valid until the node is erased; erased ids are reused.
+// Node 0 is the root (the watched directory itself, keyed by root_key()).
+class SnapshotTree final {
+public:
+    using NodeId = std::uint32_t;
+
+    static constexpr NodeId kRoot = 0;
+    static constexpr NodeId kNone = ~NodeId{0};
+
+    SnapshotTree() = default;
+
+    // Drops everything; the tree then holds only the root.
+    void reset(std::string rootKey, const FileEntryInfo& rootInfo = {});
+
+    const std::string& root_key() const { return m_rootKey; }
+
+    // Entries below the root.
+    std::size_t size() const { return m_live > 0 ? m_live - 1 : 0; }
+    bool empty() const { return size() == 0; }
+
+    // Node access ----------------------------------------------------------------
+
+    bool alive(NodeId node) const { return node < m_nodes.size() && m_nodes[node].parent != kDead; }
+
+    NodeId           parent(NodeId node) const { return m_nodes[node].parent; }
+    std::string_view name(NodeId node) const;
+
+    const FileEntryInfo& info(NodeId node) const { return m_nodes[node].info; }
+          FileEntryInfo& info(NodeId node)       { return m_nodes[node].info; }
+
+    // Children of a directory, sorted by name (empty for files).
+    std::span<const NodeId> children(NodeId dir) const;
+
+    // Lookup -----------------------------------------------------------------------
+
+    NodeId child(NodeId dir, std::string_view name) const;
+
+    // Full key (as produced by path()) -> node, kNone if absent.
+    NodeId find(std::string_view key) const;
+
+    std::string path(NodeId node) const;
+    void        append_path(NodeId node, std::string& out) const;
+
+    // Mutation -----------------------------------------------------------------------
+
+    // New node under 'dir', not yet in its child list; see set_children().
+    NodeId create(NodeId dir, std::string_view name, const FileEntryInfo& info);
+
+    // Replaces a directory's child list; 'sorted' must be sorted by name.
+    void set_children(NodeId dir, std::vector<NodeId> sorted);
+
+    // create() + sorted insert into the child list. Returns the existing
+    // node (info updated) if the name is taken.
+    NodeId insert(NodeId dir, std::string_view name, const FileEntryInfo& info);
+
+    // Frees 'node' and everything below it; 'onErase' sees each node (with
+    // its path) before it goes, parents first. erase() also unlinks it from
+    // its parent, release() leaves that to the caller (set_children()).
+    using EraseCallback = std::function<void(NodeId node, std::string_view path)>;
+    void erase(NodeId node, const EraseCallback& onErase = {});
+    void release(NodeId node, const EraseCallback& onErase = {});
+
+    // Re-parents and/or renames a node; its subtree comes along unchanged.
+    void move(NodeId node, NodeId newParent, std::string_view newName);
+
+    // Traversal --------------------------------------------------------------------
+
+    // Pre-order over 'node' and its subtree with each full path.
+    void for_each_in(NodeId node, const std::function<void(NodeId node, std::string_view path)>& fn) const;
+
+    // Every entry below the root.
+    void for_each(const std::function<void(std::string_view path, const FileEntryInfo& info)>& fn) const;
+
+private:
+    static constexpr NodeId kDead = kNone - 1;
+
+    struct Node {
+        NodeId        parent{kNone};
+        std::uint32_t nameOffset{0};
+        std::uint32_t nameLength{0};
+        std::uint32_t childList{kNone};   // index into m_childLists, directories only
+        FileEntryInfo info;
+    };
+
+    NodeId        allocate_node();
+    std::uint32_t intern(std::string_view name);
+    void          free_subtree(NodeId node, std::string& path, const EraseCallback& onErase);
+    void          unlink(NodeId node);
+    void          link(NodeId node);
+    void          compact_names();
+
+    void walk(NodeId node, std::string& path, const std::function<void(NodeId, std::string_view)>& fn) const;
+
+private:
+    std::string m_rootKey;
+
+    std::vector<Node>                 m_nodes;
+    std::vector<std::vector<NodeId>>  m_childLists;
+    std::string                       m_names;
+
+    std::vector<NodeId>        m_freeNodes;
+    std::vector<std::uint32_t> m_freeChildLists;
+
+    std::size_t m_live{0};
+    std::size_t m_deadNameBytes{0};
+};
+
+} // namespace wave::engine::core::filesystem
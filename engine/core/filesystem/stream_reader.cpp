@@ -0,0 +1,272 @@
+#include "engine/core/filesystem/stream_reader.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace wave::engine::core::filesystem {
+
+// ChunkPool ------------------------------------------------------------------
+
+std::vector<std::uint8_t> ChunkPool::acquire(std::size_t capacity) {
+    {
+        std::scoped_lock lock(m_mutex);
+        auto it = std::find_if(m_free.begin(), m_free.end(), [capacity](const auto& buffer) {
+            return buffer.capacity() >= capacity;
+        });
+        if (it != m_free.end()) {
+            std::vector<std::uint8_t> buffer = std::move(*it);
+            *it = std::move(m_free.back());
+            m_free.pop_back();
+            return buffer;
+        }
+    }
+
+    std::vector<std::uint8_t> buffer;
+    buffer.reserve(capacity);
+    return buffer;
+}
+
+void ChunkPool::release(std::vector<std::uint8_t>&& buffer) {
+    if (buffer.capacity() == 0) {
+        return;
+    }
+
+    buffer.clear();
+
+    std::scoped_lock lock(m_mutex);
+    if (m_free.size() < m_maxPooled) {
+        m_free.push_back(std::move(buffer));
+    }
+}
+
+std::size_t ChunkPool::pooled() const {
+    std::scoped_lock lock(m_mutex);
+    return m_free.size();
+}
+
+ChunkPool& ChunkPool::shared() {
+    static ChunkPool pool;
+    return pool;
+}
+
+// StreamReader ---------------------------------------------------------------
+
+StreamReader::StreamReader(StreamReaderOptions options)
+    : m_options(options)
+    , m_pool(options.pool ? options.pool : &ChunkPool::shared()) {
+    m_options.chunkSize = std::max<std::size_t>(m_options.chunkSize, 4096);
+    m_options.readAhead = std::max<std::uint32_t>(m_options.readAhead, 1);
+}
+
+StreamReader::~StreamReader() {
+    close();
+}
+
+bool StreamReader::open(AsyncFileIO& io, const fs::path& path, std::uint64_t offset, std::uint64_t length) {
+    close();
+
+    m_path  = path;
+    m_error = {};
+
+    if (length == kToEnd) {
+        std::error_code ec;
+        const std::uint64_t fileSize = fs::file_size(path, ec);
+        if (ec) {
+            m_error = ec;
+            return false;
+        }
+        if (offset > fileSize) {
+            m_error = std::make_error_code(std::errc::invalid_argument);
+            return false;
+        }
+        length = fileSize - offset;
+    }
+
+    m_io         = &io;
+    m_offset     = offset;
+    m_size       = length;
+    m_position   = 0;
+    m_chunkCount = (length + m_options.chunkSize - 1) / m_options.chunkSize;
+    m_head       = 0;
+    m_next       = 0;
+    m_holding    = false;
+    m_cursor     = 0;
+    m_slots.resize(static_cast<std::size_t>(m_options.readAhead) + 1);
+
+    fill();
+    return true;
+}
+
+void StreamReader::close() {
+    if (!m_io) {
+        return;
+    }
+
+    {
+        std::unique_lock lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_inFlight == 0; });
+    }
+
+    for (Slot& s : m_slots) {
+        m_pool->release(std::move(s.data));
+    }
+    m_slots.clear();
+
+    m_io         = nullptr;
+    m_size       = 0;
+    m_position   = 0;
+    m_chunkCount = 0;
+    m_head       = 0;
+    m_next       = 0;
+    m_holding    = false;
+    m_cursor     = 0;
+}
+
+std::span<const std::uint8_t> StreamReader::next_chunk() {
+    if (!ensure_chunk()) {
+        return {};
+    }
+
+    std::span<const std::uint8_t> bytes(slot(m_head).data);
+    bytes = bytes.subspan(m_cursor);
+
+    m_cursor = slot(m_head).data.size();
+    m_position += bytes.size();
+    return bytes;
+}
+
+std::size_t StreamReader::read(std::span<std::uint8_t> out) {
+    std::size_t copied = 0;
+
+    while (copied < out.size() && ensure_chunk()) {
+        const auto& data = slot(m_head).data;
+        const std::size_t count = std::min(out.size() - copied, data.size() - m_cursor);
+
+        std::memcpy(out.data() + copied, data.data() + m_cursor, count);
+        copied += count;
+        m_cursor += count;
+        m_position += count;
+    }
+
+    return copied;
+}
+
+bool StreamReader::read_line(std::string& line) {
+    line.clear();
+
+    bool any = false;
+    while (ensure_chunk()) {
+        any = true;
+
+        const auto& data = slot(m_head).data;
+        const auto* begin = data.data() + m_cursor;
+        const auto* end = data.data() + data.size();
+        const auto* newline = std::find(begin, end, std::uint8_t{'\n'});
+
+        line.append(reinterpret_cast<const char*>(begin), static_cast<std::size_t>(newline - begin));
+
+        const std::size_t consumed = static_cast<std::size_t>(newline - begin) + (newline != end ? 1 : 0);
+        m_cursor += consumed;
+        m_position += consumed;
+
+        if (newline != end) {
+            break;
+        }
+    }
+
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+
+    return any;
+}
+
+bool StreamReader::ensure_chunk() {
+    if (!m_io) {
+        return false;
+    }
+
+    if (m_holding && m_cursor < slot(m_head).data.size()) {
+        return true;
+    }
+
+    if (m_holding) {
+        // Fully consumed: recycle the slot for the next read-ahead.
+        std::scoped_lock lock(m_mutex);
+        slot(m_head).state = SlotState::Idle;
+        ++m_head;
+        m_holding = false;
+        m_cursor = 0;
+    }
+
+    if (m_error || m_head >= m_chunkCount) {
+        return false;
+    }
+
+    fill();
+
+    std::unique_lock lock(m_mutex);
+    Slot& s = slot(m_head);
+    m_cv.wait(lock, [&s] { return s.state != SlotState::Pending; });
+
+    if (s.error) {
+        m_error = s.error;
+        return false;
+    }
+
+    m_holding = true;
+    m_cursor = 0;
+    return true;
+}
+
+void StreamReader::fill() {
+    const std::uint64_t window = m_slots.size();
+
+    while (m_next < m_chunkCount && m_next < m_head + window) {
+        const std::uint64_t chunk = m_next++;
+        const std::uint64_t begin = chunk * m_options.chunkSize;
+        const std::uint64_t count = std::min<std::uint64_t>(m_options.chunkSize, m_size - begin);
+
+        ReadRequest request;
+        request.path   = m_path;
+        request.offset = m_offset + begin;
+        request.size   = count;
+
+        {
+            std::scoped_lock lock(m_mutex);
+            Slot& s = slot(chunk);
+            s.state = SlotState::Pending;
+            s.error = {};
+            request.buffer = std::move(s.data);
+            ++m_inFlight;
+        }
+
+        if (request.buffer.capacity() < m_options.chunkSize) {
+            request.buffer = m_pool->acquire(m_options.chunkSize);
+        }
+
+        // Issued without m_mutex held: the Inline backend completes (and
+        // calls on_read) before read() returns.
+        m_io->read(std::move(request), [this, chunk, count](ReadResult&& result) {
+            on_read(chunk, count, std::move(result));
+        });
+    }
+}
+
+void StreamReader::on_read(std::uint64_t chunk, std::uint64_t expected, ReadResult&& result) {
+    std::scoped_lock lock(m_mutex);
+
+    Slot& s = slot(chunk);
+    s.data  = std::move(result.data);
+    s.error = result.error;
+    if (!s.error && s.data.size() != expected) {
+        // File shrank underneath us.
+        s.error = std::make_error_code(std::errc::io_error);
+    }
+    s.state = SlotState::Ready;
+
+    --m_inFlight;
+    m_cv.notify_all();
+}
+
+} // namespace wave::engine::core::filesystem
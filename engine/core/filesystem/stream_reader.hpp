@@ -0,0 +1,147 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "engine/core/filesystem/async_file_io.hpp"
+
+namespace wave::engine::core::filesystem {
+
+namespace fs = std::filesystem;
+
+// Free list of chunk buffers shared by stream readers, so streaming a file
+// does not allocate once the pool is warm.
+class ChunkPool final {
+public:
+    explicit ChunkPool(std::size_t maxPooled = 16)
+        : m_maxPooled(maxPooled) {}
+
+    ChunkPool(const ChunkPool&) = delete;
+    ChunkPool& operator=(const ChunkPool&) = delete;
+
+    // Empty buffer with at least 'capacity' bytes reserved.
+    std::vector<std::uint8_t> acquire(std::size_t capacity);
+
+    // Hand a buffer back; dropped if the pool is already full.
+    void release(std::vector<std::uint8_t>&& buffer);
+
+    std::size_t pooled() const;
+
+    // Process-wide pool used when StreamReaderOptions::pool is null.
+    static ChunkPool& shared();
+
+private:
+    mutable std::mutex                     m_mutex;
+    std::vector<std::vector<std::uint8_t>> m_free;
+    std::size_t                            m_maxPooled;
+};
+
+struct StreamReaderOptions {
+    std::size_t   chunkSize{1u << 20};
+    std::uint32_t readAhead{2};      // chunks requested beyond the one being consumed (min 1)
+    ChunkPool*    pool{nullptr};     // null = ChunkPool::shared()
+};
+
+// Sequential reader over a file (or a byte range of one) that never holds
+// more than (readAhead + 1) * chunkSize bytes.
+//
+// Chunks are read through AsyncFileIO, so they use the same io_uring /
+// thread pool backend as every other load. While the caller works on one
+// chunk, the next readAhead chunks are already in flight:
+//
+//   StreamReader reader;
+//   reader.open(io, "scene.gltf");
+//   while (auto chunk = reader.next_chunk(); !chunk.empty()) {
+//       parser.feed(chunk);
+//   }
+//   if (reader.error()) { ... }
+//
+// next_chunk(), read() and read_line() may be mixed. Not thread safe; use
+// one reader per consumer. The AsyncFileIO must outlive the reader.
+class StreamReader final {
+public:
+    explicit StreamReader(StreamReaderOptions options = {});
+    ~StreamReader();
+
+    StreamReader(const StreamReader&) = delete;
+    StreamReader& operator=(const StreamReader&) = delete;
+
+    static constexpr std::uint64_t kToEnd = ~std::uint64_t{0};
+
+    // Stream 'length' bytes starting at 'offset'.
+    bool open(AsyncFileIO& io, const fs::path& path, std::uint64_t offset = 0, std::uint64_t length = kToEnd);
+
+    // Waits for reads still in flight and returns the buffers to the pool.
+    void close();
+
+    bool is_open() const { return m_io != nullptr; }
+    const fs::path& path() const { return m_path; }
+
+    std::uint64_t size() const { return m_size; }
+    std::uint64_t position() const { return m_position; }
+    bool eof() const { return m_position >= m_size; }
+    std::error_code error() const { return m_error; }
+
+    // Next unread bytes, blocking until they arrive. The span stays valid
+    // until the next call on this reader. Empty at end of stream or on error.
+    std::span<const std::uint8_t> next_chunk();
+
+    // Copy up to out.size() bytes; returns how many were copied.
+    std::size_t read(std::span<std::uint8_t> out);
+
+    // Next line without the trailing "\n" / "\r\n". False at end of stream.
+    bool read_line(std::string& line);
+
+private:
+    enum class SlotState {
+        Idle,
+        Pending,
+        Ready
+    };
+
+    struct Slot {
+        SlotState                 state{SlotState::Idle};
+        std::vector<std::uint8_t> data;
+        std::error_code           error;
+    };
+
+    Slot& slot(std::uint64_t chunk) { return m_slots[chunk % m_slots.size()]; }
+
+    bool ensure_chunk();
+    void fill();
+    void on_read(std::uint64_t chunk, std::uint64_t expected, ReadResult&& result);
+
+private:
+    StreamReaderOptions m_options;
+    ChunkPool*          m_pool;
+
+    AsyncFileIO*  m_io{nullptr};
+    fs::path      m_path;
+    std::uint64_t m_offset{0};
+    std::uint64_t m_size{0};
+    std::uint64_t m_position{0};
+    std::error_code m_error;
+
+    // Chunk k covers [k * chunkSize, (k + 1) * chunkSize) and lives in
+    // slot k % slots. Chunks [m_head, m_next) are issued or ready.
+    std::vector<Slot> m_slots;
+    std::uint64_t     m_chunkCount{0};
+    std::uint64_t     m_head{0};
+    std::uint64_t     m_next{0};
+    bool              m_holding{false};   // m_head is the chunk being consumed
+    std::size_t       m_cursor{0};        // read offset within it
+
+    // Guards slot state and m_inFlight against the completion callbacks.
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+    std::uint32_t           m_inFlight{0};
+};
+
+} // namespace wave::engine::core::filesystem
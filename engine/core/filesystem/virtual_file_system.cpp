@@ -0,0 +1,435 @@
+#include "engine/core/filesystem/virtual_file_system.hpp"
+
+#include "engine/core/filesystem/file_system.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+namespace wave::engine::core::filesystem
+{
+    struct VirtualFileSystem::Mount
+    {
+        std::string   prefix;   // normalized, no trailing '/'
+        fs::path      source;
+        int           priority = 0;
+        std::uint64_t serial   = 0;
+
+        // Archive mounts. Shared with the views map() hands out, so an
+        // unmount never pulls the mapping from under them.
+        std::shared_ptr<PakArchive> archive;
+
+        // Directory mounts: normalized paths relative to 'source'.
+        std::vector<std::string>    files;
+
+        std::size_t file_count() const { return archive ? archive->entries().size() : files.size(); }
+    };
+
+    namespace
+    {
+        std::string join_virtual(std::string_view prefix, std::string_view relative)
+        {
+            if (prefix.empty())
+                return std::string(relative);
+
+            std::string path;
+            path.reserve(prefix.size() + 1 + relative.size());
+            path.append(prefix);
+            path += '/';
+            path.append(relative);
+            return path;
+        }
+
+        void scan_directory(const fs::path& root, std::vector<std::string>& files)
+        {
+            files.clear();
+
+            std::error_code ec;
+            for (fs::recursive_directory_iterator it(root, ec), end; it != end && !ec; it.increment(ec))
+            {
+                if (!it->is_regular_file(ec))
+                    continue;
+
+                files.push_back(normalize_pak_path(it->path().lexically_relative(root).generic_string()));
+            }
+        }
+    } // namespace
+
+    VirtualFileSystem::VirtualFileSystem()  = default;
+    VirtualFileSystem::~VirtualFileSystem() = default;
+
+    // ------------------------------------------------------------
+    // Mounts
+    // ------------------------------------------------------------
+
+    bool VirtualFileSystem::mount_directory(std::string_view prefix, const fs::path& directory, int priority)
+    {
+        std::error_code ec;
+        if (!fs::is_directory(directory, ec))
+            return false;
+
+        auto mount = std::make_unique<Mount>();
+        mount->prefix   = normalize_pak_path(prefix);
+        mount->source   = directory;
+        mount->priority = priority;
+
+        // Walk outside the lock; lookups keep running meanwhile.
+        scan_directory(directory, mount->files);
+
+        add_mount(std::move(mount));
+        return true;
+    }
+
+    bool VirtualFileSystem::mount_archive(std::string_view prefix, const fs::path& archive, int priority,
+                                          std::string* error)
+    {
+        auto mount = std::make_unique<Mount>();
+        mount->prefix   = normalize_pak_path(prefix);
+        mount->source   = archive;
+        mount->priority = priority;
+        mount->archive  = std::make_shared<PakArchive>();
+
+        if (!mount->archive->open(archive))
+        {
+            if (error)
+                *error = mount->archive->error();
+            return false;
+        }
+
+        add_mount(std::move(mount));
+        return true;
+    }
+
+    void VirtualFileSystem::add_mount(std::unique_ptr<Mount> mount)
+    {
+        std::unique_lock lock(m_mutex);
+
+        mount->serial = ++m_mountSerial;
+        m_mounts.push_back(std::move(mount));
+        rebuild_index();
+    }
+
+    bool VirtualFileSystem::unmount(const fs::path& source)
+    {
+        std::unique_lock lock(m_mutex);
+
+        const auto removed = std::erase_if(m_mounts, [&source](const std::unique_ptr<Mount>& mount)
+        {
+            return mount->source == source;
+        });
+
+        if (removed == 0)
+            return false;
+
+        rebuild_index();
+        return true;
+    }
+
+    void VirtualFileSystem::unmount_all()
+    {
+        std::unique_lock lock(m_mutex);
+
+        m_mounts.clear();
+        m_entries.clear();
+        m_index.clear();
+    }
+
+    void VirtualFileSystem::rescan()
+    {
+        // Snapshot the directory mounts, walk them unlocked, then swap the
+        // results in. A mount removed in between is simply skipped.
+        std::vector<std::pair<std::uint64_t, fs::path>> targets;
+        {
+            std::shared_lock lock(m_mutex);
+            for (const auto& mount : m_mounts)
+            {
+                if (!mount->archive)
+                    targets.emplace_back(mount->serial, mount->source);
+            }
+        }
+
+        std::vector<std::vector<std::string>> scanned(targets.size());
+        for (std::size_t i = 0; i < targets.size(); ++i)
+        {
+            scan_directory(targets[i].second, scanned[i]);
+        }
+
+        std::unique_lock lock(m_mutex);
+        for (std::size_t i = 0; i < targets.size(); ++i)
+        {
+            for (auto& mount : m_mounts)
+            {
+                if (mount->serial == targets[i].first)
+                    mount->files = std::move(scanned[i]);
+            }
+        }
+        rebuild_index();
+    }
+
+    std::vector<VirtualFileSystem::MountInfo> VirtualFileSystem::mounts() const
+    {
+        std::shared_lock lock(m_mutex);
+
+        std::vector<MountInfo> out;
+        out.reserve(m_mounts.size());
+
+        for (const auto& mount : m_mounts)
+        {
+            out.push_back({ mount->prefix, mount->source, mount->priority,
+                            mount->archive != nullptr, mount->file_count() });
+        }
+        return out;
+    }
+
+    std::size_t VirtualFileSystem::file_count() const
+    {
+        std::shared_lock lock(m_mutex);
+        return m_entries.size();
+    }
+
+    // ------------------------------------------------------------
+    // Index
+    // ------------------------------------------------------------
+
+    void VirtualFileSystem::rebuild_index()
+    {
+        // Caller holds the exclusive lock.
+        std::vector<const Mount*> order;
+        order.reserve(m_mounts.size());
+
+        std::size_t total = 0;
+        for (const auto& mount : m_mounts)
+        {
+            order.push_back(mount.get());
+            total += mount->file_count();
+        }
+
+        // Lowest priority first so later inserts override.
+        std::sort(order.begin(), order.end(), [](const Mount* a, const Mount* b)
+        {
+            return a->priority != b->priority ? a->priority < b->priority : a->serial < b->serial;
+        });
+
+        m_entries.clear();
+        m_index.clear();
+        m_entries.reserve(total);
+        m_index.reserve(total);
+
+        for (const Mount* mount : order)
+        {
+            if (mount->archive)
+            {
+                for (const auto& entry : mount->archive->entries())
+                {
+                    insert(join_virtual(mount->prefix, mount->archive->name(entry)), mount, &entry);
+                }
+            }
+            else
+            {
+                for (const auto& file : mount->files)
+                {
+                    insert(join_virtual(mount->prefix, file), mount, nullptr);
+                }
+            }
+        }
+    }
+
+    void VirtualFileSystem::insert(std::string path, const Mount* mount, const PakTocEntry* pakEntry)
+    {
+        const std::uint64_t hash = utils::fnv1a_64(path);
+        const auto [it, inserted] = m_index.try_emplace(hash, static_cast<std::uint32_t>(m_entries.size()));
+
+        if (!inserted)
+        {
+            for (std::uint32_t i = it->second; i != IndexEntry::kNone; i = m_entries[i].next)
+            {
+                if (m_entries[i].path == path)
+                {
+                    // Overlay: the later (higher priority) mount wins.
+                    m_entries[i].mount    = mount;
+                    m_entries[i].pakEntry = pakEntry;
+                    return;
+                }
+            }
+        }
+
+        IndexEntry entry;
+        entry.path     = std::move(path);
+        entry.mount    = mount;
+        entry.pakEntry = pakEntry;
+        entry.next     = inserted ? IndexEntry::kNone : it->second;
+
+        it->second = static_cast<std::uint32_t>(m_entries.size());
+        m_entries.push_back(std::move(entry));
+    }
+
+    const VirtualFileSystem::IndexEntry* VirtualFileSystem::find(std::uint64_t hash, std::string_view normalized) const
+    {
+        // Caller holds (at least) the shared lock.
+        const auto it = m_index.find(hash);
+        if (it == m_index.end())
+            return nullptr;
+
+        for (std::uint32_t i = it->second; i != IndexEntry::kNone; i = m_entries[i].next)
+        {
+            if (m_entries[i].path == normalized)
+                return &m_entries[i];
+        }
+
+        return nullptr;
+    }
+
+    fs::path VirtualFileSystem::native_path(const IndexEntry& entry)
+    {
+        if (entry.mount->archive)
+            return {};
+
+        const std::size_t skip = entry.mount->prefix.empty() ? 0 : entry.mount->prefix.size() + 1;
+        return entry.mount->source / fs::path(std::string_view(entry.path).substr(skip));
+    }
+
+    // ------------------------------------------------------------
+    // Lookups
+    // ------------------------------------------------------------
+
+    bool VirtualFileSystem::exists(std::string_view path) const
+    {
+        const std::string normalized = normalize_pak_path(path);
+        return exists(VfsPath(normalized));
+    }
+
+    bool VirtualFileSystem::exists(const VfsPath& path) const
+    {
+        std::shared_lock lock(m_mutex);
+        return find(path.hash, path.path) != nullptr;
+    }
+
+    fs::path VirtualFileSystem::native_path(std::string_view path) const
+    {
+        const std::string normalized = normalize_pak_path(path);
+
+        std::shared_lock lock(m_mutex);
+        const IndexEntry* entry = find(utils::fnv1a_64(normalized), normalized);
+        return entry ? native_path(*entry) : fs::path{};
+    }
+
+    bool VirtualFileSystem::locate(std::string_view path, Location& out) const
+    {
+        const std::string normalized = normalize_pak_path(path);
+
+        std::shared_lock lock(m_mutex);
+
+        const IndexEntry* entry = find(utils::fnv1a_64(normalized), normalized);
+        if (!entry)
+            return false;
+
+        if (!entry->pakEntry)
+        {
+            out = { native_path(*entry), 0, 0, false, false };
+            return true;
+        }
+
+        const PakTocEntry& toc = *entry->pakEntry;
+        out = { entry->mount->archive->path(), toc.offset, toc.stored_size, true,
+                toc.compression != static_cast<std::uint8_t>(PakCompression::None) };
+        return true;
+    }
+
+    bool VirtualFileSystem::read(std::string_view path, std::vector<std::uint8_t>& out) const
+    {
+        const std::string normalized = normalize_pak_path(path);
+        return read(VfsPath(normalized), out);
+    }
+
+    bool VirtualFileSystem::read(const VfsPath& path, std::vector<std::uint8_t>& out) const
+    {
+        std::shared_lock lock(m_mutex);
+
+        const IndexEntry* entry = find(path.hash, path.path);
+        return entry && read_entry(*entry, out);
+    }
+
+    bool VirtualFileSystem::read_text(std::string_view path, std::string& out) const
+    {
+        const std::string normalized = normalize_pak_path(path);
+
+        std::shared_lock lock(m_mutex);
+
+        const IndexEntry* entry = find(utils::fnv1a_64(normalized), normalized);
+        if (!entry)
+            return false;
+
+        if (!entry->pakEntry)
+            return read_text_file(native_path(*entry), out);
+
+        const auto bytes = entry->mount->archive->view(*entry->pakEntry);
+        if (bytes.size() == entry->pakEntry->size)
+        {
+            out.assign(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            return true;
+        }
+
+        std::vector<std::uint8_t> decoded;
+        if (!entry->mount->archive->read(*entry->pakEntry, decoded))
+            return false;
+
+        out.assign(decoded.begin(), decoded.end());
+        return true;
+    }
+
+    bool VirtualFileSystem::map(std::string_view path, MappedFile& out, MapAccess access) const
+    {
+        const std::string normalized = normalize_pak_path(path);
+        return map(VfsPath(normalized), out, access);
+    }
+
+    bool VirtualFileSystem::map(const VfsPath& path, MappedFile& out, MapAccess access) const
+    {
+        std::shared_lock lock(m_mutex);
+
+        const IndexEntry* entry = find(path.hash, path.path);
+        if (!entry)
+        {
+            out.close();
+            return false;
+        }
+
+        return map_entry(*entry, out, access);
+    }
+
+    bool VirtualFileSystem::read_entry(const IndexEntry& entry, std::vector<std::uint8_t>& out) const
+    {
+        if (!entry.pakEntry)
+            return read_binary_file(native_path(entry), out);
+
+        return entry.mount->archive->read(*entry.pakEntry, out);
+    }
+
+    bool VirtualFileSystem::map_entry(const IndexEntry& entry, MappedFile& out, MapAccess access) const
+    {
+        if (!entry.pakEntry)
+            return out.open(native_path(entry), access);
+
+        const PakArchive&  archive = *entry.mount->archive;
+        const PakTocEntry& toc     = *entry.pakEntry;
+
+        // Stored entries are views into the archive mapping, which they keep
+        // alive.
+        if (const auto bytes = archive.view(toc); bytes.size() == toc.size)
+        {
+            out.borrow(bytes, entry.mount->archive);
+            return true;
+        }
+
+        std::unique_ptr<std::uint8_t[]> buffer(new std::uint8_t[toc.size]);
+        if (!pak_decompress(static_cast<PakCompression>(toc.compression), archive.stored_bytes(toc),
+                            { buffer.get(), static_cast<std::size_t>(toc.size) }))
+        {
+            out.close();
+            return false;
+        }
+
+        out.adopt(std::move(buffer), static_cast<std::size_t>(toc.size));
+        return true;
+    }
+
+} // namespace wave::engine::core::filesystem
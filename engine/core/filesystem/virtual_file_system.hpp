@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/filesystem/mapped_file.hpp"
+#include "engine/core/filesystem/pak_archive.hpp"
+#include "engine/core/utils/hash.hpp"
+
+namespace wave::engine::core::filesystem
+{
+    namespace fs = std::filesystem;
+
+    // A virtual path with its hash computed up front, e.g.
+    //
+    //   static constexpr VfsPath kBasicVert{ "shaders/editor/basic.vert.spv" };
+    //
+    // The text must already be normalized (see normalize_pak_path).
+    struct VfsPath
+    {
+        std::string_view path;
+        std::uint64_t    hash;
+
+        constexpr explicit VfsPath(std::string_view normalized) noexcept
+            : path(normalized), hash(utils::fnv1a_64(normalized))
+        {
+        }
+    };
+
+    // Overlay of loose directories and .wpak archives under virtual prefixes.
+    //
+    // Every mount is indexed once when it is mounted (one directory walk or
+    // the archive TOC). Lookups after that are a single probe into an
+    // in-memory hash table, so exists() never touches the disk and reads only
+    // open the file that actually wins.
+    //
+    // When several mounts provide the same virtual path, the one with the
+    // highest priority wins; equal priorities go to the most recent mount.
+    // Typical setup:
+    //
+    //   vfs.mount_directory("", "<engine_root>/resources", 0);    // loose dev files
+    //   vfs.mount_archive("", "base.wpak", 100);
+    //   vfs.mount_archive("", "patch_001.wpak", 200);
+    //
+    // Loose files added on disk after mounting are not visible until
+    // rescan(). Thread safe; mounting takes an exclusive lock, lookups a
+    // shared one. Views returned by map() for archive entries keep their
+    // archive mapped, even after it is unmounted.
+    class VirtualFileSystem
+    {
+    public:
+        struct MountInfo
+        {
+            std::string   prefix;
+            fs::path      source;
+            int           priority   = 0;
+            bool          archive    = false;
+            std::size_t   file_count = 0;
+        };
+
+        // Where a virtual file's bytes live on disk.
+        struct Location
+        {
+            fs::path      file;
+            std::uint64_t offset     = 0;
+            std::uint64_t size       = 0;      // stored bytes; archive entries only
+            bool          archive    = false;
+            bool          compressed = false;  // archive entry that must be decoded first
+        };
+
+        VirtualFileSystem();
+        ~VirtualFileSystem();
+
+        VirtualFileSystem(const VirtualFileSystem&)            = delete;
+        VirtualFileSystem& operator=(const VirtualFileSystem&) = delete;
+
+        // Mounts ---------------------------------------------------------------
+
+        bool mount_directory(std::string_view prefix, const fs::path& directory, int priority = 0);
+
+        // 'error' (optional) receives PakArchive::error() on failure.
+        bool mount_archive(std::string_view prefix, const fs::path& archive, int priority = 0,
+                           std::string* error = nullptr);
+
+        // Remove every mount of 'source'. Returns false if none matched.
+        bool unmount(const fs::path& source);
+        void unmount_all();
+
+        // Re-walk all directory mounts (e.g. after files were added on disk).
+        void rescan();
+
+        [[nodiscard]] std::vector<MountInfo> mounts() const;
+
+        // Distinct virtual paths currently visible.
+        [[nodiscard]] std::size_t file_count() const;
+
+        // Lookups --------------------------------------------------------------
+        //
+        // String overloads normalize and hash on every call; hot paths should
+        // keep a VfsPath around instead.
+
+        [[nodiscard]] bool exists(std::string_view path) const;
+        [[nodiscard]] bool exists(const VfsPath& path) const;
+
+        // On-disk location of a file served by a directory mount; empty if
+        // the winning mount is an archive or the path is unknown.
+        [[nodiscard]] fs::path native_path(std::string_view path) const;
+
+        // Native file and byte range behind a virtual path, for readers that
+        // go to disk themselves (StreamReader, AsyncFileIO).
+        bool locate(std::string_view path, Location& out) const;
+
+        bool read(std::string_view path, std::vector<std::uint8_t>& out) const;
+        bool read(const VfsPath& path, std::vector<std::uint8_t>& out) const;
+
+        bool read_text(std::string_view path, std::string& out) const;
+
+        // Zero-copy where possible (mapped loose file or stored archive
+        // entry); compressed entries are decoded into a buffer owned by 'out'.
+        bool map(std::string_view path, MappedFile& out, MapAccess access = MapAccess::Sequential) const;
+        bool map(const VfsPath& path, MappedFile& out, MapAccess access = MapAccess::Sequential) const;
+
+    private:
+        struct Mount;
+
+        struct IndexEntry
+        {
+            std::string        path;       // normalized virtual path
+            const Mount*       mount     = nullptr;
+            const PakTocEntry* pakEntry  = nullptr;
+            std::uint32_t      next      = kNone;  // hash collision chain
+
+            static constexpr std::uint32_t kNone = ~0u;
+        };
+
+        [[nodiscard]] const IndexEntry* find(std::uint64_t hash, std::string_view normalized) const;
+        [[nodiscard]] static fs::path native_path(const IndexEntry& entry);
+
+        bool read_entry(const IndexEntry& entry, std::vector<std::uint8_t>& out) const;
+        bool map_entry(const IndexEntry& entry, MappedFile& out, MapAccess access) const;
+
+        void add_mount(std::unique_ptr<Mount> mount);
+        void rebuild_index();
+        void insert(std::string path, const Mount* mount, const PakTocEntry* pakEntry);
+
+    private:
+        mutable std::shared_mutex m_mutex;
+
+        std::vector<std::unique_ptr<Mount>> m_mounts;
+        std::uint64_t                       m_mountSerial = 0;
+
+        std::vector<IndexEntry>                          m_entries;
+        std::unordered_map<std::uint64_t, std::uint32_t> m_index;  // path hash -> first entry
+    };
+
+} // namespace wave::engine::core::filesystem
@@ -0,0 +1,329 @@
+#include "engine/core/logging/binary_log_reader.hpp"
+
+#include "engine/core/filesystem/file_system.hpp"
+
+#include <cstring>
+#include <sstream>
+
+namespace wave::engine::core::logging
+{
+    // -------------------------------------------------------------------------
+    // DecodedLogArg / DecodedLogEntry
+    // -------------------------------------------------------------------------
+
+    std::string DecodedLogArg::to_text() const
+    {
+        std::ostringstream oss;
+
+        switch (tag)
+        {
+            case binlog::ArgTag::Bool:    oss << (i != 0); break;
+            case binlog::ArgTag::Char:    oss << static_cast<char>(i); break;
+            case binlog::ArgTag::Int:     oss << i; break;
+            case binlog::ArgTag::UInt:    oss << u; break;
+            case binlog::ArgTag::Float:   oss << f; break;
+            case binlog::ArgTag::String:  return s;
+            case binlog::ArgTag::Pointer: oss << reinterpret_cast<const void*>(static_cast<std::uintptr_t>(u)); break;
+        }
+
+        return oss.str();
+    }
+
+    std::string DecodedLogEntry::message() const
+    {
+        if (site)
+            return render_log_format(site->format, args);
+
+        std::string text;
+        for (const auto& arg : args)
+        {
+            text += arg.to_text();
+        }
+        return text;
+    }
+
+    std::string render_log_format(std::string_view format, const std::vector<DecodedLogArg>& args)
+    {
+        std::string out;
+        out.reserve(format.size() + args.size() * 8);
+
+        std::size_t next_arg = 0;
+
+        for (std::size_t i = 0; i < format.size(); ++i)
+        {
+            const char c = format[i];
+
+            if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c)
+            {
+                out += c;
+                ++i;
+            }
+            else if (c == '{' && i + 1 < format.size() && format[i + 1] == '}')
+            {
+                if (next_arg < args.size())
+                {
+                    out += args[next_arg].to_text();
+                }
+                ++next_arg;
+                ++i;
+            }
+            else
+            {
+                out += c;
+            }
+        }
+
+        return out;
+    }
+
+    // -------------------------------------------------------------------------
+    // BinaryLogReader
+    // -------------------------------------------------------------------------
+
+    bool BinaryLogReader::open(const fs::path& path)
+    {
+        std::string data;
+        if (!filesystem::read_text_file(path, data))
+        {
+            m_error = "cannot read " + path.string();
+            return false;
+        }
+
+        return load(std::move(data));
+    }
+
+    bool BinaryLogReader::load(std::string data)
+    {
+        m_data = std::move(data);
+        m_pos  = 0;
+        m_sites.clear();
+        m_error.clear();
+
+        if (m_data.size() < sizeof(binlog::kMagic) ||
+            std::memcmp(m_data.data(), binlog::kMagic, sizeof(binlog::kMagic)) != 0)
+        {
+            return fail("not a .wlog stream (bad magic)");
+        }
+        m_pos = sizeof(binlog::kMagic);
+
+        std::uint8_t version = 0;
+        if (!read_u8(version))
+            return false;
+
+        if (version != binlog::kVersion)
+            return fail("unsupported .wlog version");
+
+        std::uint64_t base = 0;
+        if (!read_str(m_appName) || !read_varint(base))
+            return false;
+
+        m_baseTimeNs = static_cast<std::int64_t>(base);
+        m_lastTimeNs = m_baseTimeNs;
+        return true;
+    }
+
+    const DecodedLogSite* BinaryLogReader::find_site(std::uint32_t id) const
+    {
+        auto it = m_sites.find(id);
+        return it != m_sites.end() ? &it->second : nullptr;
+    }
+
+    bool BinaryLogReader::next(DecodedLogEntry& out)
+    {
+        while (m_pos < m_data.size())
+        {
+            std::uint8_t type = 0;
+            if (!read_u8(type))
+                return false;
+
+            if (type == static_cast<std::uint8_t>(binlog::RecordType::SiteDefinition))
+            {
+                if (!read_site())
+                    return false;
+                continue;
+            }
+
+            if (type != static_cast<std::uint8_t>(binlog::RecordType::Entry))
+                return fail("unknown record type");
+
+            std::uint64_t site_id = 0;
+            std::uint64_t delta   = 0;
+            std::uint64_t thread  = 0;
+            std::uint8_t  level   = 0;
+            std::string   packed;
+
+            if (!read_varint(site_id) || !read_varint(delta) || !read_varint(thread) ||
+                !read_u8(level) || !read_str(packed))
+            {
+                return false;
+            }
+
+            // Undo zigzag.
+            const std::int64_t signed_delta =
+                static_cast<std::int64_t>(delta >> 1) ^ -static_cast<std::int64_t>(delta & 1);
+
+            m_lastTimeNs += signed_delta;
+
+            out.site      = nullptr;
+            out.time_ns   = m_lastTimeNs;
+            out.thread_id = static_cast<std::uint32_t>(thread);
+            out.level     = static_cast<LogLevel>(level);
+            out.args.clear();
+
+            if (site_id != 0)
+            {
+                out.site = find_site(static_cast<std::uint32_t>(site_id));
+                if (!out.site)
+                    return fail("entry references an undefined call site");
+            }
+
+            return read_args(packed, out.args);
+        }
+
+        return false;
+    }
+
+    bool BinaryLogReader::read_site()
+    {
+        std::uint64_t id      = 0;
+        std::uint8_t  level   = 0;
+        std::uint8_t  channel = 0;
+        std::uint64_t line    = 0;
+
+        DecodedLogSite site{};
+        if (!read_varint(id) || !read_u8(level) || !read_u8(channel))
+            return false;
+
+        if (!read_varint(line) || !read_str(site.file) || !read_str(site.format))
+            return false;
+
+        site.id      = static_cast<std::uint32_t>(id);
+        site.level   = static_cast<LogLevel>(level);
+        site.channel = static_cast<LogChannel>(channel);
+        site.line    = static_cast<std::uint32_t>(line);
+
+        m_sites[site.id] = std::move(site);
+        return true;
+    }
+
+    bool BinaryLogReader::read_args(std::string_view packed, std::vector<DecodedLogArg>& out)
+    {
+        // Decode with a nested reader over the packed bytes.
+        BinaryLogReader args;
+        args.m_data.assign(packed.data(), packed.size());
+
+        while (args.m_pos < args.m_data.size())
+        {
+            std::uint8_t tag = 0;
+            if (!args.read_u8(tag))
+                return fail("truncated argument");
+
+            DecodedLogArg arg{};
+            arg.tag = static_cast<binlog::ArgTag>(tag);
+
+            bool ok = true;
+            switch (arg.tag)
+            {
+                case binlog::ArgTag::Bool:
+                case binlog::ArgTag::Char:
+                {
+                    std::uint8_t v = 0;
+                    ok = args.read_u8(v);
+                    arg.i = arg.tag == binlog::ArgTag::Char ? static_cast<char>(v) : v;
+                    break;
+                }
+                case binlog::ArgTag::Int:
+                {
+                    std::uint64_t v = 0;
+                    ok = args.read_varint(v);
+                    arg.i = static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+                    break;
+                }
+                case binlog::ArgTag::UInt:
+                case binlog::ArgTag::Pointer:
+                    ok = args.read_varint(arg.u);
+                    break;
+                case binlog::ArgTag::Float:
+                {
+                    if (args.m_pos + 8 > args.m_data.size())
+                    {
+                        ok = false;
+                        break;
+                    }
+
+                    std::uint64_t bits = 0;
+                    for (int b = 0; b < 8; ++b)
+                    {
+                        bits |= static_cast<std::uint64_t>(
+                                    static_cast<unsigned char>(args.m_data[args.m_pos + b])) << (b * 8);
+                    }
+                    args.m_pos += 8;
+                    std::memcpy(&arg.f, &bits, sizeof(bits));
+                    break;
+                }
+                case binlog::ArgTag::String:
+                    ok = args.read_str(arg.s);
+                    break;
+                default:
+                    return fail("unknown argument tag");
+            }
+
+            if (!ok)
+                return fail("truncated argument");
+
+            out.push_back(std::move(arg));
+        }
+
+        return true;
+    }
+
+    bool BinaryLogReader::read_u8(std::uint8_t& out)
+    {
+        if (m_pos >= m_data.size())
+            return fail("unexpected end of stream");
+
+        out = static_cast<std::uint8_t>(m_data[m_pos++]);
+        return true;
+    }
+
+    bool BinaryLogReader::read_varint(std::uint64_t& out)
+    {
+        out = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            std::uint8_t byte = 0;
+            if (!read_u8(byte))
+                return false;
+
+            out |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+
+        return fail("malformed varint");
+    }
+
+    bool BinaryLogReader::read_str(std::string& out)
+    {
+        std::uint64_t len = 0;
+        if (!read_varint(len))
+            return false;
+
+        if (len > m_data.size() - m_pos)
+            return fail("string runs past end of stream");
+
+        out.assign(m_data.data() + m_pos, static_cast<std::size_t>(len));
+        m_pos += static_cast<std::size_t>(len);
+        return true;
+    }
+
+    bool BinaryLogReader::fail(const char* what)
+    {
+        if (m_error.empty())
+        {
+            m_error = what;
+        }
+        return false;
+    }
+
+} // namespace wave::engine::core::logging
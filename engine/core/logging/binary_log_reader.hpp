@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/logging/log.hpp"
+
+namespace wave::engine::core::logging
+{
+    namespace fs = std::filesystem;
+
+    struct DecodedLogArg
+    {
+        binlog::ArgTag tag = binlog::ArgTag::String;
+        std::int64_t   i   = 0;    // Bool, Char, Int
+        std::uint64_t  u   = 0;    // UInt, Pointer
+        double         f   = 0.0;  // Float
+        std::string    s;          // String
+
+        // Same text the ostream based formatter would have produced.
+        [[nodiscard]] std::string to_text() const;
+    };
+
+    struct DecodedLogSite
+    {
+        std::uint32_t id      = 0;
+        LogLevel      level   = LogLevel::Info;
+        LogChannel    channel = LogChannel::General;
+        std::uint32_t line    = 0;
+        std::string   file;
+        std::string   format;
+    };
+
+    struct DecodedLogEntry
+    {
+        const DecodedLogSite*      site = nullptr;  // null for site-less entries
+        std::int64_t               time_ns   = 0;   // ns since Unix epoch
+        std::uint32_t              thread_id = 0;
+        LogLevel                   level     = LogLevel::Info;
+        std::vector<DecodedLogArg> args;
+
+        // Site format with the arguments substituted.
+        [[nodiscard]] std::string message() const;
+    };
+
+    // Sequential decoder for .wlog files written by BinaryLogSink.
+    class BinaryLogReader
+    {
+    public:
+        BinaryLogReader() = default;
+
+        // Load a whole file / buffer and parse the header.
+        bool open(const fs::path& path);
+        bool load(std::string data);
+
+        // Decode the next entry; site definitions are consumed on the way.
+        // Returns false at end of stream or on corrupt data (see error()).
+        bool next(DecodedLogEntry& out);
+
+        [[nodiscard]] const std::string& app_name() const noexcept { return m_appName; }
+        [[nodiscard]] std::int64_t       base_time_ns() const noexcept { return m_baseTimeNs; }
+        [[nodiscard]] const std::string& error() const noexcept { return m_error; }
+
+        [[nodiscard]] const DecodedLogSite* find_site(std::uint32_t id) const;
+
+    private:
+        bool read_u8(std::uint8_t& out);
+        bool read_varint(std::uint64_t& out);
+        bool read_str(std::string& out);
+        bool fail(const char* what);
+
+        bool read_site();
+        bool read_args(std::string_view packed, std::vector<DecodedLogArg>& out);
+
+    private:
+        std::string  m_data;
+        std::size_t  m_pos = 0;
+
+        std::string  m_appName;
+        std::int64_t m_baseTimeNs = 0;
+        std::int64_t m_lastTimeNs = 0;
+
+        std::unordered_map<std::uint32_t, DecodedLogSite> m_sites;
+
+        std::string  m_error;
+    };
+
+    // Substitute "{}" placeholders in a site format ("{{" / "}}" are literal braces).
+    [[nodiscard]] std::string render_log_format(std::string_view format,
+                                                const std::vector<DecodedLogArg>& args);
+
+} // namespace wave::engine::core::logging
@@ -0,0 +1,136 @@
+#include "engine/core/logging/binary_log_sink.hpp"
+
+namespace wave::engine::core::logging
+{
+    namespace
+    {
+        std::int64_t to_ns(std::chrono::system_clock::time_point t)
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+        }
+    } // namespace
+
+    BinaryLogSink::BinaryLogSink(RotatingFileConfig config,
+                                 std::string app_name,
+                                 std::chrono::milliseconds flush_interval)
+        : m_writer(std::move(config))
+        , m_appName(std::move(app_name))
+        , m_flushInterval(flush_interval)
+    {
+        m_writer.set_open_callback([this](RotatingFileWriter& writer)
+        {
+            write_header(writer);
+        });
+    }
+
+    bool BinaryLogSink::open()
+    {
+        m_lastFlush = std::chrono::steady_clock::now();
+        return m_writer.open();
+    }
+
+    void BinaryLogSink::write_header(RotatingFileWriter& writer)
+    {
+        m_defined.clear();
+        m_lastTimeNs = to_ns(std::chrono::system_clock::now());
+
+        std::string header(binlog::kMagic, sizeof(binlog::kMagic));
+        binlog::put_u8(header, binlog::kVersion);
+        binlog::put_str(header, m_appName);
+        binlog::put_varint(header, static_cast<std::uint64_t>(m_lastTimeNs));
+
+        writer.append(header);
+    }
+
+    void BinaryLogSink::compose(const LogRecord& record, std::string& out)
+    {
+        out.clear();
+
+        std::uint32_t site_id = 0;
+        if (record.site)
+        {
+            site_id = record.site->id;
+
+            if (site_id >= m_defined.size())
+            {
+                m_defined.resize(site_id + 1u, false);
+            }
+
+            if (!m_defined[site_id])
+            {
+                binlog::put_u8(out, static_cast<std::uint8_t>(binlog::RecordType::SiteDefinition));
+                binlog::put_varint(out, site_id);
+                binlog::put_u8(out, static_cast<std::uint8_t>(record.site->level));
+                binlog::put_u8(out, static_cast<std::uint8_t>(record.site->channel));
+                binlog::put_varint(out, static_cast<std::uint64_t>(record.site->line));
+                binlog::put_str(out, record.site->file);
+                binlog::put_str(out, record.site->format);
+            }
+        }
+
+        const std::int64_t now_ns = to_ns(record.time);
+
+        binlog::put_u8(out, static_cast<std::uint8_t>(binlog::RecordType::Entry));
+        binlog::put_varint(out, site_id);
+        binlog::put_zigzag(out, now_ns - m_lastTimeNs);
+        binlog::put_varint(out, record.thread_id);
+        binlog::put_u8(out, static_cast<std::uint8_t>(record.level));
+        binlog::put_str(out, record.packed_args);
+    }
+
+    void BinaryLogSink::write(const LogRecord& record)
+    {
+        if (!m_writer.is_open())
+            return;
+
+        compose(record, m_scratch);
+
+        // The only place this sink rotates: a rotation resets the per-file
+        // definitions, so compose again and write exactly what was composed
+        // for the new file (append() could otherwise rotate once more, e.g.
+        // on age, and leave the entry without its site definition).
+        if (m_writer.should_rotate(m_scratch.size()))
+        {
+            m_writer.rotate();
+            if (!m_writer.is_open())
+                return;
+
+            compose(record, m_scratch);
+        }
+
+        m_writer.append_unchecked(m_scratch);
+
+        if (record.site && !m_defined.empty())
+        {
+            m_defined[record.site->id] = true;
+        }
+        m_lastTimeNs = to_ns(record.time);
+
+        const bool urgent = record.level == LogLevel::Error || record.level == LogLevel::Critical;
+        const auto now    = std::chrono::steady_clock::now();
+
+        if (urgent || now - m_lastFlush >= m_flushInterval)
+        {
+            m_writer.flush();
+            m_lastFlush = now;
+        }
+    }
+
+    void BinaryLogSink::flush()
+    {
+        m_writer.flush();
+        m_lastFlush = std::chrono::steady_clock::now();
+    }
+
+    void BinaryLogSink::poll()
+    {
+        const auto now = std::chrono::steady_clock::now();
+
+        if (now - m_lastFlush >= m_flushInterval)
+        {
+            m_writer.flush();
+            m_lastFlush = now;
+        }
+    }
+
+} // namespace wave::engine::core::logging
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "engine/core/logging/log_sink.hpp"
+#include "engine/core/logging/rotating_file_writer.hpp"
+
+namespace wave::engine::core::logging
+{
+    // Compact binary log stream (.wlog) for high-volume tracing.
+    //
+    // Each call site's literal text is written once per file as a site
+    // definition; entries then only carry the site id, a time delta, the
+    // thread id, the level and the packed runtime arguments. Decode with
+    // BinaryLogReader or the wave_logdump tool. Format: log_format.hpp.
+    class BinaryLogSink final : public LogSink
+    {
+    public:
+        // config.extension is usually ".wlog".
+        BinaryLogSink(RotatingFileConfig config,
+                      std::string app_name,
+                      std::chrono::milliseconds flush_interval = std::chrono::seconds(1));
+
+        bool open();
+
+        void write(const LogRecord& record) override;
+        void flush() override;
+        void poll() override;
+
+        [[nodiscard]] bool wants_text() const override { return false; }
+        [[nodiscard]] bool wants_structured() const override { return true; }
+
+        [[nodiscard]] const fs::path& path() const noexcept { return m_writer.active_path(); }
+
+    private:
+        void write_header(RotatingFileWriter& writer);
+        void compose(const LogRecord& record, std::string& out);
+
+    private:
+        RotatingFileWriter        m_writer;
+        std::string               m_appName;
+        std::chrono::milliseconds m_flushInterval;
+        std::chrono::steady_clock::time_point m_lastFlush{};
+
+        // Per file: which site ids were defined, and the last entry time.
+        std::vector<bool>         m_defined;
+        std::int64_t              m_lastTimeNs = 0;
+
+        std::string               m_scratch;
+    };
+
+} // namespace wave::engine::core::logging
@@ -0,0 +1,54 @@
+#include "engine/core/logging/file_log_sink.hpp"
+
+namespace wave::engine::core::logging
+{
+    FileLogSink::FileLogSink(RotatingFileConfig config, std::chrono::milliseconds flush_interval)
+        : m_writer(std::move(config))
+        , m_flushInterval(flush_interval)
+    {
+    }
+
+    bool FileLogSink::open()
+    {
+        m_lastFlush = std::chrono::steady_clock::now();
+        return m_writer.open();
+    }
+
+    void FileLogSink::write(const LogRecord& record)
+    {
+        if (!m_writer.is_open())
+            return;
+
+        m_line.clear();
+        format_log_line(record, m_line);
+        m_writer.append(m_line);
+
+        // Errors must survive a crash right after them.
+        const bool urgent = record.level == LogLevel::Error || record.level == LogLevel::Critical;
+        const auto now    = std::chrono::steady_clock::now();
+
+        if (urgent || now - m_lastFlush >= m_flushInterval)
+        {
+            m_writer.flush();
+            m_lastFlush = now;
+        }
+    }
+
+    void FileLogSink::flush()
+    {
+        m_writer.flush();
+        m_lastFlush = std::chrono::steady_clock::now();
+    }
+
+    void FileLogSink::poll()
+    {
+        const auto now = std::chrono::steady_clock::now();
+
+        if (now - m_lastFlush >= m_flushInterval)
+        {
+            m_writer.flush();
+            m_lastFlush = now;
+        }
+    }
+
+} // namespace wave::engine::core::logging
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "engine/core/logging/log_sink.hpp"
+#include "engine/core/logging/rotating_file_writer.hpp"
+
+namespace wave::engine::core::logging
+{
+    // Text log file under Environment::logs_path() (or any directory).
+    //
+    // Lines use the same format as the terminal. Output is buffered by a
+    // RotatingFileWriter and handed to the OS when the buffer fills, when an
+    // Error / Critical record arrives, or once flush_interval has passed
+    // since the last flush. The interval is checked on the next write and on
+    // Logger::poll(), so the main loop must poll for a quiet log to reach
+    // the file.
+    class FileLogSink final : public LogSink
+    {
+    public:
+        explicit FileLogSink(RotatingFileConfig config,
+                             std::chrono::milliseconds flush_interval = std::chrono::seconds(1));
+
+        // Open the file. Returns false if the directory or file cannot be created.
+        bool open();
+
+        void write(const LogRecord& record) override;
+        void flush() override;
+        void poll() override;
+
+        [[nodiscard]] const fs::path& path() const noexcept { return m_writer.active_path(); }
+
+    private:
+        RotatingFileWriter                    m_writer;
+        std::chrono::milliseconds             m_flushInterval;
+        std::chrono::steady_clock::time_point m_lastFlush{};
+        std::string                           m_line;
+    };
+
+} // namespace wave::engine::core::logging
@@ -1,97 +1,304 @@
 #include "engine/core/logging/log.hpp"
 
+#include "engine/core/logging/log_sink.hpp"
+
+#include <algorithm>
 #include <chrono>
-#include <ctime>
-#include <iomanip>
-#include <iostream>
-#include <atomic>
+#include <deque>
+#include <vector>
 
 namespace wave::engine::core::logging
 {
     namespace
     {
-        std::atomic<LogLevel> g_min_level{LogLevel::Info};
-        std::string           g_app_name;
-    } // namespace
+        std::string g_app_name;
+
+        std::vector<std::shared_ptr<LogSink>>& sinks()
+        {
+            // Function-local so logging from static initializers is safe.
+            static std::vector<std::shared_ptr<LogSink>> s_sinks{
+                std::make_shared<TerminalLogSink>()
+            };
+            return s_sinks;
+        }
 
-    std::mutex Logger::s_mutex;
+        // Call site registry. Entries never move, sites keep pointers into it.
+        std::mutex              g_site_mutex;
+        std::deque<LogSiteInfo> g_sites;
 
-    static const char* level_to_string(LogLevel level) noexcept
-    {
-        switch (level)
+        std::atomic<std::uint32_t> g_next_thread_id{1};
+
+        // 'level' repeated in every 4-bit channel slot.
+        constexpr std::uint64_t all_channels(LogLevel level) noexcept
         {
-            case LogLevel::Trace:    return "TRACE";
-            case LogLevel::Debug:    return "DEBUG";
-            case LogLevel::Info:     return "INFO";
-            case LogLevel::Warn:     return "WARN";
-            case LogLevel::Error:    return "ERROR";
-            case LogLevel::Critical: return "CRITICAL";
-            default:                 return "UNKNOWN";
+            return static_cast<std::uint64_t>(level) * 0x1111111111111111ull;
         }
-    }
 
-    void Logger::init(std::string app_name, LogLevel min_level) noexcept
+        // Last message written, for duplicate collapsing. Guarded by Logger::s_mutex.
+        struct LastMessage
+        {
+            bool               valid   = false;
+            LogChannel         channel = LogChannel::General;
+            LogLevel           level   = LogLevel::Info;
+            const LogSiteInfo* site    = nullptr;
+            std::string        message;
+            std::string        packed;
+            std::uint32_t      repeats = 0;
+        };
+
+        LastMessage g_last;
+
+        void dispatch(const LogRecord& record)
+        {
+            for (const auto& sink : sinks())
+            {
+                sink->write(record);
+            }
+        }
+    } // namespace
+
+    std::mutex                 Logger::s_mutex;
+    std::atomic<std::uint64_t> Logger::s_channel_levels{all_channels(LogLevel::Info)};
+    std::atomic<std::uint32_t> Logger::s_text_sinks{1};
+    std::atomic<std::uint32_t> Logger::s_structured_sinks{0};
+    std::atomic<bool>          Logger::s_collapse_duplicates{true};
+
+    void Logger::init(std::string app_name, LogLevel min_level, bool terminal_output) noexcept
     {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
         g_app_name = std::move(app_name);
-        g_min_level.store(min_level, std::memory_order_relaxed);
+        s_channel_levels.store(all_channels(min_level), std::memory_order_relaxed);
+
+        sinks().clear();
+        if (terminal_output)
+        {
+            sinks().push_back(std::make_shared<TerminalLogSink>());
+        }
+
+        recount_sinks();
     }
 
     void Logger::shutdown() noexcept
     {
-        // Placeholder for future sinks (files, remote endpoints).
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        flush_repeats();
+        g_last.valid = false;
+
+        for (const auto& sink : sinks())
+        {
+            sink->flush();
+        }
+
+        // Late messages (static destructors, crash handlers) still reach the terminal.
+        sinks().clear();
+        sinks().push_back(std::make_shared<TerminalLogSink>());
+        recount_sinks();
+
         g_app_name.clear();
     }
 
+    void Logger::add_sink(std::shared_ptr<LogSink> sink)
+    {
+        if (!sink)
+            return;
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        sinks().push_back(std::move(sink));
+        recount_sinks();
+    }
+
+    void Logger::remove_sink(const std::shared_ptr<LogSink>& sink)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        auto& list = sinks();
+        list.erase(std::remove(list.begin(), list.end(), sink), list.end());
+        recount_sinks();
+
+        if (sink)
+        {
+            sink->flush();
+        }
+    }
+
+    void Logger::flush()
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        flush_repeats();
+
+        for (const auto& sink : sinks())
+        {
+            sink->flush();
+        }
+    }
+
+    void Logger::poll()
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        for (const auto& sink : sinks())
+        {
+            sink->poll();
+        }
+    }
+
     void Logger::set_min_level(LogLevel level) noexcept
     {
-        g_min_level.store(level, std::memory_order_relaxed);
+        s_channel_levels.store(all_channels(level), std::memory_order_relaxed);
     }
 
     LogLevel Logger::min_level() noexcept
     {
-        return g_min_level.load(std::memory_order_relaxed);
+        return channel_level(LogChannel::General);
+    }
+
+    void Logger::set_channel_level(LogChannel channel, LogLevel level) noexcept
+    {
+        if (channel >= LogChannel::Count)
+            return;
+
+        const unsigned      shift = static_cast<unsigned>(channel) * 4u;
+        const std::uint64_t mask  = 0xFull << shift;
+        const std::uint64_t bits  = static_cast<std::uint64_t>(level) << shift;
+
+        std::uint64_t current = s_channel_levels.load(std::memory_order_relaxed);
+        while (!s_channel_levels.compare_exchange_weak(current, (current & ~mask) | bits,
+                                                       std::memory_order_relaxed))
+        {
+        }
+    }
+
+    LogLevel Logger::channel_level(LogChannel channel) noexcept
+    {
+        const std::uint64_t levels = s_channel_levels.load(std::memory_order_relaxed);
+        return static_cast<LogLevel>((levels >> (static_cast<unsigned>(channel) * 4u)) & 0xFu);
+    }
+
+    void Logger::set_collapse_duplicates(bool enabled) noexcept
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        if (!enabled)
+        {
+            flush_repeats();
+            g_last.valid = false;
+        }
+
+        s_collapse_duplicates.store(enabled, std::memory_order_relaxed);
+    }
+
+    std::uint32_t Logger::thread_id() noexcept
+    {
+        thread_local const std::uint32_t s_id = g_next_thread_id.fetch_add(1, std::memory_order_relaxed);
+        return s_id;
+    }
+
+    const LogSiteInfo* Logger::register_site(LogSite& site, std::string format)
+    {
+        std::lock_guard<std::mutex> lock(g_site_mutex);
+
+        // Another thread may have won the race.
+        if (const LogSiteInfo* existing = site.info.load(std::memory_order_acquire))
+            return existing;
+
+        LogSiteInfo& info = g_sites.emplace_back();
+        info.id      = static_cast<std::uint32_t>(g_sites.size());
+        info.level   = site.level;
+        info.channel = site.channel;
+        info.file    = site.file;
+        info.line    = site.line;
+        info.format  = std::move(format);
+
+        site.info.store(&info, std::memory_order_release);
+        return &info;
     }
 
-    bool Logger::should_log(LogLevel level) noexcept
+    void Logger::recount_sinks()
     {
-        return static_cast<std::uint8_t>(level) >=
-               static_cast<std::uint8_t>(g_min_level.load(std::memory_order_relaxed));
+        // Caller holds s_mutex.
+        std::uint32_t text       = 0;
+        std::uint32_t structured = 0;
+
+        for (const auto& sink : sinks())
+        {
+            text       += sink->wants_text() ? 1u : 0u;
+            structured += sink->wants_structured() ? 1u : 0u;
+        }
+
+        s_text_sinks.store(text, std::memory_order_relaxed);
+        s_structured_sinks.store(structured, std::memory_order_relaxed);
     }
 
-    void Logger::write_line(LogLevel level, std::string_view message)
+    void Logger::write_line(LogChannel channel,
+                            LogLevel level,
+                            const LogSiteInfo* site,
+                            std::string_view message,
+                            std::string_view packed_args)
     {
+        const std::uint32_t tid = thread_id();
+
         std::lock_guard<std::mutex> lock(s_mutex);
 
-        // Timestamp in local time [HH:MM:SS]
-        const auto now   = std::chrono::system_clock::now();
-        const auto now_t = std::chrono::system_clock::to_time_t(now);
-        std::tm     tm_buf{};
+        LogRecord record{};
+        record.level       = level;
+        record.channel     = channel;
+        record.time        = std::chrono::system_clock::now();
+        record.app_name    = g_app_name;
+        record.thread_id   = tid;
+        record.message     = message;
+        record.site        = site;
+        record.packed_args = packed_args;
+
+        if (s_collapse_duplicates.load(std::memory_order_relaxed))
+        {
+            if (g_last.valid && g_last.level == level && g_last.channel == channel &&
+                g_last.site == site && g_last.message == message && g_last.packed == packed_args)
+            {
+                ++g_last.repeats;
+                return;
+            }
+
+            flush_repeats();
+
+            g_last.valid   = true;
+            g_last.channel = channel;
+            g_last.level   = level;
+            g_last.site    = site;
+            g_last.message.assign(message);
+            g_last.packed.assign(packed_args);
+        }
 
-#if defined(_WIN32)
-        localtime_s(&tm_buf, &now_t);
-#else
-        localtime_r(&now_t, &tm_buf);
-#endif
+        dispatch(record);
+    }
 
-        std::ostream& out =
-            (level == LogLevel::Error || level == LogLevel::Critical)
-                ? static_cast<std::ostream&>(std::cerr)
-                : static_cast<std::ostream&>(std::clog);
+    void Logger::flush_repeats()
+    {
+        // Caller holds s_mutex.
+        if (g_last.repeats == 0)
+            return;
 
-        out << '['
-            << std::setfill('0') << std::setw(2) << tm_buf.tm_hour << ':'
-            << std::setfill('0') << std::setw(2) << tm_buf.tm_min << ':'
-            << std::setfill('0') << std::setw(2) << tm_buf.tm_sec << ']';
+        const std::string text = "Last message repeated " + std::to_string(g_last.repeats) + " times";
+        g_last.repeats = 0;
 
-        if (!g_app_name.empty())
+        std::string packed;
+        if (s_structured_sinks.load(std::memory_order_relaxed) > 0)
         {
-            out << '[' << g_app_name << ']';
+            binlog::pack_arg(packed, std::string_view(text));
         }
 
-        out << '[' << level_to_string(level) << "] "
-            << message << '\n';
+        LogRecord record{};
+        record.level       = g_last.level;
+        record.channel     = g_last.channel;
+        record.time        = std::chrono::system_clock::now();
+        record.app_name    = g_app_name;
+        record.thread_id   = thread_id();
+        record.message     = text;
+        record.packed_args = packed;
 
-        out.flush();
+        dispatch(record);
     }
 
 } // namespace wave::engine::core::logging
@@ -1,11 +1,17 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <string_view>
 #include <sstream>
 #include <mutex>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 
+#include "engine/core/build/build_config.hpp"
+#include "engine/core/logging/log_format.hpp"
+
 namespace wave::engine::core::logging
 {
     enum class LogLevel : std::uint8_t
@@ -15,7 +21,113 @@ namespace wave::engine::core::logging
         Info,
         Warn,
         Error,
-        Critical
+        Critical,
+
+        // Threshold only: disables a channel entirely.
+        Off
+    };
+
+    // Subsystem a message belongs to. Each channel has its own runtime level.
+    // Keep in sync with channel_to_string() in log_sink.cpp; at most 16.
+    enum class LogChannel : std::uint8_t
+    {
+        General,
+        Runtime,
+        Render,
+        Resources,
+        Assets,
+        Filesystem,
+        Jobs,
+        Editor,
+        Launcher,
+
+        Count
+    };
+
+    static_assert(static_cast<int>(LogChannel::Count) <= 16,
+                  "channel levels are packed 4 bits per channel into one 64-bit word");
+
+    class LogSink;
+
+    // Call site description shared with structured sinks.
+    // 'format' is the interned literal text, see log_format.hpp.
+    struct LogSiteInfo
+    {
+        std::uint32_t id      = 0;
+        LogLevel      level   = LogLevel::Info;
+        LogChannel    channel = LogChannel::General;
+        const char*   file    = "";
+        int           line  = 0;
+        std::string   format;
+    };
+
+    // One static instance per WAVE_LOG_* call site (constant-initialized, so
+    // no guard variable). The LogSiteInfo is registered on first use by a
+    // structured sink.
+    struct LogSite
+    {
+        constexpr LogSite(const char* file_, int line_, LogLevel level_,
+                          LogChannel channel_ = LogChannel::General) noexcept
+            : file(file_)
+            , line(line_)
+            , level(level_)
+            , channel(channel_)
+        {
+        }
+
+        const char* file;
+        int         line;
+        LogLevel    level;
+        LogChannel  channel;
+
+        std::atomic<const LogSiteInfo*> info{nullptr};
+    };
+
+    // Per call site budget for the WAVE_LOG_*_LIMITED macros: at most
+    // max_per_second messages in each one-second window. State is one packed
+    // atomic (window second << 24 | count) plus a counter of dropped messages.
+    struct LogRateLimit
+    {
+        // True if this message may be written. 'suppressed' receives the number
+        // of messages dropped since the last one that got through.
+        bool try_acquire(std::uint32_t max_per_second, std::uint32_t& suppressed) noexcept
+        {
+            constexpr std::uint64_t kCountBits = 24;
+            constexpr std::uint64_t kCountMask = (1ull << kCountBits) - 1;
+
+            const std::uint64_t now_s = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::seconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+            const std::uint64_t window = now_s & ((1ull << (64 - kCountBits)) - 1);
+
+            suppressed = 0;
+
+            std::uint64_t current = state.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                const bool          same_window = (current >> kCountBits) == window;
+                const std::uint64_t count       = current & kCountMask;
+
+                if (same_window && count >= max_per_second)
+                {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+
+                const std::uint64_t next = same_window ? current + 1 : (window << kCountBits) | 1;
+                if (state.compare_exchange_weak(current, next, std::memory_order_relaxed))
+                    break;
+            }
+
+            if (dropped.load(std::memory_order_relaxed) != 0)
+            {
+                suppressed = dropped.exchange(0, std::memory_order_relaxed);
+            }
+            return true;
+        }
+
+        std::atomic<std::uint64_t> state{0};
+        std::atomic<std::uint32_t> dropped{0};
     };
 
     class Logger
@@ -29,15 +141,106 @@ namespace wave::engine::core::logging
         Logger& operator=(const Logger&) = delete;
         Logger& operator=(Logger&&) = delete;
 
-        // Call once at startup (launcher, editor, game runtime)
+        // Call once at startup (launcher, editor, game runtime).
+        // terminal_output installs the default TerminalLogSink; pass false for
+        // processes that only want file / custom sinks.
         static void init(std::string app_name,
-                         LogLevel min_level = LogLevel::Info) noexcept;
+                         LogLevel min_level = LogLevel::Info,
+                         bool terminal_output = true) noexcept;
 
+        // Flushes and releases all sinks, then falls back to terminal output.
         static void shutdown() noexcept;
 
+        // Sinks ----------------------------------------------------------------
+
+        static void add_sink(std::shared_ptr<LogSink> sink);
+        static void remove_sink(const std::shared_ptr<LogSink>& sink);
+
+        // Push buffered output of every sink to its target.
+        static void flush();
+
+        // Time based housekeeping of every sink (interval flushes). Call once
+        // per frame from the main loop.
+        static void poll();
+
+        // Sets the level of every channel.
         static void set_min_level(LogLevel level) noexcept;
+
+        // Level of LogChannel::General.
         [[nodiscard]] static LogLevel min_level() noexcept;
 
+        // Per channel level, e.g. Trace for Render only. LogLevel::Off mutes it.
+        static void set_channel_level(LogChannel channel, LogLevel level) noexcept;
+        [[nodiscard]] static LogLevel channel_level(LogChannel channel) noexcept;
+
+        // Identical consecutive messages are written once and then summarized
+        // as "Last message repeated N times" when a different message arrives
+        // or on flush(). On by default.
+        static void set_collapse_duplicates(bool enabled) noexcept;
+
+        // Is this level compiled into the binary at all (WAVE_LOG_COMPILE_LEVEL).
+        [[nodiscard]] static constexpr bool is_compiled(LogLevel level) noexcept
+        {
+            return static_cast<int>(level) >= build::kLogCompileLevel;
+        }
+
+        // Runtime level check. Inline so the macros early-out at the call site
+        // with a single relaxed load, before any argument is formatted.
+        // All channel levels live in one word, 4 bits per channel.
+        [[nodiscard]] static bool is_enabled(LogChannel channel, LogLevel level) noexcept
+        {
+            const std::uint64_t levels = s_channel_levels.load(std::memory_order_relaxed);
+            const std::uint64_t min    = (levels >> (static_cast<unsigned>(channel) * 4u)) & 0xFu;
+
+            return is_compiled(level) && static_cast<std::uint64_t>(level) >= min;
+        }
+
+        [[nodiscard]] static bool is_enabled(LogLevel level) noexcept
+        {
+            return is_enabled(LogChannel::General, level);
+        }
+
+        // Format and write without checking the level.
+        // Used by the WAVE_LOG_* macros after is_enabled() succeeded.
+        template <typename... Args>
+        static void write(LogSite& site, Args&&... args)
+        {
+            write_impl(&site, site.channel, site.level, args...);
+        }
+
+        template <typename... Args>
+        static void write(LogLevel level, Args&&... args)
+        {
+            write_impl(nullptr, LogChannel::General, level, args...);
+        }
+
+        template <typename... Args>
+        static void write(LogChannel channel, LogLevel level, Args&&... args)
+        {
+            write_impl(nullptr, channel, level, args...);
+        }
+
+        // Rate limited variant used by the WAVE_LOG_*_LIMITED macros.
+        template <typename... Args>
+        static void write_limited(LogSite& site, LogRateLimit& limit,
+                                  std::uint32_t max_per_second, Args&&... args)
+        {
+            std::uint32_t suppressed = 0;
+            if (!limit.try_acquire(max_per_second, suppressed))
+                return;
+
+            if (suppressed > 0)
+            {
+                write(site.channel, site.level, "Suppressed ", suppressed, " messages from ",
+                      site.file, ":", site.line, " (rate limit ", max_per_second, "/s)");
+            }
+
+            write_impl(&site, site.channel, site.level, args...);
+        }
+
+        // Small sequential id of the calling thread (1 = first thread that logged).
+        [[nodiscard]] static std::uint32_t thread_id() noexcept;
+
         template <typename... Args>
         static void trace(Args&&... args)
         {
@@ -78,26 +281,83 @@ namespace wave::engine::core::logging
         template <typename... Args>
         static void log(LogLevel level, Args&&... args)
         {
-            if (!should_log(level))
+            if (!is_enabled(level))
                 return;
 
-            std::string message = build_message(std::forward<Args>(args)...);
-            write_line(level, message);
+            write(level, std::forward<Args>(args)...);
         }
 
+        // Arguments arrive as lvalues of their original types so literals
+        // (const char(&)[N]) can be told apart from runtime strings.
         template <typename... Args>
-        static std::string build_message(Args&&... args)
+        static void write_impl(LogSite* site, LogChannel channel, LogLevel level, Args&... args)
+        {
+            std::string message;
+            if (s_text_sinks.load(std::memory_order_relaxed) > 0)
+            {
+                message = build_message(args...);
+            }
+
+            std::string        packed;
+            const LogSiteInfo* info = nullptr;
+
+            if (s_structured_sinks.load(std::memory_order_relaxed) > 0)
+            {
+                if (site)
+                {
+                    info = site->info.load(std::memory_order_acquire);
+                    if (!info)
+                    {
+                        std::string format;
+                        (binlog::append_format_piece(format, args), ...);
+                        info = register_site(*site, std::move(format));
+                    }
+
+                    (binlog::pack_arg(packed, args), ...);
+                }
+                else
+                {
+                    // No call site: the whole message is the only argument.
+                    if (message.empty())
+                    {
+                        message = build_message(args...);
+                    }
+                    binlog::pack_arg(packed, std::string_view(message));
+                }
+            }
+
+            write_line(channel, level, info, message, packed);
+        }
+
+        template <typename... Args>
+        static std::string build_message(Args&... args)
         {
             std::ostringstream oss;
-            (oss << ... << std::forward<Args>(args));
+            (oss << ... << args);
             return oss.str();
         }
 
-        [[nodiscard]] static bool should_log(LogLevel level) noexcept;
-        static void write_line(LogLevel level, std::string_view message);
+        static const LogSiteInfo* register_site(LogSite& site, std::string format);
+
+        static void write_line(LogChannel channel,
+                               LogLevel level,
+                               const LogSiteInfo* site,
+                               std::string_view message,
+                               std::string_view packed_args);
+
+        static void recount_sinks();
+        static void flush_repeats();
 
     private:
-        static std::mutex s_mutex;
+        static std::mutex                 s_mutex;
+        static std::atomic<std::uint64_t> s_channel_levels;
+
+        // Number of installed sinks wanting text / structured records, so
+        // write() only does the work somebody consumes.
+        static std::atomic<std::uint32_t> s_text_sinks;
+        static std::atomic<std::uint32_t> s_structured_sinks;
+
+        static std::atomic<bool>          s_collapse_duplicates;
     };
 
 } // namespace wave::engine::core::logging
@@ -106,10 +366,192 @@ namespace wave::engine::core::logging
 // Usage:
 //   WAVE_LOG_INFO("Launcher started, version ", version);
 //   WAVE_LOG_ERROR("Failed to load config: ", path);
+//
+// Levels below WAVE_LOG_COMPILE_LEVEL (see build_config.hpp) expand to a
+// dead branch: arguments are still type-checked but never evaluated.
+// Enabled levels check the runtime minimum inline and only then format.
+//
+// WAVE_LOG_CH_<LEVEL>(Channel, ...) logs to a LogChannel other than General,
+// filtered by that channel's own level (Logger::set_channel_level):
+//   WAVE_LOG_CH_TRACE(Render, "Swapchain recreated: ", width, "x", height);
+//
+// WAVE_LOG_<LEVEL>_LIMITED(max_per_second, ...) and
+// WAVE_LOG_CH_<LEVEL>_LIMITED(Channel, max_per_second, ...) are for per-frame
+// paths: each call site writes at most max_per_second messages per second and
+// reports how many it dropped with the next one that gets through.
+//   WAVE_LOG_CH_ERROR_LIMITED(Render, 1, "Swapchain acquire failed: ", code);
+
+#define WAVE_LOG_EMIT_(channel, level, ...)                                             \
+    do                                                                                  \
+    {                                                                                   \
+        if (::wave::engine::core::logging::Logger::is_enabled(                          \
+                ::wave::engine::core::logging::LogChannel::channel,                     \
+                ::wave::engine::core::logging::LogLevel::level)) [[unlikely]]           \
+        {                                                                               \
+            static constinit ::wave::engine::core::logging::LogSite wave_log_site_{     \
+                __FILE__, __LINE__,                                                     \
+                ::wave::engine::core::logging::LogLevel::level,                         \
+                ::wave::engine::core::logging::LogChannel::channel};                    \
+            ::wave::engine::core::logging::Logger::write(wave_log_site_, __VA_ARGS__);  \
+        }                                                                               \
+    } while (false)
+
+#define WAVE_LOG_EMIT_LIMITED_(channel, level, max_per_second, ...)                     \
+    do                                                                                  \
+    {                                                                                   \
+        if (::wave::engine::core::logging::Logger::is_enabled(                          \
+                ::wave::engine::core::logging::LogChannel::channel,                     \
+                ::wave::engine::core::logging::LogLevel::level)) [[unlikely]]           \
+        {                                                                               \
+            static constinit ::wave::engine::core::logging::LogSite wave_log_site_{     \
+                __FILE__, __LINE__,                                                     \
+                ::wave::engine::core::logging::LogLevel::level,                         \
+                ::wave::engine::core::logging::LogChannel::channel};                    \
+            static constinit ::wave::engine::core::logging::LogRateLimit wave_log_rl_;  \
+            ::wave::engine::core::logging::Logger::write_limited(                       \
+                wave_log_site_, wave_log_rl_, (max_per_second), __VA_ARGS__);           \
+        }                                                                               \
+    } while (false)
+
+#define WAVE_LOG_DISCARD_(channel, level, ...)                                          \
+    do                                                                                  \
+    {                                                                                   \
+        if (false)                                                                      \
+        {                                                                               \
+            ::wave::engine::core::logging::Logger::write(                               \
+                ::wave::engine::core::logging::LogChannel::channel,                     \
+                ::wave::engine::core::logging::LogLevel::level, __VA_ARGS__);           \
+        }                                                                               \
+    } while (false)
+
+#define WAVE_LOG_DISCARD_LIMITED_(channel, level, max_per_second, ...)                  \
+    do                                                                                  \
+    {                                                                                   \
+        if (false)                                                                      \
+        {                                                                               \
+            (void)(max_per_second);                                                     \
+            ::wave::engine::core::logging::Logger::write(                               \
+                ::wave::engine::core::logging::LogChannel::channel,                     \
+                ::wave::engine::core::logging::LogLevel::level, __VA_ARGS__);           \
+        }                                                                               \
+    } while (false)
+
+#if WAVE_LOG_COMPILE_LEVEL <= WAVE_LOG_LEVEL_TRACE
+    #define WAVE_LOG_TRACE(...) \
+        WAVE_LOG_EMIT_(General, Trace, __VA_ARGS__)
+    #define WAVE_LOG_TRACE_LIMITED(max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(General, Trace, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_TRACE(channel, ...) \
+        WAVE_LOG_EMIT_(channel, Trace, __VA_ARGS__)
+    #define WAVE_LOG_CH_TRACE_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(channel, Trace, max_per_second, __VA_ARGS__)
+#else
+    #define WAVE_LOG_TRACE(...) \
+        WAVE_LOG_DISCARD_(General, Trace, __VA_ARGS__)
+    #define WAVE_LOG_TRACE_LIMITED(max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(General, Trace, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_TRACE(channel, ...) \
+        WAVE_LOG_DISCARD_(channel, Trace, __VA_ARGS__)
+    #define WAVE_LOG_CH_TRACE_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(channel, Trace, max_per_second, __VA_ARGS__)
+#endif
+
+#if WAVE_LOG_COMPILE_LEVEL <= WAVE_LOG_LEVEL_DEBUG
+    #define WAVE_LOG_DEBUG(...) \
+        WAVE_LOG_EMIT_(General, Debug, __VA_ARGS__)
+    #define WAVE_LOG_DEBUG_LIMITED(max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(General, Debug, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_DEBUG(channel, ...) \
+        WAVE_LOG_EMIT_(channel, Debug, __VA_ARGS__)
+    #define WAVE_LOG_CH_DEBUG_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(channel, Debug, max_per_second, __VA_ARGS__)
+#else
+    #define WAVE_LOG_DEBUG(...) \
+        WAVE_LOG_DISCARD_(General, Debug, __VA_ARGS__)
+    #define WAVE_LOG_DEBUG_LIMITED(max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(General, Debug, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_DEBUG(channel, ...) \
+        WAVE_LOG_DISCARD_(channel, Debug, __VA_ARGS__)
+    #define WAVE_LOG_CH_DEBUG_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(channel, Debug, max_per_second, __VA_ARGS__)
+#endif
+
+#if WAVE_LOG_COMPILE_LEVEL <= WAVE_LOG_LEVEL_INFO
+    #define WAVE_LOG_INFO(...) \
+        WAVE_LOG_EMIT_(General, Info, __VA_ARGS__)
+    #define WAVE_LOG_INFO_LIMITED(max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(General, Info, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_INFO(channel, ...) \
+        WAVE_LOG_EMIT_(channel, Info, __VA_ARGS__)
+    #define WAVE_LOG_CH_INFO_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(channel, Info, max_per_second, __VA_ARGS__)
+#else
+    #define WAVE_LOG_INFO(...) \
+        WAVE_LOG_DISCARD_(General, Info, __VA_ARGS__)
+    #define WAVE_LOG_INFO_LIMITED(max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(General, Info, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_INFO(channel, ...) \
+        WAVE_LOG_DISCARD_(channel, Info, __VA_ARGS__)
+    #define WAVE_LOG_CH_INFO_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(channel, Info, max_per_second, __VA_ARGS__)
+#endif
+
+#if WAVE_LOG_COMPILE_LEVEL <= WAVE_LOG_LEVEL_WARN
+    #define WAVE_LOG_WARN(...) \
+        WAVE_LOG_EMIT_(General, Warn, __VA_ARGS__)
+    #define WAVE_LOG_WARN_LIMITED(max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(General, Warn, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_WARN(channel, ...) \
+        WAVE_LOG_EMIT_(channel, Warn, __VA_ARGS__)
+    #define WAVE_LOG_CH_WARN_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(channel, Warn, max_per_second, __VA_ARGS__)
+#else
+    #define WAVE_LOG_WARN(...) \
+        WAVE_LOG_DISCARD_(General, Warn, __VA_ARGS__)
+    #define WAVE_LOG_WARN_LIMITED(max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(General, Warn, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_WARN(channel, ...) \
+        WAVE_LOG_DISCARD_(channel, Warn, __VA_ARGS__)
+    #define WAVE_LOG_CH_WARN_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(channel, Warn, max_per_second, __VA_ARGS__)
+#endif
+
+#if WAVE_LOG_COMPILE_LEVEL <= WAVE_LOG_LEVEL_ERROR
+    #define WAVE_LOG_ERROR(...) \
+        WAVE_LOG_EMIT_(General, Error, __VA_ARGS__)
+    #define WAVE_LOG_ERROR_LIMITED(max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(General, Error, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_ERROR(channel, ...) \
+        WAVE_LOG_EMIT_(channel, Error, __VA_ARGS__)
+    #define WAVE_LOG_CH_ERROR_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(channel, Error, max_per_second, __VA_ARGS__)
+#else
+    #define WAVE_LOG_ERROR(...) \
+        WAVE_LOG_DISCARD_(General, Error, __VA_ARGS__)
+    #define WAVE_LOG_ERROR_LIMITED(max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(General, Error, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_ERROR(channel, ...) \
+        WAVE_LOG_DISCARD_(channel, Error, __VA_ARGS__)
+    #define WAVE_LOG_CH_ERROR_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(channel, Error, max_per_second, __VA_ARGS__)
+#endif
 
-#define WAVE_LOG_TRACE(...)    ::wave::engine::core::logging::Logger::trace(__VA_ARGS__)
-#define WAVE_LOG_DEBUG(...)    ::wave::engine::core::logging::Logger::debug(__VA_ARGS__)
-#define WAVE_LOG_INFO(...)     ::wave::engine::core::logging::Logger::info(__VA_ARGS__)
-#define WAVE_LOG_WARN(...)     ::wave::engine::core::logging::Logger::warn(__VA_ARGS__)
-#define WAVE_LOG_ERROR(...)    ::wave::engine::core::logging::Logger::error(__VA_ARGS__)
-#define WAVE_LOG_CRITICAL(...) ::wave::engine::core::logging::Logger::critical(__VA_ARGS__)
+#if WAVE_LOG_COMPILE_LEVEL <= WAVE_LOG_LEVEL_CRITICAL
+    #define WAVE_LOG_CRITICAL(...) \
+        WAVE_LOG_EMIT_(General, Critical, __VA_ARGS__)
+    #define WAVE_LOG_CRITICAL_LIMITED(max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(General, Critical, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_CRITICAL(channel, ...) \
+        WAVE_LOG_EMIT_(channel, Critical, __VA_ARGS__)
+    #define WAVE_LOG_CH_CRITICAL_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_EMIT_LIMITED_(channel, Critical, max_per_second, __VA_ARGS__)
+#else
+    #define WAVE_LOG_CRITICAL(...) \
+        WAVE_LOG_DISCARD_(General, Critical, __VA_ARGS__)
+    #define WAVE_LOG_CRITICAL_LIMITED(max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(General, Critical, max_per_second, __VA_ARGS__)
+    #define WAVE_LOG_CH_CRITICAL(channel, ...) \
+        WAVE_LOG_DISCARD_(channel, Critical, __VA_ARGS__)
+    #define WAVE_LOG_CH_CRITICAL_LIMITED(channel, max_per_second, ...) \
+        WAVE_LOG_DISCARD_LIMITED_(channel, Critical, max_per_second, __VA_ARGS__)
+#endif
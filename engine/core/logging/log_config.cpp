@@ -0,0 +1,136 @@
+#include "engine/core/logging/log_config.hpp"
+
+#include "engine/core/config/config_system.hpp"
+#include "engine/core/logging/log.hpp"
+#include "engine/core/logging/log_sink.hpp"
+
+#include <vector>
+
+namespace wave::engine::core::logging
+{
+    namespace
+    {
+        constexpr std::string_view kChannelPrefix = "log.channel.";
+
+        std::vector<std::string_view> split_words(std::string_view text)
+        {
+            std::vector<std::string_view> words;
+
+            std::size_t pos = 0;
+            while (pos < text.size())
+            {
+                while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t'))
+                    ++pos;
+
+                const std::size_t start = pos;
+                while (pos < text.size() && text[pos] != ' ' && text[pos] != '\t')
+                    ++pos;
+
+                if (pos > start)
+                    words.push_back(text.substr(start, pos - start));
+            }
+
+            return words;
+        }
+
+        std::string describe_levels()
+        {
+            std::string text;
+            for (std::uint8_t i = 0; i < static_cast<std::uint8_t>(LogChannel::Count); ++i)
+            {
+                const auto channel = static_cast<LogChannel>(i);
+
+                if (!text.empty())
+                    text += ", ";
+
+                text += channel_to_string(channel);
+                text += '=';
+                text += level_to_string(Logger::channel_level(channel));
+            }
+            return text;
+        }
+    } // namespace
+
+    void apply_log_config(const config::ConfigTable& table)
+    {
+        if (const config::ConfigValue* value = table.get("log.level"))
+        {
+            LogLevel level{};
+            const std::string text = value->as_string();
+
+            if (parse_log_level(text, level))
+                Logger::set_min_level(level);
+            else
+                WAVE_LOG_WARN("Unknown log level in log.level: '", text, "'");
+        }
+
+        if (const config::ConfigValue* value = table.get("log.collapse_duplicates"))
+        {
+            Logger::set_collapse_duplicates(value->as_bool(true));
+        }
+
+        for (const auto& [key, value] : table.entries())
+        {
+            if (key.compare(0, kChannelPrefix.size(), kChannelPrefix) != 0)
+                continue;
+
+            const std::string_view name = std::string_view(key).substr(kChannelPrefix.size());
+            const std::string      text = value.as_string();
+
+            LogChannel channel{};
+            LogLevel   level{};
+
+            if (!parse_log_channel(name, channel))
+            {
+                WAVE_LOG_WARN("Unknown log channel in config: ", key);
+                continue;
+            }
+
+            if (!parse_log_level(text, level))
+            {
+                WAVE_LOG_WARN("Unknown log level in ", key, ": '", text, "'");
+                continue;
+            }
+
+            Logger::set_channel_level(channel, level);
+        }
+    }
+
+    bool execute_log_command(std::string_view args, std::string& reply)
+    {
+        const std::vector<std::string_view> words = split_words(args);
+
+        if (words.empty())
+        {
+            reply = describe_levels();
+            return true;
+        }
+
+        LogLevel level{};
+        if (words.size() != 2 || !parse_log_level(words[1], level))
+        {
+            reply = "usage: log [level <lvl> | <channel> <lvl>]  "
+                    "(lvl: trace, debug, info, warn, error, critical, off)";
+            return false;
+        }
+
+        if (words[0] == "level")
+        {
+            Logger::set_min_level(level);
+            reply = std::string("All channels set to ") + level_to_string(level);
+            return true;
+        }
+
+        LogChannel channel{};
+        if (!parse_log_channel(words[0], channel))
+        {
+            reply = "Unknown channel '" + std::string(words[0]) + "'. Channels: " + describe_levels();
+            return false;
+        }
+
+        Logger::set_channel_level(channel, level);
+        reply = std::string(channel_to_string(channel)) + " set to " + level_to_string(level);
+        return true;
+    }
+
+} // namespace wave::engine::core::logging
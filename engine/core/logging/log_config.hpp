@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace wave::engine::core::config
+{
+    class ConfigTable;
+}
+
+namespace wave::engine::core::logging
+{
+    // Apply logging settings from a config table:
+    //
+    //   log.level                = info      # every channel
+    //   log.channel.<name>       = trace     # one channel, e.g. log.channel.render
+    //   log.collapse_duplicates  = true
+    //
+    // "log.level" is applied first so channel entries override it.
+    // Unknown channel names and levels are reported with WAVE_LOG_WARN.
+    void apply_log_config(const config::ConfigTable& table);
+
+    // Text command used by the editor console ("log ..."):
+    //
+    //   log                       list channel levels
+    //   log level <lvl>           set every channel
+    //   log <channel> <lvl>       set one channel
+    //
+    // 'args' is everything after "log". Returns false on a usage error;
+    // 'reply' holds the text to show either way.
+    bool execute_log_command(std::string_view args, std::string& reply);
+
+} // namespace wave::engine::core::logging
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace wave::engine::core::logging::binlog
+{
+    // Binary structured log stream (.wlog)
+    // ------------------------------------
+    //
+    // All integers are LEB128 varints unless stated otherwise.
+    //
+    //   File header:
+    //     "WLOG"  u8 version
+    //     str     app name
+    //     varint  base time (ns since Unix epoch)
+    //
+    //   Records, each starting with a u8 RecordType:
+    //
+    //     SiteDefinition   varint site id, u8 level, u8 channel,
+    //                      varint line, str file, str format
+    //
+    //                      'format' is the call site's literal text with "{}"
+    //                      where a runtime argument goes ("{{" / "}}" escape braces).
+    //                      Written once per file, before the first Entry using it.
+    //
+    //     Entry            varint site id (0 = no call site, args hold the message)
+    //                      zigzag time delta in ns (vs. previous entry or base time)
+    //                      varint thread id
+    //                      u8     level
+    //                      varint packed args size, then packed args
+    //
+    //   Packed args: sequence of u8 ArgTag + payload:
+    //     Bool / Char  u8
+    //     Int          zigzag varint
+    //     UInt         varint
+    //     Float        f64, little endian
+    //     String       str
+    //     Pointer      varint
+    //
+    //   str = varint length + bytes.
+
+    inline constexpr char          kMagic[4] = { 'W', 'L', 'O', 'G' };
+    inline constexpr std::uint8_t  kVersion  = 2;
+
+    enum class RecordType : std::uint8_t
+    {
+        SiteDefinition = 1,
+        Entry          = 2
+    };
+
+    enum class ArgTag : std::uint8_t
+    {
+        Bool    = 1,
+        Char    = 2,
+        Int     = 3,
+        UInt    = 4,
+        Float   = 5,
+        String  = 6,
+        Pointer = 7
+    };
+
+    // Encoding ----------------------------------------------------------------
+
+    inline void put_u8(std::string& out, std::uint8_t v)
+    {
+        out.push_back(static_cast<char>(v));
+    }
+
+    inline void put_varint(std::string& out, std::uint64_t v)
+    {
+        while (v >= 0x80)
+        {
+            out.push_back(static_cast<char>((v & 0x7F) | 0x80));
+            v >>= 7;
+        }
+        out.push_back(static_cast<char>(v));
+    }
+
+    inline void put_zigzag(std::string& out, std::int64_t v)
+    {
+        put_varint(out, (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63));
+    }
+
+    inline void put_str(std::string& out, std::string_view s)
+    {
+        put_varint(out, s.size());
+        out.append(s.data(), s.size());
+    }
+
+    inline void put_f64(std::string& out, double v)
+    {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &v, sizeof(bits));
+        for (int i = 0; i < 8; ++i)
+        {
+            out.push_back(static_cast<char>((bits >> (i * 8)) & 0xFF));
+        }
+    }
+
+    // Call-site literal detection ---------------------------------------------
+    //
+    // String literals reach the variadic log functions as const char(&)[N].
+    // Those are interned into the call site's format instead of being packed
+    // into every entry. Runtime text (std::string, const char*, mutable char
+    // buffers) is packed as an argument.
+
+    template <typename T>
+    inline constexpr bool is_literal_v =
+        std::is_array_v<std::remove_reference_t<T>> &&
+        std::is_same_v<std::remove_extent_t<std::remove_reference_t<T>>, const char>;
+
+    template <std::size_t N>
+    inline std::string_view literal_view(const char (&text)[N])
+    {
+        // Literals carry their terminator; stop at the first NUL either way.
+        return std::string_view(text, std::char_traits<char>::length(text));
+    }
+
+    inline void append_escaped_literal(std::string& format, std::string_view text)
+    {
+        for (char c : text)
+        {
+            format.push_back(c);
+            if (c == '{' || c == '}')
+                format.push_back(c);
+        }
+    }
+
+    // Both helpers take the argument with its original (forwarded) type so a
+    // literal can be told apart from a mutable char buffer.
+
+    template <typename Arg>
+    void append_format_piece(std::string& format, Arg&& arg)
+    {
+        if constexpr (is_literal_v<Arg>)
+            append_escaped_literal(format, literal_view(arg));
+        else
+            format += "{}";
+    }
+
+    template <typename Arg>
+    void pack_arg(std::string& out, Arg&& arg)
+    {
+        using U = std::remove_cv_t<std::remove_reference_t<Arg>>;
+
+        if constexpr (is_literal_v<Arg>)
+        {
+            // Interned in the call site format.
+            (void)out;
+            (void)arg;
+        }
+        else if constexpr (std::is_same_v<U, bool>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::Bool));
+            put_u8(out, arg ? 1 : 0);
+        }
+        else if constexpr (std::is_same_v<U, char> || std::is_same_v<U, signed char> ||
+                           std::is_same_v<U, unsigned char>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::Char));
+            put_u8(out, static_cast<std::uint8_t>(arg));
+        }
+        else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::Int));
+            put_zigzag(out, static_cast<std::int64_t>(arg));
+        }
+        else if constexpr (std::is_integral_v<U>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::UInt));
+            put_varint(out, static_cast<std::uint64_t>(arg));
+        }
+        else if constexpr (std::is_floating_point_v<U>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::Float));
+            put_f64(out, static_cast<double>(arg));
+        }
+        else if constexpr (std::is_enum_v<U>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::Int));
+            put_zigzag(out, static_cast<std::int64_t>(arg));
+        }
+        else if constexpr (std::is_array_v<U> &&
+                           std::is_same_v<std::remove_cv_t<std::remove_extent_t<U>>, char>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::String));
+            put_str(out, std::string_view(arg));
+        }
+        else if constexpr (std::is_same_v<U, char*> || std::is_same_v<U, const char*>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::String));
+            put_str(out, arg ? std::string_view(arg) : std::string_view("(null)"));
+        }
+        else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::String));
+            put_str(out, std::string_view(arg));
+        }
+        else if constexpr (std::is_pointer_v<U>)
+        {
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::Pointer));
+            put_varint(out, static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(arg)));
+        }
+        else
+        {
+            // Anything else with an operator<< is packed as its text.
+            std::ostringstream oss;
+            oss << arg;
+            put_u8(out, static_cast<std::uint8_t>(ArgTag::String));
+            put_str(out, oss.str());
+        }
+    }
+
+} // namespace wave::engine::core::logging::binlog
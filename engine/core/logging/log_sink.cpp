@@ -0,0 +1,153 @@
+#include "engine/core/logging/log_sink.hpp"
+
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+
+namespace wave::engine::core::logging
+{
+    const char* level_to_string(LogLevel level) noexcept
+    {
+        switch (level)
+        {
+            case LogLevel::Trace:    return "TRACE";
+            case LogLevel::Debug:    return "DEBUG";
+            case LogLevel::Info:     return "INFO";
+            case LogLevel::Warn:     return "WARN";
+            case LogLevel::Error:    return "ERROR";
+            case LogLevel::Critical: return "CRITICAL";
+            case LogLevel::Off:      return "OFF";
+            default:                 return "UNKNOWN";
+        }
+    }
+
+    namespace
+    {
+        // Case-insensitive compare against a lowercase name.
+        bool equals_lower(std::string_view text, std::string_view name) noexcept
+        {
+            if (text.size() != name.size())
+                return false;
+
+            for (std::size_t i = 0; i < text.size(); ++i)
+            {
+                const char c = (text[i] >= 'A' && text[i] <= 'Z') ? static_cast<char>(text[i] - 'A' + 'a')
+                                                                   : text[i];
+                if (c != name[i])
+                    return false;
+            }
+            return true;
+        }
+    } // namespace
+
+    bool parse_log_level(std::string_view text, LogLevel& out) noexcept
+    {
+        auto equals = [text](std::string_view name)
+        {
+            return equals_lower(text, name);
+        };
+
+        if (equals("trace"))                         { out = LogLevel::Trace;    return true; }
+        if (equals("debug"))                         { out = LogLevel::Debug;    return true; }
+        if (equals("info"))                          { out = LogLevel::Info;     return true; }
+        if (equals("warn") || equals("warning"))     { out = LogLevel::Warn;     return true; }
+        if (equals("error"))                         { out = LogLevel::Error;    return true; }
+        if (equals("critical"))                      { out = LogLevel::Critical; return true; }
+        if (equals("off"))                           { out = LogLevel::Off;      return true; }
+
+        return false;
+    }
+
+    const char* channel_to_string(LogChannel channel) noexcept
+    {
+        switch (channel)
+        {
+            case LogChannel::General:    return "general";
+            case LogChannel::Runtime:    return "runtime";
+            case LogChannel::Render:     return "render";
+            case LogChannel::Resources:  return "resources";
+            case LogChannel::Assets:     return "assets";
+            case LogChannel::Filesystem: return "filesystem";
+            case LogChannel::Jobs:       return "jobs";
+            case LogChannel::Editor:     return "editor";
+            case LogChannel::Launcher:   return "launcher";
+            default:                     return "unknown";
+        }
+    }
+
+    bool parse_log_channel(std::string_view text, LogChannel& out) noexcept
+    {
+        for (std::uint8_t i = 0; i < static_cast<std::uint8_t>(LogChannel::Count); ++i)
+        {
+            const auto channel = static_cast<LogChannel>(i);
+            if (equals_lower(text, channel_to_string(channel)))
+            {
+                out = channel;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void format_log_line(const LogRecord& record, std::string& out)
+    {
+        // Timestamp in local time [HH:MM:SS]
+        const auto now_t = std::chrono::system_clock::to_time_t(record.time);
+        std::tm    tm_buf{};
+
+#if defined(_WIN32)
+        localtime_s(&tm_buf, &now_t);
+#else
+        localtime_r(&now_t, &tm_buf);
+#endif
+
+        char stamp[16];
+        const int stamp_len = std::snprintf(stamp, sizeof(stamp), "[%02d:%02d:%02d]",
+                                            tm_buf.tm_hour, tm_buf.tm_min, tm_buf.tm_sec);
+
+        out.append(stamp, static_cast<std::size_t>(stamp_len > 0 ? stamp_len : 0));
+
+        if (!record.app_name.empty())
+        {
+            out += '[';
+            out += record.app_name;
+            out += ']';
+        }
+
+        out += '[';
+        out += level_to_string(record.level);
+        out += "] ";
+
+        if (record.channel != LogChannel::General)
+        {
+            out += '[';
+            out += channel_to_string(record.channel);
+            out += "] ";
+        }
+
+        out += record.message;
+        out += '\n';
+    }
+
+    void TerminalLogSink::write(const LogRecord& record)
+    {
+        m_line.clear();
+        format_log_line(record, m_line);
+
+        std::ostream& out =
+            (record.level == LogLevel::Error || record.level == LogLevel::Critical)
+                ? static_cast<std::ostream&>(std::cerr)
+                : static_cast<std::ostream&>(std::clog);
+
+        out.write(m_line.data(), static_cast<std::streamsize>(m_line.size()));
+        out.flush();
+    }
+
+    void TerminalLogSink::flush()
+    {
+        std::clog.flush();
+        std::cerr.flush();
+    }
+
+} // namespace wave::engine::core::logging
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "engine/core/logging/log.hpp"
+
+namespace wave::engine::core::logging
+{
+    // One log entry as handed to sinks.
+    // The views are only valid for the duration of LogSink::write().
+    struct LogRecord
+    {
+        LogLevel                              level   = LogLevel::Info;
+        LogChannel                            channel = LogChannel::General;
+        std::chrono::system_clock::time_point time;
+        std::string_view                      app_name;
+        std::uint32_t                         thread_id = 0;
+
+        // Formatted text; empty when no installed sink wants text.
+        std::string_view                      message;
+
+        // Structured form (see log_format.hpp); only filled in while a sink
+        // with wants_structured() is installed. 'site' is null for calls that
+        // did not go through a WAVE_LOG_* macro.
+        const LogSiteInfo*                    site = nullptr;
+        std::string_view                      packed_args;
+    };
+
+    // Output target for the Logger (terminal, file, editor console, ...).
+    //
+    // The Logger calls sinks with its lock held, one record at a time, so
+    // write() and flush() never run concurrently for the same sink.
+    // Sinks must not log themselves from inside write().
+    class LogSink
+    {
+    public:
+        virtual ~LogSink() = default;
+
+        virtual void write(const LogRecord& record) = 0;
+        virtual void flush() {}
+
+        // Called once per frame through Logger::poll(). Sinks that flush on
+        // a timer check their interval here so buffered output does not sit
+        // unwritten while nothing is being logged.
+        virtual void poll() {}
+
+        // What this sink consumes. Checked when the sink is added.
+        [[nodiscard]] virtual bool wants_text() const { return true; }
+        [[nodiscard]] virtual bool wants_structured() const { return false; }
+    };
+
+    // "TRACE", "DEBUG", ...
+    [[nodiscard]] const char* level_to_string(LogLevel level) noexcept;
+
+    // Case-insensitive inverse of level_to_string ("warning" is accepted too).
+    [[nodiscard]] bool parse_log_level(std::string_view text, LogLevel& out) noexcept;
+
+    // "general", "render", ... (lowercase, used in config keys and output).
+    [[nodiscard]] const char* channel_to_string(LogChannel channel) noexcept;
+    [[nodiscard]] bool parse_log_channel(std::string_view text, LogChannel& out) noexcept;
+
+    // Append "[HH:MM:SS][app][LEVEL] [channel] message\n" to 'out'.
+    // The channel tag is left out for LogChannel::General.
+    void format_log_line(const LogRecord& record, std::string& out);
+
+    // Writes Info and below to std::clog, Error / Critical to std::cerr.
+    // Installed by default so tools that never call Logger::init still log.
+    class TerminalLogSink final : public LogSink
+    {
+    public:
+        void write(const LogRecord& record) override;
+        void flush() override;
+
+    private:
+        std::string m_line;
+    };
+
+} // namespace wave::engine::core::logging
@@ -0,0 +1,395 @@
+#include "engine/core/logging/rotating_file_writer.hpp"
+
+#include "engine/core/jobs/job_system.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+#if defined(WAVE_HAS_ZLIB) && WAVE_HAS_ZLIB
+    #include <zlib.h>
+#endif
+
+namespace wave::engine::core::logging
+{
+    namespace
+    {
+        // Note: nothing in here may use WAVE_LOG_*; the writer runs inside a
+        // sink, i.e. with the logger lock held.
+
+        std::size_t round_up(std::size_t value, std::size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        std::string timestamp_suffix()
+        {
+            const auto now_t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+            std::tm    tm_buf{};
+
+#if defined(_WIN32)
+            localtime_s(&tm_buf, &now_t);
+#else
+            localtime_r(&now_t, &tm_buf);
+#endif
+
+            char buf[32];
+            std::strftime(buf, sizeof(buf), "%Y%m%d-%H%M%S", &tm_buf);
+            return buf;
+        }
+
+        // Whether 'name' is one of our rotated files, i.e. exactly
+        // <base>-<YYYYMMDD-HHMMSS>[-<n>]<ext>[.gz] as written by archive_active().
+        // Other files that merely share the prefix (say "wave-editor-..."
+        // next to "wave-...") belong to someone else.
+        bool is_rotated_name(std::string_view name, std::string_view base, std::string_view ext)
+        {
+            if (!name.starts_with(base) || name.size() <= base.size() || name[base.size()] != '-')
+                return false;
+            name.remove_prefix(base.size() + 1);
+
+            if (name.ends_with(".gz"))
+                name.remove_suffix(3);
+            if (!name.ends_with(ext))
+                return false;
+            name.remove_suffix(ext.size());
+
+            auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+            auto digits   = [&is_digit](std::string_view s)
+            {
+                return !s.empty() && std::all_of(s.begin(), s.end(), is_digit);
+            };
+
+            // "YYYYMMDD-HHMMSS" is 15 characters.
+            if (name.size() < 15 || !digits(name.substr(0, 8)) || name[8] != '-' || !digits(name.substr(9, 6)))
+                return false;
+            name.remove_prefix(15);
+
+            return name.empty() || (name.front() == '-' && digits(name.substr(1)));
+        }
+
+#if defined(WAVE_HAS_ZLIB) && WAVE_HAS_ZLIB
+        // Runs on a JobSystem worker: <path> -> <path>.gz, original removed on success.
+        void gzip_file(const fs::path& path)
+        {
+            std::FILE* in = std::fopen(path.string().c_str(), "rb");
+            if (!in)
+                return;
+
+            fs::path tmp_path = path;
+            tmp_path += ".gz.tmp";
+
+            gzFile out = gzopen(tmp_path.string().c_str(), "wb6");
+            if (!out)
+            {
+                std::fclose(in);
+                return;
+            }
+
+            std::vector<char> chunk(256u << 10);
+            bool ok = true;
+
+            for (;;)
+            {
+                const std::size_t n = std::fread(chunk.data(), 1, chunk.size(), in);
+                if (n == 0)
+                    break;
+
+                if (gzwrite(out, chunk.data(), static_cast<unsigned>(n)) != static_cast<int>(n))
+                {
+                    ok = false;
+                    break;
+                }
+            }
+
+            ok = (std::ferror(in) == 0) && ok;
+            std::fclose(in);
+            ok = (gzclose(out) == Z_OK) && ok;
+
+            std::error_code ec;
+            if (!ok)
+            {
+                fs::remove(tmp_path, ec);
+                return;
+            }
+
+            fs::path gz_path = path;
+            gz_path += ".gz";
+
+            fs::rename(tmp_path, gz_path, ec);
+            if (!ec)
+            {
+                fs::remove(path, ec);
+            }
+        }
+#endif
+    } // namespace
+
+    RotatingFileWriter::RotatingFileWriter(RotatingFileConfig config)
+        : m_config(std::move(config))
+    {
+        m_capacity = round_up(std::max<std::size_t>(m_config.buffer_size, kWriteAlignment), kWriteAlignment);
+        m_buffer.reset(static_cast<char*>(
+            ::operator new[](m_capacity, std::align_val_t{kWriteAlignment})));
+
+        m_activePath = m_config.directory / (m_config.base_name + m_config.extension);
+    }
+
+    RotatingFileWriter::~RotatingFileWriter()
+    {
+        close();
+    }
+
+    bool RotatingFileWriter::open()
+    {
+        if (m_file)
+            return true;
+
+        std::error_code ec;
+        fs::create_directories(m_config.directory, ec);
+        if (ec)
+        {
+            std::cerr << "[logging] Cannot create log directory " << m_config.directory.string()
+                      << ": " << ec.message() << "\n";
+            return false;
+        }
+
+        // Each session starts with a fresh active file.
+        if (fs::exists(m_activePath, ec) && fs::file_size(m_activePath, ec) > 0 && !ec)
+        {
+            fs::path archived = archive_active();
+            if (!archived.empty())
+            {
+                compress_async(std::move(archived));
+            }
+            enforce_retention();
+        }
+
+        return open_active();
+    }
+
+    void RotatingFileWriter::close()
+    {
+        if (!m_file)
+            return;
+
+        write_buffer();
+        std::fclose(m_file);
+        m_file = nullptr;
+    }
+
+    bool RotatingFileWriter::open_active()
+    {
+        m_file = std::fopen(m_activePath.string().c_str(), "ab");
+        if (!m_file)
+        {
+            std::cerr << "[logging] Cannot open log file " << m_activePath.string() << "\n";
+            return false;
+        }
+
+        // We do our own (much larger) buffering.
+        std::setvbuf(m_file, nullptr, _IONBF, 0);
+
+        std::error_code ec;
+        const auto existing = fs::file_size(m_activePath, ec);
+        m_fileSize = ec ? 0 : existing;
+        m_openedAt = std::chrono::steady_clock::now();
+
+        if (m_onOpen)
+        {
+            m_inOpenCallback = true;
+            m_onOpen(*this);
+            m_inOpenCallback = false;
+        }
+
+        return true;
+    }
+
+    void RotatingFileWriter::append(std::string_view bytes)
+    {
+        if (!m_file || bytes.empty())
+            return;
+
+        if (!m_inOpenCallback && should_rotate(bytes.size()))
+        {
+            rotate();
+        }
+
+        append_unchecked(bytes);
+    }
+
+    void RotatingFileWriter::append_unchecked(std::string_view bytes)
+    {
+        if (!m_file || bytes.empty())
+            return;
+
+        while (!bytes.empty())
+        {
+            // Records larger than the whole buffer skip the copy.
+            if (m_used == 0 && bytes.size() >= m_capacity)
+            {
+                const std::size_t written = std::fwrite(bytes.data(), 1, bytes.size(), m_file);
+                m_fileSize += written;
+                return;
+            }
+
+            const std::size_t n = std::min(bytes.size(), m_capacity - m_used);
+            std::memcpy(m_buffer.get() + m_used, bytes.data(), n);
+            m_used += n;
+            bytes.remove_prefix(n);
+
+            if (m_used == m_capacity)
+            {
+                write_buffer();
+            }
+        }
+    }
+
+    void RotatingFileWriter::flush()
+    {
+        write_buffer();
+    }
+
+    void RotatingFileWriter::write_buffer()
+    {
+        if (!m_file || m_used == 0)
+            return;
+
+        const std::size_t written = std::fwrite(m_buffer.get(), 1, m_used, m_file);
+        m_fileSize += written;
+        m_used = 0;
+    }
+
+    bool RotatingFileWriter::should_rotate(std::size_t incoming) const
+    {
+        const std::uint64_t current = active_size();
+        if (current == 0)
+            return false;
+
+        if (m_config.max_file_size > 0 && current + incoming > m_config.max_file_size)
+            return true;
+
+        if (m_config.max_file_age.count() > 0 &&
+            std::chrono::steady_clock::now() - m_openedAt >= m_config.max_file_age)
+            return true;
+
+        return false;
+    }
+
+    void RotatingFileWriter::rotate()
+    {
+        if (!m_file)
+            return;
+
+        close();
+
+        fs::path archived = archive_active();
+        open_active();
+
+        if (!archived.empty())
+        {
+            compress_async(std::move(archived));
+        }
+
+        enforce_retention();
+    }
+
+    fs::path RotatingFileWriter::archive_active()
+    {
+        const std::string stem = m_config.base_name + "-" + timestamp_suffix();
+
+        fs::path target = m_config.directory / (stem + m_config.extension);
+        std::error_code ec;
+
+        // A previous rotation in the same second may already be compressed.
+        auto taken = [&ec](const fs::path& p)
+        {
+            fs::path gz = p;
+            gz += ".gz";
+            return fs::exists(p, ec) || fs::exists(gz, ec);
+        };
+
+        for (int n = 1; taken(target); ++n)
+        {
+            target = m_config.directory / (stem + "-" + std::to_string(n) + m_config.extension);
+        }
+
+        fs::rename(m_activePath, target, ec);
+        if (ec)
+        {
+            std::cerr << "[logging] Cannot rotate log file " << m_activePath.string()
+                      << ": " << ec.message() << "\n";
+            return {};
+        }
+
+        return target;
+    }
+
+    void RotatingFileWriter::enforce_retention()
+    {
+        if (m_config.max_rotated_files == 0)
+            return;
+
+        struct Rotated
+        {
+            fs::file_time_type time;
+            fs::path           path;
+        };
+
+        std::vector<Rotated> rotated;
+        std::error_code ec;
+
+        for (fs::directory_iterator it(m_config.directory, ec), end; it != end && !ec; it.increment(ec))
+        {
+            const std::string name = it->path().filename().string();
+            if (is_rotated_name(name, m_config.base_name, m_config.extension))
+            {
+                std::error_code time_ec;
+                rotated.push_back({ it->last_write_time(time_ec), it->path() });
+            }
+        }
+
+        if (rotated.size() <= m_config.max_rotated_files)
+            return;
+
+        std::sort(rotated.begin(), rotated.end(), [](const Rotated& a, const Rotated& b)
+        {
+            return a.time != b.time ? a.time < b.time : a.path < b.path;
+        });
+
+        const std::size_t excess = rotated.size() - m_config.max_rotated_files;
+        for (std::size_t i = 0; i < excess; ++i)
+        {
+            fs::remove(rotated[i].path, ec);
+        }
+    }
+
+    void RotatingFileWriter::compress_async(fs::path path)
+    {
+        if (!m_config.compress_rotated)
+            return;
+
+#if defined(WAVE_HAS_ZLIB) && WAVE_HAS_ZLIB
+        if (!m_config.job_system || !m_config.job_system->is_initialized())
+            return;
+
+        m_config.job_system->submit([path = std::move(path)]()
+        {
+            gzip_file(path);
+        });
+#else
+        (void)path;
+
+        static bool s_warned = false;
+        if (!s_warned)
+        {
+            s_warned = true;
+            std::cerr << "[logging] Log compression requested but this build has no zlib "
+                         "(WAVE_HAS_ZLIB); rotated logs stay uncompressed.\n";
+        }
+#endif
+    }
+
+} // namespace wave::engine::core::logging
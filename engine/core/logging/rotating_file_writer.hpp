@@ -0,0 +1,138 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+
+namespace wave::engine::core::jobs
+{
+    class JobSystem;
+}
+
+namespace wave::engine::core::logging
+{
+    namespace fs = std::filesystem;
+
+    struct RotatingFileConfig
+    {
+        // Output directory, usually Environment::logs_path().
+        fs::path      directory;
+
+        // Active file is <directory>/<base_name><extension>.
+        // Rotated files become <base_name>-YYYYMMDD-HHMMSS[-N]<extension>.
+        std::string   base_name = "wave";
+        std::string   extension = ".log";
+
+        // Size of the in-memory write buffer. Rounded up to kWriteAlignment.
+        std::size_t   buffer_size = 1u << 20;
+
+        // Rotate when the active file would grow beyond this (0 = never).
+        std::uint64_t max_file_size = 256ull << 20;
+
+        // Rotate when the active file is older than this (0 = never).
+        std::chrono::seconds max_file_age{std::chrono::hours(24)};
+
+        // Rotated files kept on disk; oldest are deleted first (0 = keep all).
+        std::uint32_t max_rotated_files = 16;
+
+        // gzip rotated files on a JobSystem worker.
+        // Requires job_system and a build with WAVE_HAS_ZLIB; ignored otherwise.
+        bool              compress_rotated = false;
+        jobs::JobSystem*  job_system       = nullptr;
+    };
+
+    // Append-only log file with a large aligned write buffer and rotation.
+    //
+    // Bytes are collected in memory and handed to the OS in whole-buffer
+    // writes, so a busy logger costs one write syscall per buffer_size bytes
+    // instead of one per line.
+    //
+    // Not thread safe; the owning sink serializes access (the Logger already
+    // calls sinks under its lock).
+    class RotatingFileWriter
+    {
+    public:
+        static constexpr std::size_t kWriteAlignment = 4096;
+
+        // Called right after a new file was opened (initial open and after
+        // every rotation), e.g. to write a format header.
+        using OpenCallback = std::function<void(RotatingFileWriter&)>;
+
+        explicit RotatingFileWriter(RotatingFileConfig config);
+        ~RotatingFileWriter();
+
+        RotatingFileWriter(const RotatingFileWriter&)            = delete;
+        RotatingFileWriter& operator=(const RotatingFileWriter&) = delete;
+
+        // Create the directory and open the active file. A non-empty file left
+        // by a previous session is rotated away first.
+        bool open();
+        void close();
+
+        [[nodiscard]] bool is_open() const noexcept { return m_file != nullptr; }
+
+        void set_open_callback(OpenCallback callback) { m_onOpen = std::move(callback); }
+
+        // Buffer bytes; rotates first if this append would cross a limit.
+        void append(std::string_view bytes);
+
+        // Buffer bytes without checking the limits, for callers that rotate
+        // themselves (should_rotate() + rotate()) because what they write
+        // depends on per-file state. A single oversized record still lands
+        // in one file.
+        void append_unchecked(std::string_view bytes);
+
+        // Hand buffered bytes to the OS.
+        void flush();
+
+        // Would appending 'incoming' bytes now trigger a rotation.
+        // Lets callers rotate before composing a record that depends on
+        // per-file state (e.g. definitions written once per file).
+        [[nodiscard]] bool should_rotate(std::size_t incoming) const;
+
+        // Close the active file, rename it with a timestamp and start a new one.
+        void rotate();
+
+        [[nodiscard]] const fs::path&           active_path() const noexcept { return m_activePath; }
+        [[nodiscard]] std::uint64_t             active_size() const noexcept { return m_fileSize + m_used; }
+        [[nodiscard]] const RotatingFileConfig& config() const noexcept { return m_config; }
+
+    private:
+        struct AlignedDelete
+        {
+            void operator()(char* p) const noexcept
+            {
+                ::operator delete[](p, std::align_val_t{kWriteAlignment});
+            }
+        };
+
+        bool     open_active();
+        void     write_buffer();
+        fs::path archive_active();
+        void     enforce_retention();
+        void     compress_async(fs::path path);
+
+    private:
+        RotatingFileConfig m_config;
+        fs::path           m_activePath;
+
+        std::FILE*         m_file     = nullptr;
+        std::uint64_t      m_fileSize = 0;
+        std::chrono::steady_clock::time_point m_openedAt{};
+
+        std::unique_ptr<char[], AlignedDelete> m_buffer;
+        std::size_t        m_capacity = 0;
+        std::size_t        m_used     = 0;
+
+        OpenCallback       m_onOpen;
+        bool               m_inOpenCallback = false;
+    };
+
+} // namespace wave::engine::core::logging
@@ -0,0 +1,230 @@
+#include "engine/core/resources/resource_cache.hpp"
+
+#include "engine/core/filesystem/pak_format.hpp"
+#include "engine/core/resources/resource_system.hpp"
+#include "engine/core/utils/hash.hpp"
+
+namespace wave::engine::core::resources
+{
+    ResourceCache::ResourceCache(std::size_t budgetBytes, Loader loader)
+        : m_loader(std::move(loader))
+        , m_budget(budgetBytes)
+    {
+        if (!m_loader)
+        {
+            m_loader = [](std::string_view relative, MappedFile& out)
+            {
+                return ResourceSystem::map_binary(relative, out);
+            };
+        }
+    }
+
+    ResourceHandle ResourceCache::acquire(std::string_view relative)
+    {
+        std::string         path = filesystem::normalize_pak_path(relative);
+        const std::uint64_t hash = utils::fnv1a_64(path);
+
+        auto load = [this, &path]() -> ResourceHandle
+        {
+            auto blob = std::make_shared<ResourceBlob>();
+            blob->m_path = path;
+
+            if (!m_loader(path, blob->m_file))
+                return nullptr;
+
+            return blob;
+        };
+
+        std::promise<ResourceHandle> promise;
+        std::uint64_t                serial = 0;
+        {
+            std::unique_lock lock(m_mutex);
+
+            if (auto it = m_entries.find(hash); it != m_entries.end())
+            {
+                if (it->second.path != path)
+                {
+                    // Two paths with one hash: serve the newcomer uncached.
+                    lock.unlock();
+                    return load();
+                }
+
+                ++m_stats.hits;
+                touch(it->second);
+                return it->second.blob;
+            }
+
+            if (auto it = m_pending.find(hash); it != m_pending.end())
+            {
+                if (it->second.path != path)
+                {
+                    lock.unlock();
+                    return load();
+                }
+
+                ++m_stats.shared_loads;
+                auto result = it->second.result;
+                lock.unlock();
+                return result.get();
+            }
+
+            ++m_stats.misses;
+            serial = ++m_loadSerial;
+            m_pending.emplace(hash, PendingLoad{ path, promise.get_future().share(), serial });
+        }
+
+        ResourceHandle handle;
+        try
+        {
+            handle = load();
+        }
+        catch (...)
+        {
+            {
+                std::scoped_lock lock(m_mutex);
+                if (auto it = m_pending.find(hash); it != m_pending.end() && it->second.serial == serial)
+                    m_pending.erase(it);
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        {
+            std::scoped_lock lock(m_mutex);
+
+            // invalidate() during the load drops the pending record; the
+            // result still goes to the waiters but is not cached.
+            auto it = m_pending.find(hash);
+            const bool current = it != m_pending.end() && it->second.serial == serial;
+            if (current)
+                m_pending.erase(it);
+
+            if (!handle)
+            {
+                ++m_stats.load_failures;
+            }
+            else if (current)
+            {
+                m_lru.push_front(hash);
+                m_entries.emplace(hash, Entry{ std::move(path), handle, m_lru.begin() });
+                m_resident += handle->size();
+                evict_to_budget();
+            }
+        }
+
+        promise.set_value(handle);
+        return handle;
+    }
+
+    ResourceHandle ResourceCache::find(std::string_view relative) const
+    {
+        const std::string   path = filesystem::normalize_pak_path(relative);
+        const std::uint64_t hash = utils::fnv1a_64(path);
+
+        std::scoped_lock lock(m_mutex);
+
+        const auto it = m_entries.find(hash);
+        if (it == m_entries.end() || it->second.path != path)
+            return nullptr;
+
+        return it->second.blob;
+    }
+
+    void ResourceCache::invalidate(std::string_view relative)
+    {
+        const std::string   path = filesystem::normalize_pak_path(relative);
+        const std::uint64_t hash = utils::fnv1a_64(path);
+
+        std::scoped_lock lock(m_mutex);
+
+        if (auto it = m_entries.find(hash); it != m_entries.end() && it->second.path == path)
+            erase(it);
+
+        if (auto it = m_pending.find(hash); it != m_pending.end() && it->second.path == path)
+            m_pending.erase(it);
+    }
+
+    void ResourceCache::invalidate_all()
+    {
+        std::scoped_lock lock(m_mutex);
+
+        m_entries.clear();
+        m_lru.clear();
+        m_pending.clear();
+        m_resident = 0;
+    }
+
+    void ResourceCache::clear_unused()
+    {
+        std::scoped_lock lock(m_mutex);
+
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            auto next = std::next(it);
+            if (it->second.blob.use_count() == 1)
+            {
+                erase(it);
+                ++m_stats.evictions;
+            }
+            it = next;
+        }
+    }
+
+    void ResourceCache::set_budget(std::size_t budgetBytes)
+    {
+        std::scoped_lock lock(m_mutex);
+
+        m_budget = budgetBytes;
+        evict_to_budget();
+    }
+
+    std::size_t ResourceCache::budget() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_budget;
+    }
+
+    ResourceCacheStats ResourceCache::stats() const
+    {
+        std::scoped_lock lock(m_mutex);
+
+        ResourceCacheStats stats = m_stats;
+        stats.entries        = m_entries.size();
+        stats.resident_bytes = m_resident;
+        stats.budget_bytes   = m_budget;
+        return stats;
+    }
+
+    void ResourceCache::touch(Entry& entry)
+    {
+        m_lru.splice(m_lru.begin(), m_lru, entry.lruPos);
+    }
+
+    void ResourceCache::erase(std::unordered_map<std::uint64_t, Entry>::iterator it)
+    {
+        m_resident -= it->second.blob->size();
+        m_lru.erase(it->second.lruPos);
+        m_entries.erase(it);
+    }
+
+    void ResourceCache::evict_to_budget()
+    {
+        // Caller holds m_mutex. New handles are only handed out under the
+        // same lock, so use_count() == 1 reliably means "cache only".
+        auto pos = m_lru.end();
+        while (m_resident > m_budget && pos != m_lru.begin())
+        {
+            --pos;
+
+            auto it = m_entries.find(*pos);
+            if (it->second.blob.use_count() > 1)
+                continue;
+
+            m_resident -= it->second.blob->size();
+            m_entries.erase(it);
+            pos = m_lru.erase(pos);
+            ++m_stats.evictions;
+        }
+    }
+
+} // namespace wave::engine::core::resources
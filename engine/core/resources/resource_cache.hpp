@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "engine/core/filesystem/mapped_file.hpp"
+
+namespace wave::engine::core::resources
+{
+    using filesystem::MappedFile;
+
+    // Immutable bytes of one resource, shared by everyone who acquired it.
+    class ResourceBlob
+    {
+    public:
+        [[nodiscard]] const std::string&            path() const noexcept { return m_path; }
+        [[nodiscard]] std::span<const std::uint8_t> bytes() const noexcept { return m_file.bytes(); }
+        [[nodiscard]] std::string_view              text() const noexcept { return m_file.text(); }
+        [[nodiscard]] const std::uint8_t*           data() const noexcept { return m_file.data(); }
+        [[nodiscard]] std::size_t                   size() const noexcept { return m_file.size(); }
+
+    private:
+        friend class ResourceCache;
+
+        std::string m_path;
+        MappedFile  m_file;
+    };
+
+    // Ref-counted handle. The data stays alive while any handle exists,
+    // even if the cache evicts or invalidates the entry meanwhile.
+    using ResourceHandle = std::shared_ptr<const ResourceBlob>;
+
+    struct ResourceCacheStats
+    {
+        std::uint64_t hits          = 0;
+        std::uint64_t misses        = 0;   // loads started
+        std::uint64_t shared_loads  = 0;   // waited on a load already in flight
+        std::uint64_t load_failures = 0;
+        std::uint64_t evictions     = 0;
+
+        std::size_t   entries        = 0;
+        std::size_t   resident_bytes = 0;
+        std::size_t   budget_bytes   = 0;
+    };
+
+    // Path-keyed cache of resource bytes.
+    //
+    // acquire() returns the cached blob when present, otherwise loads it
+    // (through ResourceSystem::map_binary by default, so archive entries stay
+    // zero-copy). Concurrent acquire() calls for the same path share a single
+    // load.
+    //
+    // Entries nobody holds a handle to are evicted least-recently-used first
+    // whenever resident bytes exceed the budget. Referenced entries count
+    // against the budget but are never evicted, so the budget is a target,
+    // not a hard cap.
+    //
+    // Thread safe.
+    class ResourceCache
+    {
+    public:
+        static constexpr std::size_t kDefaultBudget = 256u << 20;
+
+        // Fills 'out' for a resource path; returns false on failure.
+        using Loader = std::function<bool(std::string_view relative, MappedFile& out)>;
+
+        explicit ResourceCache(std::size_t budgetBytes = kDefaultBudget, Loader loader = {});
+
+        ResourceCache(const ResourceCache&)            = delete;
+        ResourceCache& operator=(const ResourceCache&) = delete;
+
+        // Cached or freshly loaded resource; nullptr if loading failed.
+        ResourceHandle acquire(std::string_view relative);
+
+        // Cached resource only; never loads and does not touch the stats.
+        [[nodiscard]] ResourceHandle find(std::string_view relative) const;
+
+        // Forget a path (e.g. the file changed on disk). Existing handles
+        // keep the old data; the next acquire() reloads.
+        void invalidate(std::string_view relative);
+
+        // invalidate() every path, e.g. after the mount table changed and
+        // any path may now resolve to different bytes.
+        void invalidate_all();
+
+        // Drop every unreferenced entry.
+        void clear_unused();
+
+        void set_budget(std::size_t budgetBytes);
+        [[nodiscard]] std::size_t budget() const;
+
+        [[nodiscard]] ResourceCacheStats stats() const;
+
+    private:
+        struct Entry
+        {
+            std::string                         path;
+            std::shared_ptr<const ResourceBlob> blob;
+            std::list<std::uint64_t>::iterator  lruPos;
+        };
+
+        struct PendingLoad
+        {
+            std::string                        path;
+            std::shared_future<ResourceHandle> result;
+            std::uint64_t                      serial = 0;
+        };
+
+        void touch(Entry& entry);
+        void erase(std::unordered_map<std::uint64_t, Entry>::iterator it);
+        void evict_to_budget();
+
+    private:
+        Loader             m_loader;
+        mutable std::mutex m_mutex;
+
+        std::unordered_map<std::uint64_t, Entry>       m_entries;  // key: path hash
+        std::unordered_map<std::uint64_t, PendingLoad> m_pending;
+        std::list<std::uint64_t>                       m_lru;      // front = most recently used
+
+        std::uint64_t      m_loadSerial = 0;
+        std::size_t        m_budget     = kDefaultBudget;
+        std::size_t        m_resident   = 0;
+        ResourceCacheStats m_stats;
+    };
+
+} // namespace wave::engine::core::resources
@@ -2,9 +2,11 @@
 
 #include "engine/core/runtime/runtime.hpp"
 #include "engine/core/environment/environment.hpp"
-#include "engine/core/filesystem/filesystem.hpp"
+#include "engine/core/filesystem/file_system.hpp"
 #include "engine/core/logging/log.hpp"
 
+#include <algorithm>
+
 namespace wave::engine::core::resources
 {
     using wave::engine::core::runtime::environment;
@@ -12,8 +14,26 @@ namespace wave::engine::core::resources
     using wave::engine::core::filesystem::read_binary_file;
     using wave::engine::core::logging::Logger;
 
-    bool     ResourceSystem::s_initialized = false;
-    fs::path ResourceSystem::s_resourceRoot;
+    namespace
+    {
+        // Only consulted after a failed open, so the success path does not
+        // pay for an extra stat() per load.
+        const char* describe_failure(const fs::path& path)
+        {
+            std::error_code ec;
+            return fs::exists(path, ec) ? "Failed to read" : "Not found:";
+        }
+
+        // Loose files sit below every archive.
+        constexpr int kLoosePriority   = 0;
+        constexpr int kArchivePriority = 100;
+    } // namespace
+
+    bool              ResourceSystem::s_initialized = false;
+    fs::path          ResourceSystem::s_resourceRoot;
+    VirtualFileSystem ResourceSystem::s_vfs;
+    ResourceCache     ResourceSystem::s_cache;
+    int               ResourceSystem::s_nextArchivePriority = kArchivePriority;
 
     void ResourceSystem::initialize()
     {
@@ -24,24 +44,54 @@ namespace wave::engine::core::resources
         const auto& env = environment();
 
         // Convention: resources live under <engine_root>/resources
-        // If your Environment exposes a specific helper, you can swap this:
-        //
-        //   s_resourceRoot = env.resources_path();
-        //
-        s_resourceRoot = env.root_path() / "resources";
+        s_resourceRoot = env.resources_path();
 
-        if (!fs::exists(s_resourceRoot))
+        s_initialized = true;
+
+        if (s_vfs.mount_directory("", s_resourceRoot, kLoosePriority))
         {
-            // Not fatal for now, but we log it. Some tools might still run
-            // without resources (e.g. headless tests).
-            WAVE_LOG_WARN("[resources] Resource root does not exist: ", s_resourceRoot.string());
+            WAVE_LOG_CH_INFO(Resources, "Resource root: ", s_resourceRoot.string());
         }
-        else
+
+        // Shipping builds pack resources into <engine_root>/*.wpak. Mount in
+        // name order so later archives (patches) override earlier ones.
+        std::vector<fs::path> archives;
+        std::error_code ec;
+        for (fs::directory_iterator it(env.engine_root(), ec), end; it != end && !ec; it.increment(ec))
         {
-            WAVE_LOG_INFO("[resources] Resource root: ", s_resourceRoot.string());
+            if (it->path().extension() == ".wpak" && it->is_regular_file(ec))
+                archives.push_back(it->path());
         }
 
-        s_initialized = true;
+        std::sort(archives.begin(), archives.end());
+        for (const auto& archive : archives)
+        {
+            mount_archive(archive);
+        }
+
+        if (s_vfs.mounts().empty())
+        {
+            // Not fatal for now, but we log it. Some tools might still run
+            // without resources (e.g. headless tests).
+            WAVE_LOG_CH_WARN(Resources, "Resource root does not exist: ", s_resourceRoot.string());
+        }
+    }
+
+    void ResourceSystem::shutdown()
+    {
+        if (!s_initialized)
+            return;
+
+        const auto stats = s_cache.stats();
+        WAVE_LOG_CH_INFO(Resources, "Resource cache: ", stats.hits, " hits, ", stats.misses, " misses, ",
+                         stats.shared_loads, " shared loads, ", stats.evictions, " evictions, ",
+                         stats.resident_bytes >> 10, " KiB resident");
+
+        s_cache.clear_unused();
+        unmount_all();
+
+        s_resourceRoot.clear();
+        s_initialized = false;
     }
 
     const fs::path& ResourceSystem::resource_root()
@@ -52,6 +102,14 @@ namespace wave::engine::core::resources
         return s_resourceRoot;
     }
 
+    VirtualFileSystem& ResourceSystem::vfs()
+    {
+        if (!s_initialized)
+            initialize();
+
+        return s_vfs;
+    }
+
     fs::path ResourceSystem::resolve(std::string_view relative)
     {
         if (!s_initialized)
@@ -61,19 +119,69 @@ namespace wave::engine::core::resources
         return s_resourceRoot / rel;
     }
 
-    bool ResourceSystem::load_text(std::string_view relative, std::string& out)
+    bool ResourceSystem::mount_archive(const fs::path& path)
     {
-        auto path = resolve(relative);
+        if (!s_initialized)
+            initialize();
 
-        if (!fs::exists(path))
+        // Later mounts win over earlier ones.
+        std::string error;
+        if (!s_vfs.mount_archive("", path, s_nextArchivePriority, &error))
         {
-            WAVE_LOG_ERROR("[resources] Text resource not found: ", path.string());
+            WAVE_LOG_CH_ERROR(Resources, "Cannot mount archive ", path.string(), ": ", error);
             return false;
         }
 
+        ++s_nextArchivePriority;
+
+        // Paths the archive overrides may be cached with the old bytes.
+        s_cache.invalidate_all();
+
+        WAVE_LOG_CH_INFO(Resources, "Mounted archive ", path.string(), " (", s_vfs.file_count(), " resources visible)");
+        return true;
+    }
+
+    void ResourceSystem::unmount_all()
+    {
+        // Outstanding handles keep their archive mapped (see MappedFile::borrow).
+        s_vfs.unmount_all();
+        s_cache.invalidate_all();
+        s_nextArchivePriority = kArchivePriority;
+    }
+
+    std::size_t ResourceSystem::mounted_archive_count()
+    {
+        const auto mounts = s_vfs.mounts();
+        return static_cast<std::size_t>(std::count_if(mounts.begin(), mounts.end(), [](const auto& mount)
+        {
+            return mount.archive;
+        }));
+    }
+
+    bool ResourceSystem::exists(std::string_view relative)
+    {
+        return vfs().exists(relative);
+    }
+
+    bool ResourceSystem::exists(const filesystem::VfsPath& path)
+    {
+        return vfs().exists(path);
+    }
+
+    // Loads go through the VFS index first. A miss falls back to the loose
+    // path so files created after startup (editor, hot reload) still load
+    // before the next rescan; only that miss path costs a filesystem call.
+
+    bool ResourceSystem::load_text(std::string_view relative, std::string& out)
+    {
+        if (vfs().read_text(relative, out))
+            return true;
+
+        auto path = resolve(relative);
+
         if (!read_text_file(path, out))
         {
-            WAVE_LOG_ERROR("[resources] Failed to read text resource: ", path.string());
+            WAVE_LOG_CH_ERROR(Resources, describe_failure(path), " text resource ", path.string());
             return false;
         }
 
@@ -82,17 +190,98 @@ namespace wave::engine::core::resources
 
     bool ResourceSystem::load_binary(std::string_view relative, std::vector<std::uint8_t>& out)
     {
+        if (vfs().read(relative, out))
+            return true;
+
         auto path = resolve(relative);
 
-        if (!fs::exists(path))
+        if (!read_binary_file(path, out))
         {
-            WAVE_LOG_ERROR("[resources] Binary resource not found: ", path.string());
+            WAVE_LOG_CH_ERROR(Resources, describe_failure(path), " binary resource ", path.string());
             return false;
         }
 
-        if (!read_binary_file(path, out))
+        return true;
+    }
+
+    bool ResourceSystem::map_binary(std::string_view relative, MappedFile& out, MapAccess access)
+    {
+        if (vfs().map(relative, out, access))
+            return true;
+
+        auto path = resolve(relative);
+
+        if (!out.open(path, access))
+        {
+            WAVE_LOG_CH_ERROR(Resources, describe_failure(path), " binary resource ", path.string());
+            return false;
+        }
+
+        return true;
+    }
+
+    ResourceHandle ResourceSystem::acquire(std::string_view relative)
+    {
+        // Failures are logged by map_binary() (the cache's loader).
+        return s_cache.acquire(relative);
+    }
+
+    void ResourceSystem::load_binary_async(std::string_view relative,
+                                           AsyncFileIO& io,
+                                           filesystem::ReadCallback callback)
+    {
+        // Archive entries are already in memory; no point queueing them.
+        fs::path native = vfs().native_path(relative);
+        if (native.empty() && s_vfs.exists(relative))
+        {
+            filesystem::ReadResult result;
+            result.path = resolve(relative);
+            if (!load_binary(relative, result.data))
+                result.error = std::make_error_code(std::errc::io_error);
+
+            if (callback)
+                callback(std::move(result));
+            return;
+        }
+
+        if (native.empty())
+            native = resolve(relative);
+
+        io.read({ std::move(native) }, [callback = std::move(callback)](filesystem::ReadResult&& result)
+        {
+            if (!result.ok())
+            {
+                WAVE_LOG_CH_ERROR(Resources, "Failed to read binary resource ", result.path.string(),
+                                  ": ", result.error.message());
+            }
+
+            if (callback)
+            {
+                callback(std::move(result));
+            }
+        });
+    }
+
+    bool ResourceSystem::open_stream(std::string_view relative, AsyncFileIO& io, StreamReader& reader)
+    {
+        VirtualFileSystem::Location location;
+        if (!vfs().locate(relative, location))
+            location.file = resolve(relative);
+
+        if (location.compressed)
+        {
+            WAVE_LOG_CH_ERROR(Resources, "Cannot stream compressed archive entry ", relative,
+                              " from ", location.file.string());
+            return false;
+        }
+
+        // Stored archive entries are streamed straight out of the .wpak.
+        const std::uint64_t length = location.archive ? location.size : StreamReader::kToEnd;
+
+        if (!reader.open(io, location.file, location.offset, length))
         {
-            WAVE_LOG_ERROR("[resources] Failed to read binary resource: ", path.string());
+            WAVE_LOG_CH_ERROR(Resources, "Failed to open stream for ", location.file.string(),
+                              ": ", reader.error().message());
             return false;
         }
 
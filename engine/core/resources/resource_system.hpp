@@ -5,14 +5,28 @@
 #include <string_view>
 #include <vector>
 
+#include "engine/core/filesystem/async_file_io.hpp"
+#include "engine/core/filesystem/mapped_file.hpp"
+#include "engine/core/filesystem/stream_reader.hpp"
+#include "engine/core/filesystem/virtual_file_system.hpp"
+#include "engine/core/resources/resource_cache.hpp"
+
 namespace wave::engine::core::resources
 {
     namespace fs = std::filesystem;
 
+    using filesystem::AsyncFileIO;
+    using filesystem::MapAccess;
+    using filesystem::MappedFile;
+    using filesystem::StreamReader;
+    using filesystem::VirtualFileSystem;
+
     // Central access point for engine resources (shaders, editor assets, etc.).
     //
-    // The resource system does NOT own any caching or hot-reload logic yet.
-    // It just resolves paths and provides basic load helpers.
+    // The resource system does NOT own any hot-reload logic yet.
+    // It serves files through a VirtualFileSystem (loose files under the
+    // resource root overlaid by .wpak archives), keeps a shared ResourceCache
+    // and provides basic load helpers.
     //
     // Layout convention (under engine root):
     //
@@ -32,6 +46,11 @@ namespace wave::engine::core::resources
         // Safe to call multiple times; subsequent calls are no-ops once initialized.
         static void initialize();
 
+        // Drop cached resources and unmount everything. Handles from acquire()
+        // and views from map_binary() stay valid; archive-backed ones keep
+        // their archive mapped until released.
+        static void shutdown();
+
         // Has the resource system resolved its root yet.
         static bool is_initialized() noexcept { return s_initialized; }
 
@@ -40,19 +59,77 @@ namespace wave::engine::core::resources
 
         // Resolve a path inside the resource root, e.g.:
         //   "shaders/editor/basic.vert"
+        // This is the loose on-disk location; the file may actually be served
+        // from an archive (see vfs().native_path()).
         static fs::path resolve(std::string_view relative);
 
+        // Mount table and path index behind all loads below.
+        static VirtualFileSystem& vfs();
+
         // Load text file relative to the resource root.
         // Returns true on success, false on failure.
         static bool load_text(std::string_view relative, std::string& out);
 
         // Load binary file relative to the resource root.
         // Returns true on success, false on failure.
+        // Copies the file; prefer map_binary() for read-only consumers.
         static bool load_binary(std::string_view relative, std::vector<std::uint8_t>& out);
 
+        // Map a resource read-only without copying it (see MappedFile).
+        // 'out' owns the view; consumers read out.bytes() / out.text()
+        // directly and keep 'out' alive for as long as they use the data.
+        // Returns true on success, false on failure.
+        static bool map_binary(std::string_view relative,
+                               MappedFile& out,
+                               MapAccess access = MapAccess::Sequential);
+
+        // Shared, ref-counted bytes of a resource (see ResourceCache).
+        // Repeated acquires of the same path are served from memory.
+        // Returns nullptr on failure (already logged).
+        static ResourceHandle acquire(std::string_view relative);
+
+        static ResourceCache& cache() noexcept { return s_cache; }
+
+        // Queue a read of a resource on 'io'. 'callback' runs on the I/O
+        // thread / job worker; failures are logged before it is called.
+        // Resources found in a mounted archive complete immediately on the
+        // calling thread.
+        static void load_binary_async(std::string_view relative,
+                                      AsyncFileIO& io,
+                                      filesystem::ReadCallback callback);
+
+        // Open 'reader' on a resource so it can be consumed in chunks
+        // instead of loaded whole (large meshes, scenes). Works for loose
+        // files and stored archive entries; compressed archive entries
+        // cannot be streamed and fail with an error logged.
+        static bool open_stream(std::string_view relative, AsyncFileIO& io, StreamReader& reader);
+
+        // True if the resource is in any mount. A hash probe into the VFS
+        // index; never touches the disk.
+        static bool exists(std::string_view relative);
+        static bool exists(const filesystem::VfsPath& path);
+
+        // Archives -----------------------------------------------------------
+        //
+        // Mounted .wpak archives (see pak_format.hpp) override loose files
+        // under resource_root(), later mounts overriding earlier ones.
+        // initialize() mounts every *.wpak in the engine root, so a shipping
+        // build maps one file at startup instead of opening each resource.
+        //
+        // Mounting or unmounting invalidates the whole cache, since any path
+        // may now resolve elsewhere; views already handed out keep the bytes
+        // they were given.
+
+        static bool        mount_archive(const fs::path& path);
+        static void        unmount_all();
+        static std::size_t mounted_archive_count();
+
     private:
-        static bool     s_initialized;
-        static fs::path s_resourceRoot;
+        static bool              s_initialized;
+        static fs::path          s_resourceRoot;
+        static VirtualFileSystem s_vfs;
+        static ResourceCache     s_cache;
+        static int               s_nextArchivePriority;
     };
 
 } // namespace wave::engine::core::resources
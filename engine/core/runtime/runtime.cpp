@@ -4,6 +4,10 @@
 #include "engine/core/build/build_config.hpp"
 #include "engine/core/events/event_system.hpp"
 #include "engine/core/logging/log.hpp"
+#include "engine/core/logging/file_log_sink.hpp"
+#include "engine/core/logging/binary_log_sink.hpp"
+#include "engine/core/logging/log_config.hpp"
+#include "engine/core/config/config_system.hpp"
 #include "engine/core/resources/resource_system.hpp"
 
 namespace wave::engine::core::runtime
@@ -13,6 +17,8 @@ namespace wave::engine::core::runtime
         bool          g_initialized = false;
         Environment   g_environment;
         RuntimeConfig g_config;
+
+        FileWriter    g_fileWriter;
     } // namespace
 
     bool initialize(const RuntimeConfig& config)
@@ -35,17 +41,71 @@ namespace wave::engine::core::runtime
         {
             wave::engine::core::logging::Logger::init(
                 config.app_name,
-                config.min_log_level
+                config.min_log_level,
+                config.log_to_terminal
             );
+
+            if (config.log_to_file)
+            {
+                wave::engine::core::logging::RotatingFileConfig file_cfg;
+                file_cfg.directory = g_environment.logs_path();
+                file_cfg.base_name = config.app_name;
+
+                auto sink = std::make_shared<wave::engine::core::logging::FileLogSink>(file_cfg);
+                if (sink->open())
+                {
+                    wave::engine::core::logging::Logger::add_sink(std::move(sink));
+                }
+                else
+                {
+                    WAVE_LOG_CH_WARN(Runtime, "File logging disabled; cannot write to ",
+                                     file_cfg.directory.string());
+                }
+            }
+
+            if (config.log_binary)
+            {
+                wave::engine::core::logging::RotatingFileConfig bin_cfg;
+                bin_cfg.directory = g_environment.logs_path();
+                bin_cfg.base_name = config.app_name;
+                bin_cfg.extension = ".wlog";
+
+                auto sink = std::make_shared<wave::engine::core::logging::BinaryLogSink>(bin_cfg, config.app_name);
+                if (sink->open())
+                {
+                    wave::engine::core::logging::Logger::add_sink(std::move(sink));
+                }
+                else
+                {
+                    WAVE_LOG_CH_WARN(Runtime, "Binary logging disabled; cannot write to ",
+                                     bin_cfg.directory.string());
+                }
+            }
+
+            // Optional per channel levels, e.g. "log.channel.render = trace".
+            const fs::path log_cfg_path = g_environment.config_path() / "logging.cfg";
+            std::error_code ec;
+            if (fs::exists(log_cfg_path, ec))
+            {
+                wave::engine::core::config::ConfigSystem log_cfg;
+                if (log_cfg.load_from_file(log_cfg_path))
+                {
+                    wave::engine::core::logging::apply_log_config(log_cfg.table());
+                }
+            }
         }
 
         // 3) Initialize resource system (uses Environment + Logging).
         wave::engine::core::resources::ResourceSystem::initialize();
+        wave::engine::core::resources::ResourceSystem::cache().set_budget(config.resource_cache_budget);
 
-        // 4) Initialize high resolution timing.
+        // 4) Background writer for saves; keeps disk I/O off the frame.
+        g_fileWriter.initialize();
+
+        // 5) Initialize high resolution timing.
         wave::engine::core::time::Time::initialize();
 
-        // 5) Initialize global event system.
+        // 6) Initialize global event system.
         wave::engine::core::events::EventSystem::initialize();
 
         g_initialized = true;
@@ -62,8 +122,11 @@ namespace wave::engine::core::runtime
         // Event system first, so no more events are fired during shutdown.
         wave::engine::core::events::EventSystem::shutdown();
 
-        // ResourceSystem currently has no explicit shutdown; it just
-        // relies on process lifetime. If that changes later, call it here.
+        // Write out pending saves while logging is still up.
+        g_fileWriter.shutdown();
+
+        // Releases cached resources and unmounts archives.
+        wave::engine::core::resources::ResourceSystem::shutdown();
 
         // Shut down logging last, after any final messages.
         if (wave::engine::core::build::kLoggingEnabled)
@@ -84,4 +147,9 @@ namespace wave::engine::core::runtime
         return g_environment;
     }
 
+    FileWriter& file_writer() noexcept
+    {
+        return g_fileWriter;
+    }
+
 } // namespace wave::engine::core::runtime
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <filesystem>
 
 #include "engine/core/logging/log.hpp"
 #include "engine/core/environment/environment.hpp"
+#include "engine/core/filesystem/async_file_writer.hpp"
 
 namespace wave::engine::core::runtime
 {
@@ -12,6 +14,7 @@ namespace wave::engine::core::runtime
 
     using LogLevel    = wave::engine::core::logging::LogLevel;
     using Environment = wave::engine::core::environment::Environment;
+    using FileWriter  = wave::engine::core::filesystem::AsyncFileWriter;
 
     // Configuration used when bringing the engine runtime online.
     struct RuntimeConfig
@@ -19,6 +22,17 @@ namespace wave::engine::core::runtime
         std::string app_name       = "WaveApp";
         LogLevel    min_log_level  = LogLevel::Info;
 
+        // Log sinks installed during initialize().
+        // The file sink writes <engine_root>/logs/<app_name>.log with rotation,
+        // the binary sink <app_name>.wlog (decode with wave_logdump).
+        bool        log_to_terminal = true;
+        bool        log_to_file     = true;
+        bool        log_binary      = false;
+
+        // Target size of ResourceSystem's shared resource cache. Unused
+        // resources are evicted (least recently used first) beyond this.
+        std::size_t resource_cache_budget = 256u << 20;
+
         // Path to the currently running executable.
         // This is used by Environment to locate the engine root.
         fs::path    executable_path;
@@ -44,4 +58,9 @@ namespace wave::engine::core::runtime
     // Only valid after initialize() has returned true.
     const Environment& environment() noexcept;
 
+    // Shared write-behind writer for autosave, settings, metadata sidecars
+    // and cache files. Running between initialize() and shutdown(), which
+    // flushes it; outside that window writes are synchronous.
+    FileWriter& file_writer() noexcept;
+
 } // namespace wave::engine::core::runtime
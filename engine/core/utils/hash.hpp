@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace wave::engine::core::utils
+{
+    // 64-bit FNV-1a. Not cryptographic; stable across platforms and
+    // builds, so it is safe to store in files (e.g. .wpak tables).
+    constexpr std::uint64_t kFnv1aOffset64 = 0xcbf29ce484222325ull;
+    constexpr std::uint64_t kFnv1aPrime64  = 0x100000001b3ull;
+
+    constexpr std::uint64_t fnv1a_64(std::string_view text, std::uint64_t seed = kFnv1aOffset64) noexcept
+    {
+        std::uint64_t hash = seed;
+        for (char c : text)
+        {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= kFnv1aPrime64;
+        }
+        return hash;
+    }
+
+} // namespace wave::engine::core::utils
@@ -20,7 +20,7 @@ namespace wave::engine::render
 
         if (!window_handle)
         {
-            WAVE_LOG_ERROR("[render] RenderSystem::initialize called with null window handle.");
+            WAVE_LOG_CH_ERROR(Render, "RenderSystem::initialize called with null window handle.");
             return false;
         }
 
@@ -33,14 +33,14 @@ namespace wave::engine::render
 
         if (!backend->initialize(info))
         {
-            WAVE_LOG_ERROR("[render] Failed to initialize render backend.");
+            WAVE_LOG_CH_ERROR(Render, "Failed to initialize render backend.");
             return false;
         }
 
         s_backend     = std::move(backend);
         s_initialized = true;
 
-        WAVE_LOG_INFO("[render] RenderSystem initialized.");
+        WAVE_LOG_CH_INFO(Render, "RenderSystem initialized.");
         return true;
     }
 
@@ -56,7 +56,7 @@ namespace wave::engine::render
         }
 
         s_initialized = false;
-        WAVE_LOG_INFO("[render] RenderSystem shutdown complete.");
+        WAVE_LOG_CH_INFO(Render, "RenderSystem shutdown complete.");
     }
 
     bool RenderSystem::is_initialized() noexcept
@@ -24,11 +24,26 @@ namespace wave::engine::render::vulkan
         if (result == VK_SUCCESS)
             return true;
 
-        WAVE_LOG_ERROR("[render] Vulkan error in ", context,
-                       " (code = ", static_cast<int>(result), ")");
+        WAVE_LOG_CH_ERROR(Render, "Vulkan error in ", context,
+                          " (code = ", static_cast<int>(result), ")");
         return false;
     }
 
+    // Same check for calls made every frame: a persistent failure would
+    // otherwise log once per frame. A macro (wrapping a lambda) so that each
+    // call site gets its own rate limit; a steady failure in one call must
+    // not hide the first failure of another.
+#define WAVE_VK_CHECK_PER_FRAME(result, context)                                        \
+    ([](VkResult wave_vk_result_)                                                       \
+    {                                                                                   \
+        if (wave_vk_result_ == VK_SUCCESS)                                              \
+            return true;                                                                \
+                                                                                        \
+        WAVE_LOG_CH_ERROR_LIMITED(Render, 1, "Vulkan error in ", context,               \
+                                  " (code = ", static_cast<int>(wave_vk_result_), ")"); \
+        return false;                                                                   \
+    }(result))
+
     static const std::vector<const char*> kRequiredDeviceExtensions = {
         VK_KHR_SWAPCHAIN_EXTENSION_NAME
     };
@@ -48,14 +63,14 @@ namespace wave::engine::render::vulkan
 
         if (!m_window_handle)
         {
-            WAVE_LOG_ERROR("[render] VkBackend::initialize called with null window handle.");
+            WAVE_LOG_CH_ERROR(Render, "VkBackend::initialize called with null window handle.");
             return false;
         }
 
         auto* glfwWindow = static_cast<GLFWwindow*>(m_window_handle);
 
-        WAVE_LOG_INFO("[render] Initializing Vulkan backend...");
-        WAVE_LOG_INFO("[render] Window: ", m_width, "x", m_height);
+        WAVE_LOG_CH_INFO(Render, "Initializing Vulkan backend...");
+        WAVE_LOG_CH_INFO(Render, "Window: ", m_width, "x", m_height);
 
         // 1) Instance
 
@@ -72,7 +87,7 @@ namespace wave::engine::render::vulkan
 
         if (!glfwExtensions || glfwExtensionCount == 0)
         {
-            WAVE_LOG_ERROR("[render] glfwGetRequiredInstanceExtensions returned no extensions.");
+            WAVE_LOG_CH_ERROR(Render, "glfwGetRequiredInstanceExtensions returned no extensions.");
             return false;
         }
 
@@ -93,7 +108,7 @@ namespace wave::engine::render::vulkan
             return false;
         }
 
-        WAVE_LOG_INFO("[render] Vulkan instance created.");
+        WAVE_LOG_CH_INFO(Render, "Vulkan instance created.");
 
         // 2) Surface
 
@@ -106,7 +121,7 @@ namespace wave::engine::render::vulkan
             return false;
         }
 
-        WAVE_LOG_INFO("[render] Vulkan surface created.");
+        WAVE_LOG_CH_INFO(Render, "Vulkan surface created.");
 
         // 3) Physical device
 
@@ -114,7 +129,7 @@ namespace wave::engine::render::vulkan
         result = vkEnumeratePhysicalDevices(m_instance, &deviceCount, nullptr);
         if (!check_vk_result(result, "vkEnumeratePhysicalDevices") || deviceCount == 0)
         {
-            WAVE_LOG_ERROR("[render] No Vulkan physical devices found.");
+            WAVE_LOG_CH_ERROR(Render, "No Vulkan physical devices found.");
             return false;
         }
 
@@ -187,13 +202,13 @@ namespace wave::engine::render::vulkan
 
         if (m_physicalDevice == VK_NULL_HANDLE)
         {
-            WAVE_LOG_ERROR("[render] Failed to find a suitable Vulkan physical device.");
+            WAVE_LOG_CH_ERROR(Render, "Failed to find a suitable Vulkan physical device.");
             return false;
         }
 
         VkPhysicalDeviceProperties props{};
         vkGetPhysicalDeviceProperties(m_physicalDevice, &props);
-        WAVE_LOG_INFO("[render] Using physical device: ", props.deviceName);
+        WAVE_LOG_CH_INFO(Render, "Using physical device: ", props.deviceName);
 
         // 4) Logical device + queues
 
@@ -237,9 +252,9 @@ namespace wave::engine::render::vulkan
         vkGetDeviceQueue(m_device, m_graphicsQueueFamily, 0, &m_graphicsQueue);
         vkGetDeviceQueue(m_device, m_presentQueueFamily, 0, &m_presentQueue);
 
-        WAVE_LOG_INFO("[render] Vulkan logical device created. "
-                      "Graphics queue family = ", m_graphicsQueueFamily,
-                      ", Present queue family = ", m_presentQueueFamily);
+        WAVE_LOG_CH_INFO(Render, "Vulkan logical device created. "
+                         "Graphics queue family = ", m_graphicsQueueFamily,
+                         ", Present queue family = ", m_presentQueueFamily);
 
         // 5) Command pool, swapchain, render pass, framebuffers, command buffers, sync, pipeline
 
@@ -248,7 +263,7 @@ namespace wave::engine::render::vulkan
 
         if (!create_swapchain())
         {
-            WAVE_LOG_ERROR("[render] Failed to create swapchain.");
+            WAVE_LOG_CH_ERROR(Render, "Failed to create swapchain.");
             return false;
         }
 
@@ -272,11 +287,11 @@ namespace wave::engine::render::vulkan
                 "shaders/editor/simple.vert.spv",
                 "shaders/editor/simple.frag.spv"))
         {
-            WAVE_LOG_ERROR("[render] Failed to initialize VkSimplePipeline.");
+            WAVE_LOG_CH_ERROR(Render, "Failed to initialize VkSimplePipeline.");
             return false;
         }
 
-        WAVE_LOG_INFO("[render] Vulkan backend initialized (full frame loop with simple pipeline).");
+        WAVE_LOG_CH_INFO(Render, "Vulkan backend initialized (full frame loop with simple pipeline).");
         return true;
     }
 
@@ -338,7 +353,7 @@ namespace wave::engine::render::vulkan
         vkGetPhysicalDeviceSurfaceFormatsKHR(m_physicalDevice, m_surface, &formatCount, nullptr);
         if (formatCount == 0)
         {
-            WAVE_LOG_ERROR("[render] No surface formats available.");
+            WAVE_LOG_CH_ERROR(Render, "No surface formats available.");
             return false;
         }
         std::vector<VkSurfaceFormatKHR> formats(formatCount);
@@ -348,7 +363,7 @@ namespace wave::engine::render::vulkan
         vkGetPhysicalDeviceSurfacePresentModesKHR(m_physicalDevice, m_surface, &presentModeCount, nullptr);
         if (presentModeCount == 0)
         {
-            WAVE_LOG_ERROR("[render] No present modes available.");
+            WAVE_LOG_CH_ERROR(Render, "No present modes available.");
             return false;
         }
         std::vector<VkPresentModeKHR> presentModes(presentModeCount);
@@ -430,9 +445,9 @@ namespace wave::engine::render::vulkan
                 return false;
         }
 
-        WAVE_LOG_INFO("[render] Swapchain created with ", imageCount,
-                      " images, format ", static_cast<int>(m_swapchainImageFormat),
-                      ", extent ", m_swapchainExtent.width, "x", m_swapchainExtent.height);
+        WAVE_LOG_CH_INFO(Render, "Swapchain created with ", imageCount,
+                         " images, format ", static_cast<int>(m_swapchainImageFormat),
+                         ", extent ", m_swapchainExtent.width, "x", m_swapchainExtent.height);
 
         return true;
     }
@@ -658,7 +673,7 @@ namespace wave::engine::render::vulkan
     {
         VkResult res = vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame],
                                        VK_TRUE, UINT64_MAX);
-        if (!check_vk_result(res, "vkWaitForFences"))
+        if (!WAVE_VK_CHECK_PER_FRAME(res, "vkWaitForFences"))
             return false;
 
         res = vkAcquireNextImageKHR(
@@ -675,11 +690,11 @@ namespace wave::engine::render::vulkan
             return false;
         }
 
-        if (!check_vk_result(res, "vkAcquireNextImageKHR"))
+        if (!WAVE_VK_CHECK_PER_FRAME(res, "vkAcquireNextImageKHR"))
             return false;
 
         res = vkResetFences(m_device, 1, &m_inFlightFences[m_currentFrame]);
-        if (!check_vk_result(res, "vkResetFences"))
+        if (!WAVE_VK_CHECK_PER_FRAME(res, "vkResetFences"))
             return false;
 
         return true;
@@ -691,7 +706,7 @@ namespace wave::engine::render::vulkan
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 
         VkResult res = vkBeginCommandBuffer(cmd, &beginInfo);
-        if (!check_vk_result(res, "vkBeginCommandBuffer"))
+        if (!WAVE_VK_CHECK_PER_FRAME(res, "vkBeginCommandBuffer"))
             return false;
 
         VkClearValue clearColor{};
@@ -722,7 +737,7 @@ namespace wave::engine::render::vulkan
         vkCmdEndRenderPass(cmd);
 
         res = vkEndCommandBuffer(cmd);
-        if (!check_vk_result(res, "vkEndCommandBuffer"))
+        if (!WAVE_VK_CHECK_PER_FRAME(res, "vkEndCommandBuffer"))
             return false;
 
         return true;
@@ -751,7 +766,7 @@ namespace wave::engine::render::vulkan
             return false;
         }
 
-        if (!check_vk_result(res, "vkQueuePresentKHR"))
+        if (!WAVE_VK_CHECK_PER_FRAME(res, "vkQueuePresentKHR"))
             return false;
 
         m_currentFrame = (m_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
@@ -794,12 +809,14 @@ namespace wave::engine::render::vulkan
         submit.pSignalSemaphores    = signalSemaphores;
 
         VkResult res = vkQueueSubmit(m_graphicsQueue, 1, &submit, m_inFlightFences[m_currentFrame]);
-        if (!check_vk_result(res, "vkQueueSubmit"))
+        if (!WAVE_VK_CHECK_PER_FRAME(res, "vkQueueSubmit"))
             return;
 
         present_image();
     }
 
+#undef WAVE_VK_CHECK_PER_FRAME
+
     void VkBackend::resize(std::uint32_t width, std::uint32_t height)
     {
         m_width  = width;
@@ -808,8 +825,8 @@ namespace wave::engine::render::vulkan
         if (!m_device)
             return;
 
-        WAVE_LOG_INFO("[render] Resizing Vulkan backend to ",
-                      width, "x", height);
+        WAVE_LOG_CH_INFO(Render, "Resizing Vulkan backend to ",
+                         width, "x", height);
 
         vkDeviceWaitIdle(m_device);
 
@@ -839,7 +856,7 @@ namespace wave::engine::render::vulkan
         if (!m_instance && !m_surface && !m_physicalDevice && !m_device && !m_swapchain)
             return;
 
-        WAVE_LOG_INFO("[render] Shutting down Vulkan backend...");
+        WAVE_LOG_CH_INFO(Render, "Shutting down Vulkan backend...");
 
         if (m_device != VK_NULL_HANDLE)
         {
@@ -877,7 +894,7 @@ namespace wave::engine::render::vulkan
         m_presentQueueFamily    = UINT32_MAX;
         m_window_handle         = nullptr;
 
-        WAVE_LOG_INFO("[render] Vulkan backend shutdown complete.");
+        WAVE_LOG_CH_INFO(Render, "Vulkan backend shutdown complete.");
     }
 
 } // namespace wave::engine::render::vulkan
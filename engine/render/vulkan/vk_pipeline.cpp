@@ -13,8 +13,8 @@ namespace wave::engine::render::vulkan
             if (result == VK_SUCCESS)
                 return true;
 
-            WAVE_LOG_ERROR("[render] Vulkan error in ", context,
-                           " (code = ", static_cast<int>(result), ")");
+            WAVE_LOG_CH_ERROR(Render, "Vulkan error in ", context,
+                              " (code = ", static_cast<int>(result), ")");
             return false;
         }
     }
@@ -90,7 +90,7 @@ namespace wave::engine::render::vulkan
 
         if (device == VK_NULL_HANDLE || renderPass == VK_NULL_HANDLE)
         {
-            WAVE_LOG_ERROR("[render] VkSimplePipeline::initialize called with null device or renderPass.");
+            WAVE_LOG_CH_ERROR(Render, "VkSimplePipeline::initialize called with null device or renderPass.");
             return false;
         }
 
@@ -223,9 +223,9 @@ namespace wave::engine::render::vulkan
             return false;
         }
 
-        WAVE_LOG_INFO("[render] VkSimplePipeline initialized with shaders: ",
-                      m_vertShader.debug_name(), " , ",
-                      m_fragShader.debug_name());
+        WAVE_LOG_CH_INFO(Render, "VkSimplePipeline initialized with shaders: ",
+                         m_vertShader.debug_name(), " , ",
+                         m_fragShader.debug_name());
 
         return true;
     }
@@ -7,6 +7,7 @@ namespace wave::engine::render::vulkan
 {
     using wave::engine::core::logging::Logger;
     using wave::engine::core::resources::ResourceSystem;
+    using wave::engine::core::resources::ResourceHandle;
 
     namespace
     {
@@ -15,8 +16,8 @@ namespace wave::engine::render::vulkan
             if (result == VK_SUCCESS)
                 return true;
 
-            WAVE_LOG_ERROR("[render] Vulkan error in ", context,
-                           " (code = ", static_cast<int>(result), ")");
+            WAVE_LOG_CH_ERROR(Render, "Vulkan error in ", context,
+                              " (code = ", static_cast<int>(result), ")");
             return false;
         }
     }
@@ -72,27 +73,30 @@ namespace wave::engine::render::vulkan
 
         if (device == VK_NULL_HANDLE)
         {
-            WAVE_LOG_ERROR("[render] VkShaderModuleHandle::load_from_resource called with null device.");
+            WAVE_LOG_CH_ERROR(Render, "VkShaderModuleHandle::load_from_resource called with null device.");
             return false;
         }
 
-        std::vector<std::uint8_t> data;
-        if (!ResourceSystem::load_binary(resourcePath, data))
+        // Shared through the resource cache, so pipeline rebuilds (e.g. on
+        // swapchain resize) reuse the SPIR-V instead of reading it again.
+        // The handle only has to outlive vkCreateShaderModule.
+        const ResourceHandle data = ResourceSystem::acquire(resourcePath);
+        if (!data)
         {
-            WAVE_LOG_ERROR("[render] Failed to load shader resource: ", std::string(resourcePath));
+            WAVE_LOG_CH_ERROR(Render, "Failed to load shader resource: ", std::string(resourcePath));
             return false;
         }
 
-        if (data.empty() || (data.size() % 4) != 0)
+        if (data->size() == 0 || (data->size() % 4) != 0)
         {
-            WAVE_LOG_ERROR("[render] Shader resource not valid SPIR-V size: ", std::string(resourcePath));
+            WAVE_LOG_CH_ERROR(Render, "Shader resource not valid SPIR-V size: ", std::string(resourcePath));
             return false;
         }
 
         VkShaderModuleCreateInfo info{};
         info.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        info.codeSize = data.size();
-        info.pCode    = reinterpret_cast<const std::uint32_t*>(data.data());
+        info.codeSize = data->size();
+        info.pCode    = reinterpret_cast<const std::uint32_t*>(data->data());
 
         VkShaderModule module = VK_NULL_HANDLE;
         if (!check_vk_result(vkCreateShaderModule(device, &info, nullptr, &module),
@@ -105,7 +109,7 @@ namespace wave::engine::render::vulkan
         m_module    = module;
         m_debugName = std::string(resourcePath);
 
-        WAVE_LOG_INFO("[render] Shader module created from resource: ", m_debugName);
+        WAVE_LOG_CH_INFO(Render, "Shader module created from resource: ", m_debugName);
 
         return true;
     }
@@ -1,8 +1,18 @@
 #include "shader_compiler.hpp"
 
+#include <array>
+#include <cstdio>      // popen
 #include <cstdlib>     // std::system
 #include <sstream>
 
+#if defined(_WIN32)
+    #define WAVE_POPEN  _popen
+    #define WAVE_PCLOSE _pclose
+#else
+    #define WAVE_POPEN  popen
+    #define WAVE_PCLOSE pclose
+#endif
+
 namespace wave::engine::tools {
 
 // -----------------------------------------------------------------------------
@@ -120,4 +130,29 @@ ShaderCompileResult ShaderCompiler::compile_to_file(
     return result;
 }
 
+std::string ShaderCompiler::query_version() const {
+    const std::string commandLine = escape_path(m_compilerPath) + " --version 2>&1";
+
+    std::FILE* pipe = WAVE_POPEN(commandLine.c_str(), "r");
+    if (!pipe) {
+        return {};
+    }
+
+    std::string output;
+    std::array<char, 256> buffer{};
+    std::size_t count = 0;
+    while ((count = std::fread(buffer.data(), 1, buffer.size(), pipe)) > 0) {
+        output.append(buffer.data(), count);
+    }
+
+    // A shell that could not find the compiler still prints something.
+    if (WAVE_PCLOSE(pipe) != 0) {
+        return {};
+    }
+    return output;
+}
+
+#undef WAVE_POPEN
+#undef WAVE_PCLOSE
+
 } // namespace wave::engine::tools
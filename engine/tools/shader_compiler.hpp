@@ -73,6 +73,11 @@ public:
         const std::vector<std::string>& additionalArgs = {}
     ) const;
 
+    // Output of "<compiler> --version" (stdout and stderr), or empty if the
+    // compiler could not be run. Identifies the exact compiler build, e.g.
+    // for keying cached compiler output.
+    std::string query_version() const;
+
 private:
     std::string build_stage_flag(ShaderStage stage) const;
     std::string escape_path(const fs::path& p) const;
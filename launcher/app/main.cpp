@@ -97,14 +97,14 @@ namespace wave::launcher
                       << "  " << editor << "\n";
             std::cout << "Make sure wave_editor is built and located next to wave_launcher.\n\n";
 
-            WAVE_LOG_ERROR("[launcher] Editor binary not found at: ", editor.string());
+            WAVE_LOG_CH_ERROR(Launcher, "Editor binary not found at: ", editor.string());
             return;
         }
 
         std::cout << "\n[launcher] Launching Wave Editor...\n";
         std::cout << "  Path: " << editor << "\n";
 
-        WAVE_LOG_INFO("[launcher] Launching Wave Editor at path: ", editor.string());
+        WAVE_LOG_CH_INFO(Launcher, "Launching Wave Editor at path: ", editor.string());
 
         // Blocking launch for now.
         int result = std::system(editor.string().c_str());
@@ -112,12 +112,12 @@ namespace wave::launcher
         if (result == -1)
         {
             std::cout << "[launcher] Failed to start editor process.\n\n";
-            WAVE_LOG_ERROR("[launcher] Failed to start editor process.");
+            WAVE_LOG_CH_ERROR(Launcher, "Failed to start editor process.");
         }
         else
         {
             std::cout << "[launcher] Editor exited with code " << result << ".\n\n";
-            WAVE_LOG_INFO("[launcher] Editor exited with code ", result, ".");
+            WAVE_LOG_CH_INFO(Launcher, "Editor exited with code ", result, ".");
         }
     }
 
@@ -126,7 +126,7 @@ namespace wave::launcher
         std::cout << "\n[launcher] Game launch is not wired yet.\n";
         std::cout << "  This will start Echogenesis once the core loop exists.\n\n";
 
-        WAVE_LOG_INFO("[launcher] Game launch requested but not implemented yet.");
+        WAVE_LOG_CH_INFO(Launcher, "Game launch requested but not implemented yet.");
     }
 
     void handle_profiles()
@@ -134,7 +134,7 @@ namespace wave::launcher
         std::cout << "\n[launcher] Profiles & saves screen is a stub for now.\n";
         std::cout << "  Plan: player profiles, save slots, cloud sync hooks.\n\n";
 
-        WAVE_LOG_DEBUG("[launcher] Profiles & saves stub accessed.");
+        WAVE_LOG_CH_DEBUG(Launcher, "Profiles & saves stub accessed.");
     }
 
     void handle_settings()
@@ -142,7 +142,7 @@ namespace wave::launcher
         std::cout << "\n[launcher] Settings screen is a stub for now.\n";
         std::cout << "  Plan: graphics presets, engine flags, debug options, etc.\n\n";
 
-        WAVE_LOG_DEBUG("[launcher] Settings stub accessed.");
+        WAVE_LOG_CH_DEBUG(Launcher, "Settings stub accessed.");
     }
 } // namespace wave::launcher
 
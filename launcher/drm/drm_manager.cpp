@@ -18,15 +18,15 @@ namespace wave::launch
         {
             if (kDevFriendlyDrm)
             {
-                WAVE_LOG_WARN("[launcher] No license file found at: ", path);
-                WAVE_LOG_INFO("[launcher] Dev build: skipping DRM and continuing.");
+                WAVE_LOG_CH_WARN(Launcher, "No license file found at: ", path);
+                WAVE_LOG_CH_INFO(Launcher, "Dev build: skipping DRM and continuing.");
                 // Internal/dev builds: allow running without a license file.
                 return true;
             }
             else
             {
-                WAVE_LOG_ERROR("[launcher] No license file found at: ", path);
-                WAVE_LOG_ERROR("[launcher] DRM check failed (public build requires a license).");
+                WAVE_LOG_CH_ERROR(Launcher, "No license file found at: ", path);
+                WAVE_LOG_CH_ERROR(Launcher, "DRM check failed (public build requires a license).");
                 return false;
             }
         }
@@ -37,17 +37,17 @@ namespace wave::launch
 
         if (key.empty())
         {
-            WAVE_LOG_ERROR("[launcher] License file is empty.");
+            WAVE_LOG_CH_ERROR(Launcher, "License file is empty.");
             return false;
         }
 
         if (!validate_key(key))
         {
-            WAVE_LOG_ERROR("[launcher] License key invalid.");
+            WAVE_LOG_CH_ERROR(Launcher, "License key invalid.");
             return false;
         }
 
-        WAVE_LOG_INFO("[launcher] License key accepted.");
+        WAVE_LOG_CH_INFO(Launcher, "License key accepted.");
         return true;
     }
 
@@ -0,0 +1,543 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "engine/assets/asset_database.hpp"
+#include "engine/core/filesystem/async_file_io.hpp"
+#include "engine/core/filesystem/directory_index.hpp"
+#include "engine/core/filesystem/file_system.hpp"
+#include "engine/core/filesystem/file_watcher.hpp"
+#include "engine/core/filesystem/mapped_file.hpp"
+#include "engine/core/jobs/job_system.hpp"
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace wave::tools::bench_io
+{
+    namespace fs         = std::filesystem;
+    namespace filesystem = wave::engine::core::filesystem;
+    namespace jobs       = wave::engine::core::jobs;
+    namespace assets     = wave::engine::assets;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+        fs::path      directory   = fs::temp_directory_path() / "wave_bench_io";
+        std::size_t   small_count = 20000;
+        std::size_t   small_size  = 4 << 10;
+        std::size_t   huge_count  = 4;
+        std::size_t   huge_size   = 256u << 20;
+        std::size_t   mixed_count = 2000;
+        int           repeat      = 3;
+        unsigned      threads     = 0;     // 0 = hardware concurrency
+        bool          cold        = false;
+        bool          keep        = false;
+        bool          regenerate  = false;
+    };
+
+    struct DataSet
+    {
+        std::string           name;
+        std::vector<fs::path> files;
+        std::uint64_t         bytes = 0;
+    };
+
+    // Sink for read bytes so the loads cannot be optimized away.
+    std::uint64_t g_checksum = 0;
+
+    void print_usage()
+    {
+        std::cout << "Usage:\n"
+                  << "  wave_bench_io [options]\n"
+                  << "\n"
+                  << "Options:\n"
+                  << "  --dir <path>         Where the synthetic tree lives (default <tmp>/wave_bench_io)\n"
+                  << "  --small <n>          Number of small files (default 20000)\n"
+                  << "  --small-size <KiB>   Size of each small file (default 4)\n"
+                  << "  --huge <n>           Number of huge files (default 4)\n"
+                  << "  --huge-size <MiB>    Size of each huge file (default 256)\n"
+                  << "  --mixed <n>          Number of mixed-size files, 256 B .. 8 MiB (default 2000)\n"
+                  << "  --repeat <n>         Runs per measurement; the median is reported (default 3)\n"
+                  << "  --threads <n>        JobSystem workers (default: all cores)\n"
+                  << "  --cold               Drop each file from the page cache before every run\n"
+                  << "  --regenerate         Rebuild the tree even if it already exists\n"
+                  << "  --keep               Do not delete the tree afterwards\n";
+    }
+
+    bool parse_options(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            const bool has_value = i + 1 < argc;
+
+            auto number = [&](std::size_t& out)
+            {
+                out = static_cast<std::size_t>(std::strtoull(argv[++i], nullptr, 10));
+            };
+
+            if (arg == "--dir" && has_value)
+                options.directory = argv[++i];
+            else if (arg == "--small" && has_value)
+                number(options.small_count);
+            else if (arg == "--small-size" && has_value)
+            {
+                number(options.small_size);
+                options.small_size <<= 10;
+            }
+            else if (arg == "--huge" && has_value)
+                number(options.huge_count);
+            else if (arg == "--huge-size" && has_value)
+            {
+                number(options.huge_size);
+                options.huge_size <<= 20;
+            }
+            else if (arg == "--mixed" && has_value)
+                number(options.mixed_count);
+            else if (arg == "--repeat" && has_value)
+                options.repeat = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--threads" && has_value)
+                options.threads = static_cast<unsigned>(std::atoi(argv[++i]));
+            else if (arg == "--cold")
+                options.cold = true;
+            else if (arg == "--regenerate")
+                options.regenerate = true;
+            else if (arg == "--keep")
+                options.keep = true;
+            else
+                return false;
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------
+    // Synthetic tree
+    // ------------------------------------------------------------
+
+    bool write_file(const fs::path& path, std::size_t size, std::mt19937_64& rng)
+    {
+        std::vector<char> block(std::min<std::size_t>(size, 1u << 20));
+        for (auto& c : block)
+            c = static_cast<char>(rng());
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        for (std::size_t written = 0; written < size && file; written += block.size())
+        {
+            file.write(block.data(), static_cast<std::streamsize>(std::min(block.size(), size - written)));
+        }
+        return static_cast<bool>(file);
+    }
+
+    // Small and mixed files are spread over 256-file subdirectories, like a
+    // real asset tree.
+    bool generate(const Options& options, std::vector<DataSet>& sets)
+    {
+        const fs::path stamp = options.directory / ".complete";
+
+        std::error_code ec;
+        const bool reuse = !options.regenerate && fs::exists(stamp, ec);
+        if (!reuse)
+        {
+            fs::remove_all(options.directory, ec);
+            std::cout << "Generating " << options.directory.string() << " ...\n";
+        }
+
+        std::mt19937_64 rng(42);
+
+        auto build = [&](std::string name, std::size_t count, const std::function<std::size_t(std::size_t)>& size_of)
+        {
+            DataSet set;
+            set.name = std::move(name);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const fs::path dir  = options.directory / set.name / std::to_string(i / 256);
+                const fs::path path = dir / ("file_" + std::to_string(i) + ".bin");
+                const std::size_t size = size_of(i);
+
+                if (!reuse)
+                {
+                    fs::create_directories(dir, ec);
+                    if (!write_file(path, size, rng))
+                    {
+                        std::cerr << "wave_bench_io: cannot write " << path.string() << "\n";
+                        return false;
+                    }
+                }
+
+                set.files.push_back(path);
+                set.bytes += size;
+            }
+
+            sets.push_back(std::move(set));
+            return true;
+        };
+
+        // Log-uniform 256 B .. 8 MiB, fixed seed so runs are comparable.
+        std::mt19937_64 size_rng(7);
+        std::uniform_real_distribution<double> log_size(8.0, 23.0);
+        std::vector<std::size_t> mixed_sizes(options.mixed_count);
+        for (auto& size : mixed_sizes)
+            size = static_cast<std::size_t>(std::exp2(log_size(size_rng)));
+
+        const bool ok = build("small", options.small_count, [&](std::size_t) { return options.small_size; }) &&
+                        build("huge", options.huge_count, [&](std::size_t) { return options.huge_size; }) &&
+                        build("mixed", options.mixed_count, [&](std::size_t i) { return mixed_sizes[i]; });
+
+        if (ok && !reuse)
+            std::ofstream(stamp) << "ok\n";
+
+        return ok;
+    }
+
+    // ------------------------------------------------------------
+    // Measurement
+    // ------------------------------------------------------------
+
+    // Best effort: evict clean pages of every file so the next read hits
+    // the disk. Needs no privileges, but cannot evict pages other processes
+    // keep mapped.
+    bool drop_cache(const DataSet& set)
+    {
+#if defined(_WIN32)
+        (void)set;
+        return false;
+#else
+        for (const auto& path : set.files)
+        {
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                continue;
+            ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            ::close(fd);
+        }
+        return true;
+#endif
+    }
+
+    double median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+
+    void print_header()
+    {
+        std::printf("%-8s %-28s %-5s %10s %10s %12s\n", "set", "method", "cache", "ms", "MiB/s", "files/s");
+    }
+
+    void print_row(const DataSet& set, std::string_view method, bool cold, double ms)
+    {
+        const double seconds = ms / 1000.0;
+        std::printf("%-8s %-28.*s %-5s %10.2f %10.1f %12.0f\n",
+                    set.name.c_str(), static_cast<int>(method.size()), method.data(), cold ? "cold" : "warm", ms,
+                    seconds > 0 ? static_cast<double>(set.bytes) / (1 << 20) / seconds : 0.0,
+                    seconds > 0 ? static_cast<double>(set.files.size()) / seconds : 0.0);
+        std::fflush(stdout);
+    }
+
+    void measure(const Options& options, const DataSet& set, std::string_view method,
+                 const std::function<void(const DataSet&)>& run)
+    {
+        for (const bool cold : { false, true })
+        {
+            if (cold && !options.cold)
+                continue;
+
+            // One untimed run warms the cache (and the code paths).
+            if (!cold)
+                run(set);
+
+            std::vector<double> samples;
+            for (int i = 0; i < options.repeat; ++i)
+            {
+                if (cold && !drop_cache(set))
+                    return;
+
+                const auto start = Clock::now();
+                run(set);
+                samples.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+            }
+
+            print_row(set, method, cold, median(std::move(samples)));
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Loading strategies
+    // ------------------------------------------------------------
+
+    void load_ifstream_text(const DataSet& set)
+    {
+        std::string text;
+        for (const auto& path : set.files)
+        {
+            filesystem::read_text_file(path, text);
+            g_checksum += text.size();
+        }
+    }
+
+    // What ResourceSystem::load_binary does for a loose file.
+    void load_ifstream_binary(const DataSet& set)
+    {
+        std::vector<std::uint8_t> data;
+        for (const auto& path : set.files)
+        {
+            filesystem::read_binary_file(path, data);
+            g_checksum += data.size();
+        }
+    }
+
+    void load_mmap(const DataSet& set)
+    {
+        filesystem::MappedFile file;
+        for (const auto& path : set.files)
+        {
+            if (!file.open(path))
+                continue;
+
+            // Touch every page so the data is actually read.
+            const auto bytes = file.bytes();
+            for (std::size_t i = 0; i < bytes.size(); i += 4096)
+                g_checksum += bytes[i];
+        }
+    }
+
+#if !defined(_WIN32)
+    void load_pread(const DataSet& set)
+    {
+        std::vector<std::uint8_t> data;
+        for (const auto& path : set.files)
+        {
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                continue;
+
+            struct stat st{};
+            if (::fstat(fd, &st) == 0)
+            {
+                data.resize(static_cast<std::size_t>(st.st_size));
+                std::size_t done = 0;
+                while (done < data.size())
+                {
+                    const ssize_t n = ::pread(fd, data.data() + done, data.size() - done, static_cast<off_t>(done));
+                    if (n <= 0)
+                        break;
+                    done += static_cast<std::size_t>(n);
+                }
+                g_checksum += done;
+            }
+            ::close(fd);
+        }
+    }
+#endif
+
+    void load_async(filesystem::AsyncFileIO& io, const DataSet& set)
+    {
+        std::vector<filesystem::ReadRequest> requests;
+        requests.reserve(set.files.size());
+        for (const auto& path : set.files)
+            requests.push_back({ path });
+
+        std::vector<filesystem::ReadResult> results;
+        io.read_batch(std::move(requests), results).wait();
+
+        for (const auto& result : results)
+            g_checksum += result.data.size();
+    }
+
+    const char* backend_name(filesystem::AsyncFileIO::Backend backend)
+    {
+        switch (backend)
+        {
+            case filesystem::AsyncFileIO::Backend::IoUring:    return "io_uring";
+            case filesystem::AsyncFileIO::Backend::ThreadPool: return "thread pool";
+            case filesystem::AsyncFileIO::Backend::Inline:     return "inline";
+        }
+        return "?";
+    }
+
+    // ------------------------------------------------------------
+    // Directory scans
+    // ------------------------------------------------------------
+
+    void measure_scan(const Options& options, std::string_view method, const std::function<void()>& run)
+    {
+        run();
+
+        std::vector<double> samples;
+        for (int i = 0; i < options.repeat; ++i)
+        {
+            const auto start = Clock::now();
+            run();
+            samples.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+
+        std::printf("%-44.*s %10.2f ms\n", static_cast<int>(method.size()), method.data(), median(std::move(samples)));
+        std::fflush(stdout);
+    }
+
+    void run_scans(const Options& options, jobs::JobSystem& jobSystem)
+    {
+        std::printf("\nDirectory scans over %s\n", options.directory.string().c_str());
+
+        measure_scan(options, "FileWatcher initial snapshot (polling)", [&]
+        {
+            filesystem::FileWatcher watcher(options.directory, true, false);
+            g_checksum += watcher.entry_count();
+        });
+
+        measure_scan(options, "FileWatcher initial snapshot (polling, jobs)", [&]
+        {
+            filesystem::FileWatcher watcher;
+            watcher.set_job_system(&jobSystem);
+            watcher.set_root(options.directory, true, false);
+            g_checksum += watcher.entry_count();
+        });
+
+        measure_scan(options, "FileWatcher initial snapshot (native)", [&]
+        {
+            filesystem::FileWatcher watcher(options.directory, true);
+            g_checksum += watcher.entry_count();
+        });
+
+        filesystem::FileWatcher polling(options.directory, true, false);
+        measure_scan(options, "FileWatcher::update (polling, no changes)", [&]
+        {
+            polling.update();
+            g_checksum += polling.poll_events().size();
+        });
+
+        filesystem::FileWatcher native(options.directory, true);
+        if (native.backend() == filesystem::FileWatcher::Backend::Inotify)
+        {
+            measure_scan(options, "FileWatcher::update (inotify, no changes)", [&]
+            {
+                native.update();
+                g_checksum += native.poll_events().size();
+            });
+        }
+
+        measure_scan(options, "AssetDatabase::build_initial_scan (walk)", [&]
+        {
+            assets::AssetDatabase database;
+            database.initialize(options.directory);
+            database.build_initial_scan();
+            g_checksum += database.snapshot()->size();
+        });
+
+        measure_scan(options, "AssetDatabase::build_initial_scan (walk, jobs)", [&]
+        {
+            assets::AssetDatabase database;
+            database.initialize(options.directory);
+            database.set_job_system(&jobSystem);
+            database.build_initial_scan();
+            g_checksum += database.snapshot()->size();
+        });
+
+        const fs::path cacheFile = fs::temp_directory_path() / "wave_bench_io_assets.wadb";
+        {
+            assets::AssetDatabase database;
+            database.initialize(options.directory);
+            database.build_initial_scan();
+            database.save_cache(cacheFile);
+        }
+        measure_scan(options, "AssetDatabase::build_initial_scan (warm cache)", [&]
+        {
+            assets::AssetDatabase database;
+            database.initialize(options.directory);
+            database.load_cache(cacheFile);
+            database.build_initial_scan();
+            g_checksum += database.snapshot()->size();
+        });
+        std::error_code ec;
+        fs::remove(cacheFile, ec);
+
+        filesystem::DirectoryIndex index(options.directory);
+        measure_scan(options, "AssetDatabase::build_initial_scan (index)", [&]
+        {
+            assets::AssetDatabase database;
+            database.initialize(options.directory);
+            database.build_initial_scan(index);
+            g_checksum += database.snapshot()->size();
+        });
+    }
+
+} // namespace wave::tools::bench_io
+
+int main(int argc, char** argv)
+{
+    using namespace wave::tools::bench_io;
+
+    Options options;
+    if (!parse_options(argc, argv, options))
+    {
+        print_usage();
+        const std::string_view arg = argc > 1 ? argv[1] : "";
+        return (arg == "--help" || arg == "-h") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    std::vector<DataSet> sets;
+    if (!generate(options, sets))
+        return EXIT_FAILURE;
+
+    jobs::JobSystem job_system;
+    job_system.initialize(options.threads != 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency()));
+
+    filesystem::AsyncFileIO uring;
+    uring.initialize(&job_system, 256, true);
+
+    filesystem::AsyncFileIO pool;
+    pool.initialize(&job_system, 256, false);
+
+    std::string uring_name = std::string("AsyncFileIO (") + backend_name(uring.backend()) + ")";
+    std::string pool_name  = std::string("AsyncFileIO (") + backend_name(pool.backend()) + ")";
+
+    print_header();
+    for (const auto& set : sets)
+    {
+        if (set.files.empty())
+            continue;
+
+        measure(options, set, "read_text_file", load_ifstream_text);
+        measure(options, set, "read_binary_file/load_binary", load_ifstream_binary);
+        measure(options, set, "MappedFile (mmap)", load_mmap);
+#if !defined(_WIN32)
+        measure(options, set, "pread", load_pread);
+#endif
+        measure(options, set, uring_name, [&](const DataSet& s) { load_async(uring, s); });
+        if (pool.backend() != uring.backend())
+            measure(options, set, pool_name, [&](const DataSet& s) { load_async(pool, s); });
+    }
+
+    run_scans(options, job_system);
+
+    uring.shutdown();
+    pool.shutdown();
+    job_system.shutdown();
+
+    if (!options.keep)
+    {
+        std::error_code ec;
+        fs::remove_all(options.directory, ec);
+    }
+
+    std::printf("\nchecksum %llu\n", static_cast<unsigned long long>(g_checksum));
+    return EXIT_SUCCESS;
+}
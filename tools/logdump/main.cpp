@@ -0,0 +1,320 @@
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/core/logging/binary_log_reader.hpp"
+#include "engine/core/logging/log_sink.hpp"
+
+namespace wave::tools::logdump
+{
+    namespace logging = wave::engine::core::logging;
+
+    struct Options
+    {
+        std::vector<std::string>            files;
+        bool                                json = false;
+        logging::LogLevel                   min_level = logging::LogLevel::Trace;
+        std::optional<std::uint32_t>        thread;
+        std::optional<std::uint32_t>        site;
+        std::optional<logging::LogChannel>  channel;
+        std::string                         file_filter;
+        std::string                         grep;
+    };
+
+    void print_usage()
+    {
+        std::cout << "Usage: wave_logdump [options] <file.wlog>...\n"
+                  << "\n"
+                  << "Options:\n"
+                  << "  --json              One JSON object per entry\n"
+                  << "  --min-level <lvl>   Skip entries below trace|debug|info|warn|error|critical\n"
+                  << "  --thread <id>       Only entries from this logger thread id\n"
+                  << "  --site <id>         Only entries from this call site id\n"
+                  << "  --channel <name>    Only entries from this channel (render, assets, ...)\n"
+                  << "  --file <text>       Only call sites whose source path contains <text>\n"
+                  << "  --grep <text>       Only entries whose message contains <text>\n";
+    }
+
+    bool parse_args(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+
+            auto value = [&]() -> const char*
+            {
+                if (i + 1 >= argc)
+                {
+                    std::cerr << "wave_logdump: " << arg << " needs a value\n";
+                    return nullptr;
+                }
+                return argv[++i];
+            };
+
+            if (arg == "--help" || arg == "-h")
+            {
+                print_usage();
+                std::exit(EXIT_SUCCESS);
+            }
+            else if (arg == "--json")
+            {
+                options.json = true;
+            }
+            else if (arg == "--min-level")
+            {
+                const char* v = value();
+                if (!v)
+                    return false;
+
+                if (!logging::parse_log_level(v, options.min_level))
+                {
+                    std::cerr << "wave_logdump: unknown level '" << v << "'\n";
+                    return false;
+                }
+            }
+            else if (arg == "--thread" || arg == "--site")
+            {
+                const char* v = value();
+                if (!v)
+                    return false;
+
+                const auto id = static_cast<std::uint32_t>(std::strtoul(v, nullptr, 10));
+                (arg == "--thread" ? options.thread : options.site) = id;
+            }
+            else if (arg == "--channel")
+            {
+                const char* v = value();
+                if (!v)
+                    return false;
+
+                logging::LogChannel channel{};
+                if (!logging::parse_log_channel(v, channel))
+                {
+                    std::cerr << "wave_logdump: unknown channel '" << v << "'\n";
+                    return false;
+                }
+                options.channel = channel;
+            }
+            else if (arg == "--file")
+            {
+                const char* v = value();
+                if (!v)
+                    return false;
+                options.file_filter = v;
+            }
+            else if (arg == "--grep")
+            {
+                const char* v = value();
+                if (!v)
+                    return false;
+                options.grep = v;
+            }
+            else if (!arg.empty() && arg[0] == '-')
+            {
+                std::cerr << "wave_logdump: unknown option " << arg << "\n";
+                return false;
+            }
+            else
+            {
+                options.files.emplace_back(arg);
+            }
+        }
+
+        return !options.files.empty();
+    }
+
+    // ------------------------------------------------------------
+    // Output
+    // ------------------------------------------------------------
+
+    std::string format_time(std::int64_t time_ns)
+    {
+        const std::time_t seconds = static_cast<std::time_t>(time_ns / 1000000000);
+        const int         millis  = static_cast<int>((time_ns / 1000000) % 1000);
+        std::tm           tm_buf{};
+
+#if defined(_WIN32)
+        localtime_s(&tm_buf, &seconds);
+#else
+        localtime_r(&seconds, &tm_buf);
+#endif
+
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%02d:%02d:%02d.%03d",
+                      tm_buf.tm_hour, tm_buf.tm_min, tm_buf.tm_sec, millis);
+        return buf;
+    }
+
+    void append_json_string(std::string& out, std::string_view text)
+    {
+        out += '"';
+        for (char c : text)
+        {
+            switch (c)
+            {
+                case '"':  out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n";  break;
+                case '\r': out += "\\r";  break;
+                case '\t': out += "\\t";  break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char esc[8];
+                        std::snprintf(esc, sizeof(esc), "\\u%04x", static_cast<unsigned>(c));
+                        out += esc;
+                    }
+                    else
+                    {
+                        out += c;
+                    }
+                    break;
+            }
+        }
+        out += '"';
+    }
+
+    void print_text(const logging::DecodedLogEntry& entry, const std::string& message)
+    {
+        std::string line = "[" + format_time(entry.time_ns) + "]";
+        line += "[t" + std::to_string(entry.thread_id) + "]";
+        line += "[";
+        line += logging::level_to_string(entry.level);
+        line += "] ";
+
+        if (entry.site && entry.site->channel != logging::LogChannel::General)
+        {
+            line += "[";
+            line += logging::channel_to_string(entry.site->channel);
+            line += "] ";
+        }
+
+        line += message;
+
+        if (entry.site)
+        {
+            line += " (" + entry.site->file + ":" + std::to_string(entry.site->line) + ")";
+        }
+
+        std::cout << line << '\n';
+    }
+
+    void print_json(const logging::DecodedLogEntry& entry, const std::string& message, std::string_view app)
+    {
+        std::string line = "{\"time_ns\":" + std::to_string(entry.time_ns);
+        line += ",\"app\":";
+        append_json_string(line, app);
+        line += ",\"thread\":" + std::to_string(entry.thread_id);
+        line += ",\"level\":";
+        append_json_string(line, logging::level_to_string(entry.level));
+
+        if (entry.site)
+        {
+            line += ",\"site\":" + std::to_string(entry.site->id);
+            line += ",\"channel\":";
+            append_json_string(line, logging::channel_to_string(entry.site->channel));
+            line += ",\"file\":";
+            append_json_string(line, entry.site->file);
+            line += ",\"line\":" + std::to_string(entry.site->line);
+            line += ",\"format\":";
+            append_json_string(line, entry.site->format);
+        }
+
+        line += ",\"args\":[";
+        for (std::size_t i = 0; i < entry.args.size(); ++i)
+        {
+            if (i > 0)
+                line += ',';
+            append_json_string(line, entry.args[i].to_text());
+        }
+        line += "],\"message\":";
+        append_json_string(line, message);
+        line += '}';
+
+        std::cout << line << '\n';
+    }
+
+    // ------------------------------------------------------------
+    // Dump
+    // ------------------------------------------------------------
+
+    bool dump_file(const std::string& path, const Options& options)
+    {
+        logging::BinaryLogReader reader;
+        if (!reader.open(path))
+        {
+            std::cerr << "wave_logdump: " << path << ": " << reader.error() << "\n";
+            return false;
+        }
+
+        logging::DecodedLogEntry entry;
+        while (reader.next(entry))
+        {
+            if (entry.level < options.min_level)
+                continue;
+
+            if (options.thread && entry.thread_id != *options.thread)
+                continue;
+
+            if (options.site && (!entry.site || entry.site->id != *options.site))
+                continue;
+
+            if (options.channel)
+            {
+                const auto channel = entry.site ? entry.site->channel : logging::LogChannel::General;
+                if (channel != *options.channel)
+                    continue;
+            }
+
+            if (!options.file_filter.empty() &&
+                (!entry.site || entry.site->file.find(options.file_filter) == std::string::npos))
+                continue;
+
+            const std::string message = entry.message();
+
+            if (!options.grep.empty() && message.find(options.grep) == std::string::npos)
+                continue;
+
+            if (options.json)
+                print_json(entry, message, reader.app_name());
+            else
+                print_text(entry, message);
+        }
+
+        // A file cut short by a crash still decodes up to the last whole record.
+        if (!reader.error().empty())
+        {
+            std::cerr << "wave_logdump: " << path << ": " << reader.error() << "\n";
+            return false;
+        }
+
+        return true;
+    }
+
+} // namespace wave::tools::logdump
+
+int main(int argc, char** argv)
+{
+    using namespace wave::tools::logdump;
+
+    Options options;
+    if (!parse_args(argc, argv, options))
+    {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    bool ok = true;
+    for (const auto& file : options.files)
+    {
+        ok = dump_file(file, options) && ok;
+    }
+
+    std::cout.flush();
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,304 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/core/filesystem/pak_archive.hpp"
+#include "engine/core/filesystem/pak_writer.hpp"
+
+namespace wave::tools::pak
+{
+    namespace fs         = std::filesystem;
+    namespace filesystem = wave::engine::core::filesystem;
+
+    void print_usage()
+    {
+        std::cout << "Usage:\n"
+                  << "  wave_pak create <out.wpak> <resource_dir> [options]\n"
+                  << "  wave_pak list <file.wpak>\n"
+                  << "  wave_pak extract <file.wpak> <out_dir>\n"
+                  << "  wave_pak verify <file.wpak> <resource_dir>\n"
+                  << "\n"
+                  << "Create options:\n"
+                  << "  --compress <codec>  none|lz4|zstd (default none)\n"
+                  << "  --level <n>         Codec level (lz4 > 0 uses LZ4HC)\n"
+                  << "  --store <ext,...>   Never compress these extensions\n"
+                  << "                      (default .png,.jpg,.ktx2,.ogg,.mp3,.zip,.gz)\n";
+    }
+
+    std::vector<std::string> split_extensions(std::string_view list)
+    {
+        std::vector<std::string> out;
+        while (!list.empty())
+        {
+            const std::size_t comma = list.find(',');
+            std::string ext(list.substr(0, comma));
+            if (!ext.empty())
+            {
+                if (ext[0] != '.')
+                    ext.insert(ext.begin(), '.');
+                out.push_back(std::move(ext));
+            }
+            list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+        }
+        return out;
+    }
+
+    std::string format_size(std::uint64_t bytes)
+    {
+        char buf[32];
+        if (bytes >= (1ull << 20))
+            std::snprintf(buf, sizeof(buf), "%.1f MiB", static_cast<double>(bytes) / (1 << 20));
+        else if (bytes >= (1ull << 10))
+            std::snprintf(buf, sizeof(buf), "%.1f KiB", static_cast<double>(bytes) / (1 << 10));
+        else
+            std::snprintf(buf, sizeof(buf), "%llu B", static_cast<unsigned long long>(bytes));
+        return buf;
+    }
+
+    // ------------------------------------------------------------
+    // Commands
+    // ------------------------------------------------------------
+
+    int create(int argc, char** argv)
+    {
+        if (argc < 4)
+        {
+            print_usage();
+            return EXIT_FAILURE;
+        }
+
+        const fs::path output = argv[2];
+        const fs::path input  = argv[3];
+
+        filesystem::PakWriteOptions options;
+        std::vector<std::string>    store = split_extensions(".png,.jpg,.jpeg,.ktx2,.ogg,.mp3,.zip,.gz");
+
+        for (int i = 4; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            if (i + 1 >= argc)
+            {
+                std::cerr << "wave_pak: " << arg << " needs a value\n";
+                return EXIT_FAILURE;
+            }
+
+            const char* value = argv[++i];
+
+            if (arg == "--compress")
+            {
+                if (!filesystem::parse_pak_compression(value, options.compression))
+                {
+                    std::cerr << "wave_pak: unknown codec '" << value << "'\n";
+                    return EXIT_FAILURE;
+                }
+            }
+            else if (arg == "--level")
+            {
+                options.level = std::atoi(value);
+            }
+            else if (arg == "--store")
+            {
+                store = split_extensions(value);
+            }
+            else
+            {
+                std::cerr << "wave_pak: unknown option " << arg << "\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        std::error_code ec;
+        if (!fs::is_directory(input, ec))
+        {
+            std::cerr << "wave_pak: " << input.string() << " is not a directory\n";
+            return EXIT_FAILURE;
+        }
+
+        filesystem::PakWriter writer(options);
+        writer.add_directory(input, [&](const fs::path& path)
+        {
+            const std::string ext = path.extension().string();
+            for (const auto& s : store)
+            {
+                if (s == ext)
+                    return filesystem::PakCompression::None;
+            }
+            return options.compression;
+        });
+
+        filesystem::PakWriter::Stats stats;
+        std::string error;
+        if (!writer.write(output, error, &stats))
+        {
+            std::cerr << "wave_pak: " << error << "\n";
+            return EXIT_FAILURE;
+        }
+
+        std::cout << output.string() << ": " << stats.files << " files ("
+                  << stats.compressed << " compressed), "
+                  << format_size(stats.input_bytes) << " -> " << format_size(stats.stored_bytes)
+                  << " stored, archive " << format_size(stats.archive_size) << "\n";
+        return EXIT_SUCCESS;
+    }
+
+    bool open_archive(const char* path, filesystem::PakArchive& archive)
+    {
+        if (!archive.open(path))
+        {
+            std::cerr << "wave_pak: " << path << ": " << archive.error() << "\n";
+            return false;
+        }
+        return true;
+    }
+
+    int list(int argc, char** argv)
+    {
+        if (argc < 3)
+        {
+            print_usage();
+            return EXIT_FAILURE;
+        }
+
+        filesystem::PakArchive archive;
+        if (!open_archive(argv[2], archive))
+            return EXIT_FAILURE;
+
+        for (const auto& entry : archive.entries())
+        {
+            char line[64];
+            std::snprintf(line, sizeof(line), "%12llu %12llu %-5s ",
+                          static_cast<unsigned long long>(entry.size),
+                          static_cast<unsigned long long>(entry.stored_size),
+                          filesystem::pak_compression_to_string(
+                              static_cast<filesystem::PakCompression>(entry.compression)));
+            std::cout << line << archive.name(entry) << '\n';
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    int extract(int argc, char** argv)
+    {
+        if (argc < 4)
+        {
+            print_usage();
+            return EXIT_FAILURE;
+        }
+
+        filesystem::PakArchive archive;
+        if (!open_archive(argv[2], archive))
+            return EXIT_FAILURE;
+
+        const fs::path out_dir = argv[3];
+        std::vector<std::uint8_t> data;
+        bool ok = true;
+
+        for (const auto& entry : archive.entries())
+        {
+            const std::string_view name = archive.name(entry);
+
+            // Names come from the file; never write outside out_dir.
+            const fs::path relative = fs::path(name).lexically_normal();
+            if (relative.is_absolute() || relative.empty() || *relative.begin() == "..")
+            {
+                std::cerr << "wave_pak: skipping unsafe path " << name << "\n";
+                ok = false;
+                continue;
+            }
+
+            if (!archive.read(entry, data))
+            {
+                std::cerr << "wave_pak: cannot decode " << name << "\n";
+                ok = false;
+                continue;
+            }
+
+            const fs::path target = out_dir / relative;
+            std::error_code ec;
+            fs::create_directories(target.parent_path(), ec);
+
+            std::ofstream file(target, std::ios::binary | std::ios::trunc);
+            if (!file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())))
+            {
+                std::cerr << "wave_pak: cannot write " << target.string() << "\n";
+                ok = false;
+            }
+        }
+
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // Compare an archive against the directory it was built from.
+    int verify(int argc, char** argv)
+    {
+        if (argc < 4)
+        {
+            print_usage();
+            return EXIT_FAILURE;
+        }
+
+        filesystem::PakArchive archive;
+        if (!open_archive(argv[2], archive))
+            return EXIT_FAILURE;
+
+        const fs::path root = argv[3];
+        std::vector<std::uint8_t> packed;
+        std::size_t mismatches = 0;
+        std::size_t checked    = 0;
+
+        std::error_code ec;
+        for (fs::recursive_directory_iterator it(root, ec), end; it != end && !ec; it.increment(ec))
+        {
+            if (!it->is_regular_file(ec))
+                continue;
+
+            const std::string name = it->path().lexically_relative(root).generic_string();
+            const auto* entry = archive.find(name);
+
+            filesystem::MappedFile loose;
+            if (!entry || !loose.open(it->path()) || !archive.read(*entry, packed) ||
+                packed.size() != loose.size() ||
+                !std::equal(packed.begin(), packed.end(), loose.bytes().begin()))
+            {
+                std::cout << "mismatch: " << name << "\n";
+                ++mismatches;
+            }
+            ++checked;
+        }
+
+        if (checked != archive.entries().size())
+        {
+            std::cout << "archive has " << archive.entries().size() << " entries, directory has "
+                      << checked << " files\n";
+            ++mismatches;
+        }
+
+        return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+} // namespace wave::tools::pak
+
+int main(int argc, char** argv)
+{
+    using namespace wave::tools::pak;
+
+    const std::string_view command = argc > 1 ? argv[1] : "";
+
+    if (command == "create")
+        return create(argc, argv);
+    if (command == "list")
+        return list(argc, argv);
+    if (command == "extract")
+        return extract(argc, argv);
+    if (command == "verify")
+        return verify(argc, argv);
+
+    print_usage();
+    return (command == "--help" || command == "-h") ? EXIT_SUCCESS : EXIT_FAILURE;
+}